@@ -4,19 +4,30 @@
 layout(location = 0) in vec3 pos;
 layout(location = 1) in vec2 tex;
 layout(location = 2) in vec3 norm;
-layout(location = 3) in ivec4 boneIds;
+layout(location = 3) in uvec4 boneIds;
 layout(location = 4) in vec4 weights;
 
 out vec3 vPos;
 out vec3 vNormal;
 out vec2 vTexCoords;
 
-uniform mat4 u_projectionView;
+layout (std140) uniform CameraBlock
+{
+	mat4 u_projectionView;
+	mat4 u_projection;
+	mat4 u_view;
+	vec4 u_cameraPosition;
+	vec4 u_lightPosition;
+	vec4 u_lightColor;
+};
 uniform mat4 u_transform;
 
 const int MAX_BONES = 100;
 const int MAX_BONE_INFLUENCE = 4;
-uniform mat4 u_finalBonesMatrices[MAX_BONES];
+layout (std140) uniform SkeletonBlock
+{
+	mat4 u_finalBonesMatrices[MAX_BONES];
+};
 
 void main()
 {
@@ -25,9 +36,10 @@ void main()
 
     for(int i = 0 ; i < MAX_BONE_INFLUENCE ; i++)
     {
-        if(boneIds[i] == -1)
+        // unused influences have no weight
+        if(weights[i] == 0.0)
             continue;
-        if(boneIds[i] >= MAX_BONES)
+        if(boneIds[i] >= uint(MAX_BONES))
         {
             totalPosition = vec4(pos, 1.0);
             break;
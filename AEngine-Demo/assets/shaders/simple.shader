@@ -3,19 +3,27 @@
 layout (location = 0) in vec3 aPos;
 layout (location = 1) in vec2 aTexCoord;
 layout (location = 2) in vec3 aNormal;
+layout (location = 8) in mat4 aTransform;
 
 out vec3 vPos;
 out vec3 vNormal;
 out vec2 vTexCoords;
 
-uniform mat4 u_projectionView;
-uniform mat4 u_transform;
+layout (std140) uniform CameraBlock
+{
+	mat4 u_projectionView;
+	mat4 u_projection;
+	mat4 u_view;
+	vec4 u_cameraPosition;
+	vec4 u_lightPosition;
+	vec4 u_lightColor;
+};
 
 void main()
 {
-	gl_Position = u_projectionView * u_transform * vec4(aPos, 1.0);
-	vPos = vec3(u_transform * vec4(aPos, 1.0));
-	vNormal = mat3(transpose(inverse(u_transform))) * aNormal;
+	gl_Position = u_projectionView * aTransform * vec4(aPos, 1.0);
+	vPos = vec3(aTransform * vec4(aPos, 1.0));
+	vNormal = mat3(transpose(inverse(aTransform))) * aNormal;
 	vTexCoords = aTexCoord;
 }
 
@@ -3,12 +3,21 @@
 layout (location = 0) in vec3 aPos;
 out vec3 TexCoords;
 
-uniform mat4 u_projectionView;
+layout (std140) uniform CameraBlock
+{
+	mat4 u_projectionView;
+	mat4 u_projection;
+	mat4 u_view;
+	vec4 u_cameraPosition;
+	vec4 u_lightPosition;
+	vec4 u_lightColor;
+};
 
 void main()
 {
 	TexCoords = aPos;
-	vec4 pos = u_projectionView * vec4(aPos, 1.0);
+	// cast away translation
+	vec4 pos = u_projection * mat4(mat3(u_view)) * vec4(aPos, 1.0);
 	gl_Position = pos.xyww;
 }
 
@@ -7,7 +7,15 @@ out vec2 TexCoord;
 out float YValue;
 out vec3 vPos;
 
-uniform mat4 u_projectionView;
+layout (std140) uniform CameraBlock
+{
+	mat4 u_projectionView;
+	mat4 u_projection;
+	mat4 u_view;
+	vec4 u_cameraPosition;
+	vec4 u_lightPosition;
+	vec4 u_lightColor;
+};
 uniform mat4 u_transform;
 
 void main()
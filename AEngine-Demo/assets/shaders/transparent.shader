@@ -3,17 +3,25 @@
 layout (location = 0) in vec3 aPos;
 layout (location = 1) in vec2 aTexCoord;
 layout (location = 2) in vec3 aNormal;
+layout (location = 8) in mat4 aTransform;
 
 out vec3 FragPos;
 out vec3 Normal;
 
-uniform mat4 u_projectionView;
-uniform mat4 u_transform;
+layout (std140) uniform CameraBlock
+{
+	mat4 u_projectionView;
+	mat4 u_projection;
+	mat4 u_view;
+	vec4 u_cameraPosition;
+	vec4 u_lightPosition;
+	vec4 u_lightColor;
+};
 
 void main()
 {
-    gl_Position = u_projectionView * u_transform * vec4(aPos, 1.0);
-    FragPos = vec3(u_transform * vec4(aPos, 1.0));
+    gl_Position = u_projectionView * aTransform * vec4(aPos, 1.0);
+    FragPos = vec3(aTransform * vec4(aPos, 1.0));
 	Normal = aNormal;
 }
 
@@ -22,7 +30,16 @@ void main()
 
 uniform vec4 u_baseColor;
 uniform samplerCube u_hdr;
-uniform vec3 u_camPos;
+
+layout (std140) uniform CameraBlock
+{
+	mat4 u_projectionView;
+	mat4 u_projection;
+	mat4 u_view;
+	vec4 u_cameraPosition;
+	vec4 u_lightPosition;
+	vec4 u_lightColor;
+};
 
 in vec3 FragPos;
 in vec3 Normal;
@@ -31,7 +48,7 @@ out vec4 FragColor;
 
 void main()
 {
-	vec3 I = normalize(FragPos - u_camPos);
+	vec3 I = normalize(FragPos - u_cameraPosition.xyz);
 	vec3 R = reflect(I, normalize(Normal));
 
 	vec3 hdr = texture(u_hdr, R).rgb;
@@ -4,7 +4,15 @@ layout (location = 0) in vec3 position;
 
 out vec2 textureCoords;
 
-uniform mat4 u_projectionView;
+layout (std140) uniform CameraBlock
+{
+	mat4 u_projectionView;
+	mat4 u_projection;
+	mat4 u_view;
+	vec4 u_cameraPosition;
+	vec4 u_lightPosition;
+	vec4 u_lightColor;
+};
 uniform mat4 u_model;
 
 void main()
@@ -148,7 +148,10 @@ public:
 		AEngine::RenderCommand::SetBlendFunction(AEngine::BlendFunction::SourceAlpha, AEngine::BlendFunction::OneMinusSourceAlpha);
 		AEngine::RenderCommand::EnableFaceCulling(true);
 		AEngine::RenderCommand::SetCullFace(AEngine::PolygonFace::Back);
-		this->GetWindow()->Maximise();
+		if (!IsHeadless())
+		{
+			this->GetWindow()->Maximise();
+		}
 	}
 };
 
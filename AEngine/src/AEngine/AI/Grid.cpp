@@ -1,30 +1,14 @@
 #include "Grid.h"
+#include "GridSearch.h"
 #include "AEngine/Render/RenderCommand.h"
 #include "AEngine/Core/Logger.h"
 
-#include <queue>
 #include <cmath>
-#include <set>
-#include <unordered_set>
 #include <fstream>
 #include <sstream>
-#include <utility>
-#include <functional>
 
 namespace AEngine
 {
-
-	struct pair_hash 
-	{
-		template <class T1, class T2>
-		std::size_t operator() (const std::pair<T1, T2>& p) const {
-			auto h1 = std::hash<T1>{}(p.first);
-			auto h2 = std::hash<T2>{}(p.second);
-
-			return h1 ^ h2;
-		}
-	};
-
 	static constexpr char* debug_shader = R"(
         #type vertex
 		#version 330 core
@@ -34,11 +18,19 @@ namespace AEngine
 
 		out vec3 color;
 
-        uniform mat4 u_transform;
+		layout (std140) uniform CameraBlock
+		{
+			mat4 u_projectionView;
+			mat4 u_projection;
+			mat4 u_view;
+			vec4 u_cameraPosition;
+			vec4 u_lightPosition;
+			vec4 u_lightColor;
+		};
 
 		void main()
 		{
-			gl_Position = u_transform * vec4(aPos, 1.0);
+			gl_Position = u_projectionView * vec4(aPos, 1.0);
 			color = aColor;
 		}
 
@@ -101,7 +93,7 @@ namespace AEngine
 		ss >> m_position.y; ss.ignore();
 		ss >> m_position.z;
 
-		m_grid.resize(m_gridSize.x, std::vector<Node>(m_gridSize.y));
+		m_walkable.assign(static_cast<Size_t>(m_gridSize.x) * m_gridSize.y, 0);
 
 		for (int x = 0; x < m_gridSize.x; x++)
 		{
@@ -112,7 +104,7 @@ namespace AEngine
 				bool active;
 				ssLine >> active; 
 				ssLine.ignore();
-				m_grid[x][y] = Node({ x, y, 0, 0, nullptr, active });
+				m_walkable[GetIndex(x, y)] = active;
 			}
 		}
 
@@ -138,7 +130,7 @@ namespace AEngine
 		{
 			for(int y = 0; y < m_gridSize.y; y++)
 			{
-				file << m_grid[x][y].isActive << ",";
+				file << static_cast<bool>(m_walkable[GetIndex(x, y)]) << ",";
 			}
 			file << std::endl;
 		}
@@ -152,8 +144,7 @@ namespace AEngine
 		m_tileSize = tileSize;
 		m_position = position;
 
-		m_grid.clear();
-		m_grid.resize(m_gridSize.x, std::vector<Node>(m_gridSize.y));
+		m_walkable.assign(static_cast<Size_t>(m_gridSize.x) * m_gridSize.y, 0);
 
 		GenerateGrid();
 	}
@@ -180,7 +171,7 @@ namespace AEngine
 
 				Math::vec3 color;
 
-				if (m_grid[x][y].isActive)
+				if (m_walkable[GetIndex(x, y)])
 					color = Math::vec3(0.0f, 1.0f, 0.0f);
 				else
 					color = Math::vec3(1.0f, 0.0f, 0.0f);
@@ -205,8 +196,6 @@ namespace AEngine
 				};
 
 				indices.insert(indices.end(), boxIndices.begin(), boxIndices.end());
-
-				m_grid[x][y] = Node({ x, y, 0, 0, nullptr, m_grid[x][y].isActive });		
 			}
 		}
 
@@ -221,14 +210,13 @@ namespace AEngine
 	}
 
 
-	void Grid::DebugRender(const PerspectiveCamera* camera)
+	void Grid::DebugRender()
 	{
 		m_debugShader->Bind();
 		m_debugGrid->Bind();
 
 		RenderCommand::PolygonMode(PolygonFace::Front, PolygonDraw::Line);
 
-		m_debugShader->SetUniformMat4("u_transform", camera->GetProjectionViewMatrix());
 		RenderCommand::DrawIndexed(Primitive::Triangles, m_debugGrid->GetIndexBuffer()->GetCount(), 0);
 
 		RenderCommand::PolygonMode(PolygonFace::Front, PolygonDraw::Fill);
@@ -263,7 +251,7 @@ namespace AEngine
 			
 			if (newX >= 0 && newX < m_gridSize.x && newY >= 0 && newY < m_gridSize.y) 
 			{
-				if (m_grid[newX][newY].isActive) 
+				if (m_walkable[GetIndex(newX, newY)]) 
 				{
 					return Math::ivec2(newX, newY);
 				}
@@ -276,165 +264,52 @@ namespace AEngine
 	// Convert from world coordinates to grid coordinates
 	std::vector<float> Grid::GetAStarPath(Math::vec3 start, Math::vec3 end, bool checkNeighbours)
 	{
+		std::vector<float> waypoints; // Simplified path
+
 		Math::ivec2 tileStart = GetTile(start, checkNeighbours);
 		Math::ivec2 tileEnd = GetTile(end, checkNeighbours);
 
 		if(tileStart.x == -1 || tileEnd.x == -1)
-			return std::vector<float>();
-
-		return AStar(m_grid[tileStart.x][tileStart.y], m_grid[tileEnd.x][tileEnd.y]);
-	}
-
-	std::vector<float> Grid::AStar(Node start, Node end)
-	{
-		std::vector<Node> path; // Final path
-		std::vector<float> waypoints; // Simplified path
-
-		if(!start.isActive || !end.isActive) // If the start or end node is not walkable
 			return waypoints;
 
-		for(int x = 0; x < m_gridSize.x; x++)
-		{
-			for(int y = 0; y < m_gridSize.y; y++)
-			{
-				m_grid[x][y].parent = nullptr;
-			}
-		}
-
-		auto cmp = [this](const std::pair<int, int>& a, const std::pair<int, int>& b) {
-			const Node& nodeA = m_grid[a.first][a.second];
-			const Node& nodeB = m_grid[b.first][b.second];
-			return (nodeA.gCost + nodeA.hCost) > (nodeB.gCost + nodeB.hCost); // lowest fCost has the highest priority
-		};
-
-		std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int>>, decltype(cmp)> openList(cmp); // Nodes to be evaluated (green in video)
-		std::set<std::pair<int, int>> closedList; // Nodes already evaluated (red in video)
-		std::unordered_set<std::pair<int, int>, pair_hash> openSetLookup; // Quick existence checks for the open list
-
-		openList.push({start.x, start.y});
-
-		while (!openList.empty())
-		{
-			auto coord = openList.top(); // Get the node with the lowest fCost
-			Node& current = m_grid[coord.first][coord.second];
-			openList.pop(); // Remove the node from the openList with the lowest fCost
-			openSetLookup.erase({current.x, current.y}); // Remove the node from the openSetLookup
-			closedList.insert({current.x, current.y}); // Insert into the closed list
-
-			if (current == end) // If we reached the target node
-			{
-				Node* backtrackNode = &current;
-				while (backtrackNode != nullptr) 
-				{
-					path.push_back(*backtrackNode);
-					backtrackNode = backtrackNode->parent;
-				}
-				std::vector<Math::vec3> Vec3waypoints = SimplifyPath(path);
-				std::reverse(Vec3waypoints.begin(), Vec3waypoints.end());
-				
-					// Lua doesnt support vec3 at the moment
-				for(Math::vec3 positions : Vec3waypoints)
-				{
-					waypoints.push_back(positions.x);
-					waypoints.push_back(positions.y);
-					waypoints.push_back(positions.z);
-				}
-
-				return waypoints;
-			}
-
-			for(auto& neighbour : GetNeighbours(current))
-			{
-				if (!neighbour.isActive || closedList.find({neighbour.x, neighbour.y}) != closedList.end())
-					continue;
-
-				int costToNeighbour = current.gCost + GetDistance(current, neighbour); // Calculate the cost to the neighbour
-
-				if(costToNeighbour < neighbour.gCost || openSetLookup.find({neighbour.x, neighbour.y}) == openSetLookup.end())
-				{
-					int nX = neighbour.x;
-					int nY = neighbour.y;
-
-					m_grid[nX][nY].parent = &m_grid[current.x][current.y];
-					m_grid[nX][nY].gCost = costToNeighbour;
-					m_grid[nX][nY].hCost = GetDistance(neighbour, end);
-
-					if(openSetLookup.find({nX, nY}) == openSetLookup.end())
-					{
-						openList.push({nX, nY});
-						openSetLookup.insert({nX, nY});
-					}
-				}
-			}
-		}
+			// reused between queries, so only the returned waypoints allocate
+		thread_local std::vector<Math::ivec2> path;
+		if(GridSearch::FindPath(m_walkable.data(), m_gridSize, tileStart, tileEnd, path))
+			SimplifyPath(path, waypoints);
 
 		return waypoints;
 	}
 
-	std::vector<Math::vec3> Grid::SimplifyPath(std::vector<Node>& path)
+	void Grid::SimplifyPath(const std::vector<Math::ivec2>& path, std::vector<float>& waypoints) const
 	{
-		std::vector<Math::vec3> waypoints;
-
-		Math::vec2 directionOld = Math::vec2(0.0f);
-
-		for(int i = 1; i < path.size(); i++)
+			// Keeps the tile before each change of direction, and the tile before the end
+		for(Size_t i = 0; i + 1 < path.size(); i++)
 		{
-			Math::vec2 directionNew = Math::vec2(path[i - 1].x - path[i].x, path[i - 1].y - path[i].y);
-			if(directionNew != directionOld)
+			Math::ivec2 direction = path[i + 1] - path[i];
+			Math::ivec2 directionNext = (i + 2 < path.size()) ? path[i + 2] - path[i + 1] : Math::ivec2(0);
+			if(direction != directionNext)
 			{
-				Math::vec3 pos;
-				pos.x = path[i].x * (m_tileSize + m_tileOffset) + m_position.x;
-				pos.y = 0.0f + m_position.y;
-				pos.z = path[i].y * (m_tileSize + m_tileOffset) + m_position.z;
-				waypoints.push_back(pos);
-			}
-			directionOld = directionNew;
-		}
-
-		return waypoints;
-	}
-
-	std::vector<Node> Grid::GetNeighbours(Node& current)
-	{
-		std::vector<Node> neighbours;
-
-		for(int x = -1; x <= 1; x++)
-		{
-			for(int y = -1; y <= 1; y++)
-			{
-				if(x == 0 && y == 0) // Skip the current node
-					continue;
-
-				int checkX = current.x + x;
-				int checkY = current.y + y;
-
-				if(checkX >= 0 && checkX < m_gridSize.x && checkY >= 0 && checkY < m_gridSize.y) // Check if the neighbour are within the grid
-					neighbours.push_back(m_grid[checkX][checkY]);
+					// Lua doesnt support vec3 at the moment
+				waypoints.push_back(path[i].x * (m_tileSize + m_tileOffset) + m_position.x);
+				waypoints.push_back(0.0f + m_position.y);
+				waypoints.push_back(path[i].y * (m_tileSize + m_tileOffset) + m_position.z);
 			}
 		}
-
-		return neighbours;
 	}
 
-	int Grid::GetDistance(Node nodeA, Node nodeB)
+	Size_t Grid::GetIndex(int row, int coloumn) const
 	{
-		int dstx = std::abs(nodeA.x - nodeB.x);
-		int dsty = std::abs(nodeA.y - nodeB.y);
-
-		if(dstx > dsty)
-			return 14 * dsty + 10 * (dstx - dsty);
-		else
-			return 14 * dstx + 10 * (dsty - dstx);
+		return static_cast<Size_t>(row) * m_gridSize.y + coloumn;
 	}
 
 	bool Grid::IsActive(int row, int coloumn)
 	{
-		return m_grid[row][coloumn].isActive;
+		return m_walkable[GetIndex(row, coloumn)];
 	}
 
     void Grid::SetActive(int row, int coloumn)
 	{
-		m_grid[row][coloumn].isActive = !m_grid[row][coloumn].isActive;
+		m_walkable[GetIndex(row, coloumn)] = !m_walkable[GetIndex(row, coloumn)];
 	}
 	
 	Math::ivec2 Grid::GetGridSize()
@@ -3,26 +3,11 @@
 #include "AEngine/Render/VertexArray.h"
 #include "AEngine/Math/Math.h"
 #include "AEngine/Render/Shader.h"
-#include "AEngine/Core/PerspectiveCamera.h"
 #include "AEngine/Resource/Asset.h"
 #include <vector>
 
 namespace AEngine
 {
-    struct Node
-    {
-        int x, y;
-        int gCost = 0; // Distance from start node
-        int hCost = 0; // Distance from end node
-        Node* parent = nullptr;
-        bool isActive = false;
-
-        bool operator==(const Node& other) const
-        {
-            return this->x == other.x && this->y == other.y;
-        }
-    };
-
     class Grid : public Asset
     {
     public:
@@ -43,16 +28,14 @@ namespace AEngine
         bool IsActive(int row, int coloumn);
         void SetActive(int row, int coloumn);
 	    std::vector<float> GetAStarPath(Math::vec3 start, Math::vec3 end, bool checkNeighbours);
-        void DebugRender(const PerspectiveCamera* camera);
+        void DebugRender();
 
         static SharedPtr<Grid> Create(Math::ivec2 m_gridSize, float tileSize, Math::vec3 position);
         static SharedPtr<Grid> Create(const std::string& ident, const std::string& path);
 
     private:
-    	std::vector<Math::vec3> Grid::SimplifyPath(std::vector<Node>& path);
-        std::vector<float> AStar(Node start, Node end);
-	    std::vector<Node> GetNeighbours(Node& current);
-	    int GetDistance(Node nodeA, Node nodeB);
+        void SimplifyPath(const std::vector<Math::ivec2>& path, std::vector<float>& waypoints) const;
+        Size_t GetIndex(int row, int coloumn) const;
         void LoadFromFile(const std::string& path);
         Math::ivec2 GetTile(const Math::vec3& position, bool checkNeighbours);
 
@@ -60,7 +43,7 @@ namespace AEngine
         Math::ivec2 m_gridSize;
         float m_tileSize;
         Math::vec3 m_position;
-        std::vector<std::vector<Node>> m_grid;
+        std::vector<Uint8> m_walkable; // row-major, a row per x
         SharedPtr<VertexArray> m_debugGrid;
         SharedPtr<Shader> m_debugShader;
 
@@ -0,0 +1,234 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#include "GridSearch.h"
+#include <algorithm>
+#include <cstdlib>
+
+namespace
+{
+	constexpr AEngine::Uint32 g_aeStraightCost = 10;
+	constexpr AEngine::Uint32 g_aeDiagonalCost = 14;
+	constexpr int g_aeClosed = -1;
+
+	struct OpenEntry
+	{
+		AEngine::Uint32 f;   // g + h, the heap key
+		AEngine::Uint32 h;   // breaks ties towards the end
+		int cell;
+	};
+
+	// search state of one thread, sized for the largest grid it has searched
+	struct SearchScratch
+	{
+		std::vector<AEngine::Uint32> stamp;   // cell was reached this query if it holds the query's generation
+		std::vector<AEngine::Uint32> g;       // cost from the start
+		std::vector<int> parent;              // previous cell on the cheapest path
+		std::vector<int> heapIndex;           // position in the open heap, or g_aeClosed
+		std::vector<OpenEntry> open;          // binary min heap
+		AEngine::Uint32 generation{ 0 };
+
+		AEngine::Uint32 Begin(AEngine::Size_t cells)
+		{
+			if (stamp.size() < cells)
+			{
+				stamp.resize(cells, 0);
+				g.resize(cells);
+				parent.resize(cells);
+				heapIndex.resize(cells);
+			}
+
+			// stamps are only cleared when the generation wraps
+			if (++generation == 0)
+			{
+				std::fill(stamp.begin(), stamp.end(), 0);
+				generation = 1;
+			}
+
+			open.clear();
+			return generation;
+		}
+
+		static bool Less(const OpenEntry& lhs, const OpenEntry& rhs)
+		{
+			return lhs.f < rhs.f || (lhs.f == rhs.f && lhs.h < rhs.h);
+		}
+
+		void Place(AEngine::Size_t index, const OpenEntry& entry)
+		{
+			open[index] = entry;
+			heapIndex[entry.cell] = static_cast<int>(index);
+		}
+
+		void SiftUp(AEngine::Size_t index)
+		{
+			const OpenEntry entry = open[index];
+			while (index > 0)
+			{
+				const AEngine::Size_t parentIndex = (index - 1) / 2;
+				if (!Less(entry, open[parentIndex]))
+				{
+					break;
+				}
+
+				Place(index, open[parentIndex]);
+				index = parentIndex;
+			}
+
+			Place(index, entry);
+		}
+
+		void SiftDown(AEngine::Size_t index)
+		{
+			const OpenEntry entry = open[index];
+			const AEngine::Size_t count = open.size();
+			while (true)
+			{
+				AEngine::Size_t child = index * 2 + 1;
+				if (child >= count)
+				{
+					break;
+				}
+
+				if (child + 1 < count && Less(open[child + 1], open[child]))
+				{
+					++child;
+				}
+
+				if (!Less(open[child], entry))
+				{
+					break;
+				}
+
+				Place(index, open[child]);
+				index = child;
+			}
+
+			Place(index, entry);
+		}
+
+		void Push(const OpenEntry& entry)
+		{
+			open.push_back(entry);
+			SiftUp(open.size() - 1);
+		}
+
+		int Pop()
+		{
+			const int cell = open.front().cell;
+			heapIndex[cell] = g_aeClosed;
+			const OpenEntry last = open.back();
+			open.pop_back();
+			if (!open.empty())
+			{
+				open.front() = last;
+				SiftDown(0);
+			}
+
+			return cell;
+		}
+
+		void DecreaseKey(int cell, AEngine::Uint32 g)
+		{
+			const AEngine::Size_t index = static_cast<AEngine::Size_t>(heapIndex[cell]);
+			open[index].f = g + open[index].h;
+			SiftUp(index);
+		}
+	};
+
+	thread_local SearchScratch g_aeScratch;
+}
+
+namespace AEngine
+{
+	bool GridSearch::FindPath(const Uint8* walkable, Math::ivec2 size, Math::ivec2 start, Math::ivec2 end, std::vector<Math::ivec2>& path)
+	{
+		path.clear();
+		auto inside = [size](Math::ivec2 cell) {
+			return cell.x >= 0 && cell.x < size.x && cell.y >= 0 && cell.y < size.y;
+		};
+
+		if (!inside(start) || !inside(end))
+		{
+			return false;
+		}
+
+		const int startCell = start.x * size.y + start.y;
+		const int endCell = end.x * size.y + end.y;
+		if (!walkable[startCell] || !walkable[endCell])
+		{
+			return false;
+		}
+
+		SearchScratch& scratch = g_aeScratch;
+		const Uint32 generation = scratch.Begin(static_cast<Size_t>(size.x) * static_cast<Size_t>(size.y));
+
+		scratch.stamp[startCell] = generation;
+		scratch.g[startCell] = 0;
+		scratch.parent[startCell] = -1;
+		const Uint32 startH = GetDistance(start, end);
+		scratch.Push({ startH, startH, startCell });
+
+		while (!scratch.open.empty())
+		{
+			const int current = scratch.Pop();
+			if (current == endCell)
+			{
+				for (int cell = current; cell != -1; cell = scratch.parent[cell])
+				{
+					path.emplace_back(cell / size.y, cell % size.y);
+				}
+
+				std::reverse(path.begin(), path.end());
+				return true;
+			}
+
+			const Math::ivec2 position{ current / size.y, current % size.y };
+			const Uint32 currentG = scratch.g[current];
+			for (int dx = -1; dx <= 1; ++dx)
+			{
+				for (int dy = -1; dy <= 1; ++dy)
+				{
+					const Math::ivec2 neighbour{ position.x + dx, position.y + dy };
+					if ((dx == 0 && dy == 0) || !inside(neighbour))
+					{
+						continue;
+					}
+
+					const int cell = neighbour.x * size.y + neighbour.y;
+					if (!walkable[cell])
+					{
+						continue;
+					}
+
+					const Uint32 g = currentG + (dx != 0 && dy != 0 ? g_aeDiagonalCost : g_aeStraightCost);
+					if (scratch.stamp[cell] != generation)
+					{
+						scratch.stamp[cell] = generation;
+						scratch.g[cell] = g;
+						scratch.parent[cell] = current;
+						const Uint32 h = GetDistance(neighbour, end);
+						scratch.Push({ g + h, h, cell });
+					}
+					else if (scratch.heapIndex[cell] != g_aeClosed && g < scratch.g[cell])
+					{
+						// the octile distance is consistent, so closed cells never need reopening
+						scratch.g[cell] = g;
+						scratch.parent[cell] = current;
+						scratch.DecreaseKey(cell, g);
+					}
+				}
+			}
+		}
+
+		return false;
+	}
+
+	Uint32 GridSearch::GetDistance(Math::ivec2 a, Math::ivec2 b)
+	{
+		const Uint32 dx = static_cast<Uint32>(std::abs(a.x - b.x));
+		const Uint32 dy = static_cast<Uint32>(std::abs(a.y - b.y));
+		return g_aeDiagonalCost * std::min(dx, dy) + g_aeStraightCost * (std::max(dx, dy) - std::min(dx, dy));
+	}
+}
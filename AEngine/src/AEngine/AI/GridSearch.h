@@ -0,0 +1,44 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+ * \brief A* search over a flat grid of walkable cells
+*/
+#pragma once
+#include "AEngine/Core/Types.h"
+#include "AEngine/Math/Math.h"
+#include <vector>
+
+namespace AEngine
+{
+		/**
+		 * \class GridSearch
+		 * \brief Finds paths over a row-major grid of walkable cells
+		 * \details
+		 * Cells connect to their eight neighbours, straight steps cost 10 and diagonal steps 14.
+		 * Search state lives in scratch buffers of the calling thread, which are reused between
+		 * queries and stamped per query instead of being reset, so after the first query on a
+		 * grid of a size, a search allocates nothing and costs only the cells it explores.
+		*/
+	class GridSearch
+	{
+	public:
+			/**
+			 * \brief Finds the cheapest path between two cells
+			 * \param[in] walkable size.x * size.y cells, non zero if walkable, cell (x, y) is at x * size.y + y
+			 * \param[in] size of the grid
+			 * \param[in] start cell
+			 * \param[in] end cell
+			 * \param[out] path cells from start to end inclusive, empty if there is no path
+			 * \retval true if a path was found
+			 * \retval false if either cell is outside the grid or not walkable, or the end can not be reached
+			*/
+		static bool FindPath(const Uint8* walkable, Math::ivec2 size, Math::ivec2 start, Math::ivec2 end, std::vector<Math::ivec2>& path);
+			/**
+			 * \brief Returns the cost of the cheapest path between two cells, ignoring walls
+			 * \param[in] a first cell
+			 * \param[in] b second cell
+			 * \return Octile distance between the cells
+			*/
+		static Uint32 GetDistance(Math::ivec2 a, Math::ivec2 b);
+	};
+}
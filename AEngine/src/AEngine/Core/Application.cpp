@@ -9,9 +9,14 @@
 #include "AEngine/Render/ResourceAPI.h"
 #include "AEngine/Resource/AssetManager.h"
 #include "AEngine/Scene/SceneManager.h"
+#include "AEngine/Script/Script.h"
+#include "AEngine/Script/ScriptEngine.h"
+#include "AEngine/Script/ScriptState.h"
 #include "AEngine/Render/RenderPipeline.h"
 #include "AEngine/Render/UIRenderCommand.h"
+#include "AEngine/Resource/AssetLoader.h"
 #include "Application.h"
+#include "JobSystem.h"
 #include "TimeStep.h"
 #include "Window.h"
 
@@ -25,6 +30,8 @@ namespace AEngine
 
 	// static initialisation
 	Application *Application::s_instance = nullptr;
+	static constexpr unsigned int s_defaultWidth = 1600;
+	static constexpr unsigned int s_defaultHeight = 900;
 
 	Application::Application(const Properties& properties)
 		: m_properties{ properties },
@@ -80,6 +87,21 @@ namespace AEngine
 		return m_window.get();
 	}
 
+	Math::uvec2 Application::GetViewportSize() const
+	{
+		if (m_window)
+		{
+			return m_window->GetSize();
+		}
+
+		return { s_defaultWidth, s_defaultHeight };
+	}
+
+	bool Application::IsHeadless() const
+	{
+		return m_properties.headless;
+	}
+
 	InputBuffer &Application::GetInput()
 	{
 		return m_input;
@@ -89,8 +111,27 @@ namespace AEngine
 	{
 		AE_LOG_INFO("Application::Init");
 		ResourceAPI::Initialise(ModelLoaderLibrary::Assimp);
+		AssetLoader::Instance().Initialise(m_properties.assetLoaderThreads);
+		JobSystem::Instance().Initialise(m_properties.jobWorkers);
+		Script::SetCacheEnabled(m_properties.cacheScripts);
+
+		ScriptState::GCSettings gcSettings = ScriptEngine::GetState().GetGCSettings();
+		gcSettings.mode = m_properties.scriptGCGenerational ? ScriptState::GCMode::Generational : ScriptState::GCMode::Incremental;
+		gcSettings.stepBudget = m_properties.scriptGCBudget;
+		ScriptEngine::GetState().SetGCSettings(gcSettings);
+
+		// headless runs record rendering instead of opening a window and context
+		if (m_properties.headless)
+		{
+			RenderCommand::Initialise(RenderLibrary::Null);
+			RenderCommand::SetViewport(0, 0, s_defaultWidth, s_defaultHeight);
+			RenderCommand::SetClearColor(Math::vec4{ 255.0f, 255.0f, 255.0f, 255.0f });
+			RenderCommand::EnableDepthTest(true);
+			return;
+		}
+
 		RenderCommand::Initialise(RenderLibrary::OpenGL);
-		m_window = AEngine::Window::Create({ m_properties.title, 1600, 900 });
+		m_window = AEngine::Window::Create({ m_properties.title, s_defaultWidth, s_defaultHeight });
 		EditorProperties props;
 		m_editor.Init(m_window.get(), props);
 
@@ -169,14 +210,21 @@ namespace AEngine
 
 	void Application::Shutdown()
 	{
-		m_editor.Shutdown();
+		if (!m_properties.headless)
+		{
+			m_editor.Shutdown();
+		}
+
 		AE_LOG_INFO("Applicaton::Shutdown");
 		m_layer->OnDetach();
+		AssetLoader::Instance().Shutdown();
 		SceneManager().UnloadAllScenes();
 		AEngine::AssetManager<Model>::Instance().Clear();
 		AEngine::AssetManager<Script>::Instance().Clear();
 		AEngine::AssetManager<Shader>::Instance().Clear();
 		AEngine::AssetManager<Texture>::Instance().Clear();
+		JobSystem::Instance().LogReport();
+		JobSystem::Instance().Shutdown();
 		AEngine::UIRenderCommand::Teardown();
 	}
 
@@ -186,10 +234,26 @@ namespace AEngine
 		AE_LOG_INFO("Application::Run");
 
 		m_clock.Start();
+		Size_t frame = 0;
 		while (m_running)
 		{
 			TimeStep dt = m_clock.GetDelta();
 
+			// finish assets whose decoding completed since the last frame
+			AssetLoader::Instance().ProcessUploads(m_properties.assetUploadBudget);
+
+			// no window to poll or editor to draw, just update the layer
+			if (m_properties.headless)
+			{
+				m_layer->OnUpdate(dt);
+				if (m_properties.frameLimit && ++frame >= m_properties.frameLimit)
+				{
+					Terminate();
+				}
+
+				continue;
+			}
+
 			// update the editor
 			m_editor.CreateNewFrame();
 
@@ -204,6 +268,11 @@ namespace AEngine
 			m_editor.Update();
 			m_editor.Render();
 			m_window->OnUpdate();
+
+			if (m_properties.frameLimit && ++frame >= m_properties.frameLimit)
+			{
+				Terminate();
+			}
 		}
 	}
 }
@@ -6,6 +6,7 @@
 #include "AEngine/Events/ApplicationEvent.h"
 #include "AEngine/Math/Math.h"
 #include "AEngine/Input/InputBuffer.h"
+#include "JobSystem.h"
 #include "Layer.h"
 #include "Timer.h"
 #include "Types.h"
@@ -41,6 +42,39 @@ namespace AEngine
 				 * \brief Working directory of the application
 				*/
 			std::string workingDir;
+				/**
+				 * \brief Runs without a window, editor or graphics context
+				 * \details Rendering goes through RenderLibrary::Null, which only records the work submitted
+				*/
+			bool headless = false;
+				/**
+				 * \brief Number of frames to run before terminating, zero runs until terminated
+				*/
+			Size_t frameLimit = 0;
+				/**
+				 * \brief Number of threads decoding assets, zero decodes on the main thread
+				*/
+			unsigned int assetLoaderThreads = 2;
+				/**
+				 * \brief Seconds per frame spent creating render objects for loaded assets
+				*/
+			float assetUploadBudget = 0.004f;
+				/**
+				 * \brief Number of threads besides the main thread running engine jobs, such as animation
+				*/
+			unsigned int jobWorkers = JobSystem::GetDefaultWorkerCount();
+				/**
+				 * \brief Writes compiled scripts beside their source, so later runs skip compiling them
+				*/
+			bool cacheScripts = true;
+				/**
+				 * \brief Collects Lua garbage generationally, otherwise incrementally within scriptGCBudget
+				*/
+			bool scriptGCGenerational = true;
+				/**
+				 * \brief Seconds per frame spent collecting Lua garbage in incremental mode, zero leaves collection to Lua
+				*/
+			float scriptGCBudget = 0.001f;
 		};
 
 	public:
@@ -72,6 +106,16 @@ namespace AEngine
 			 * \return Window* to the application window
 			*/
 		Window* GetWindow() const;
+			/**
+			 * \brief Returns the size of the area being rendered to
+			 * \return The window size, or the default window size when headless
+			*/
+		Math::uvec2 GetViewportSize() const;
+			/**
+			 * \brief Returns whether the application is running without a window
+			 * \return True if headless
+			*/
+		bool IsHeadless() const;
 		InputBuffer& GetInput();
 
 	private:
@@ -7,10 +7,16 @@
  * something that works better for our needs.
 **/
 #pragma once
+#include "AEngine/Render/Model.h"
+#include "AEngine/Render/ResourceAPI.h"
 #include "AEngine/Script/ScriptEngine.h"
 #include "Application.h"
 #include "Logger.h"
+#include <cstdlib>
+#include <cstring>
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 extern AEngine::Application* AEngine::CreateApplication(AEngine::Application::Properties&);
 
@@ -23,6 +29,41 @@ extern AEngine::Application* AEngine::CreateApplication(AEngine::Application::Pr
 		AEngine::Application::Properties props;
 		props.workingDir = argv[0];
 
+		// --headless runs without a window, --frames N stops after N frames
+		// --cook PATH prepares a model for loading and exits, it may be repeated
+		std::vector<std::string> cook;
+		for (int i = 1; i < argc; ++i)
+		{
+			if (std::strcmp(argv[i], "--headless") == 0)
+			{
+				props.headless = true;
+			}
+			else if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+			{
+				props.frameLimit = static_cast<AEngine::Size_t>(std::strtoull(argv[++i], nullptr, 10));
+			}
+			else if (std::strcmp(argv[i], "--cook") == 0 && i + 1 < argc)
+			{
+				cook.push_back(argv[++i]);
+			}
+		}
+
+		if (!cook.empty())
+		{
+			AEngine::ResourceAPI::Initialise(AEngine::ModelLoaderLibrary::Assimp);
+			int failed = 0;
+			for (const std::string& path : cook)
+			{
+				if (!AEngine::Model::Cook(path))
+				{
+					AE_LOG_ERROR("EntryPoint::Cook::Failed -> {}", path);
+					++failed;
+				}
+			}
+
+			return failed == 0 ? 0 : 1;
+		}
+
 		AE_LOG_INFO("EntryPoint::main");
 		auto app = AEngine::CreateApplication(props);
 		try {
@@ -7,15 +7,116 @@
 
 namespace AEngine
 {
-	Uint16 Identifier::s_next = 0;
+	std::vector<Uint32> Identifier::s_generations;
+	std::vector<bool> Identifier::s_alive;
+	std::vector<Uint32> Identifier::s_freeList;
+	std::vector<Uint32> Identifier::s_freePositions;
 
-	Uint16 Identifier::Generate()
+	Uint64 Identifier::Generate()
 	{
-		if (s_next == UINT16_MAX)
+		Uint32 index = 0;
+		if (!s_freeList.empty())
 		{
-			AE_LOG_FATAL("Identifier::Generate::Fatal -> Identifier limit reached '{}'", UINT16_MAX);
+			index = s_freeList.back();
+			RemoveFree(index);
+		}
+		else
+		{
+			if (s_generations.size() == UINT32_MAX)
+			{
+				AE_LOG_FATAL("Identifier::Generate::Fatal -> Identifier limit reached '{}'", UINT32_MAX);
+			}
+
+			index = static_cast<Uint32>(s_generations.size());
+			s_generations.push_back(0);
+			s_alive.push_back(false);
+			s_freePositions.push_back(NotFree);
+		}
+
+		s_alive[index] = true;
+		return Make(index, s_generations[index]);
+	}
+
+	bool Identifier::Acquire(Uint64 ident)
+	{
+		const Uint32 index = GetIndex(ident);
+		// a corrupt identifier must not grow the tables without bound
+		if (index == GetIndex(Null) || index >= s_generations.size() + MaxAcquireGrowth)
+		{
+			return false;
+		}
+
+		if (index < s_generations.size())
+		{
+			if (s_alive[index])
+			{
+				return false;
+			}
+
+			// the index has been released, take it out of the free list
+			RemoveFree(index);
+		}
+		else
+		{
+			// grow to the index, the skipped indices are free for Generate()
+			for (Uint32 i = static_cast<Uint32>(s_generations.size()); i < index; ++i)
+			{
+				s_generations.push_back(0);
+				s_alive.push_back(false);
+				s_freePositions.push_back(NotFree);
+				PushFree(i);
+			}
+
+			s_generations.push_back(0);
+			s_alive.push_back(false);
+			s_freePositions.push_back(NotFree);
+		}
+
+		s_generations[index] = GetGeneration(ident);
+		s_alive[index] = true;
+		return true;
+	}
+
+	void Identifier::Release(Uint64 ident)
+	{
+		if (!IsAlive(ident))
+		{
+			return;
+		}
+
+		const Uint32 index = GetIndex(ident);
+		s_alive[index] = false;
+		++s_generations[index];
+		PushFree(index);
+	}
+
+	bool Identifier::IsAlive(Uint64 ident)
+	{
+		const Uint32 index = GetIndex(ident);
+		return index < s_generations.size()
+			&& s_alive[index]
+			&& s_generations[index] == GetGeneration(ident);
+	}
+
+	void Identifier::PushFree(Uint32 index)
+	{
+		s_freePositions[index] = static_cast<Uint32>(s_freeList.size());
+		s_freeList.push_back(index);
+	}
+
+	void Identifier::RemoveFree(Uint32 index)
+	{
+		const Uint32 position = s_freePositions[index];
+		if (position == NotFree)
+		{
+			return;
 		}
 
-		return s_next++;
+		// swap the last free index into the hole
+		const Uint32 last = s_freeList.back();
+		s_freeList[position] = last;
+		s_freePositions[last] = position;
+		s_freeList.pop_back();
+		s_freePositions[index] = NotFree;
 	}
 }
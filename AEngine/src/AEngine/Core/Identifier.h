@@ -4,27 +4,103 @@
 */
 #pragma once
 #include "Types.h"
+#include <vector>
 
 namespace AEngine
 {
 		/**
 		 * \class Identifier
-		 * \brief Generates unique identifiers
-		 * \todo This will be improved to dynamically generate identifiers
+		 * \brief Generates unique, recyclable identifiers
+		 * \details
+		 * An identifier packs a 32 bit index in the low bits and a 32 bit generation in the
+		 * high bits. Released indices are reused, with the generation bumped so that stale
+		 * copies of the old identifier never compare equal to the new one.
 		*/
 	class Identifier
 	{
 	public:
+			/**
+			 * \brief Value that is never returned by Generate()
+			*/
+		static constexpr Uint64 Null = UINT64_MAX;
+			/**
+			 * \brief How far past the highest index in use Acquire() may claim an index
+			*/
+		static constexpr Uint32 MaxAcquireGrowth = 1u << 20;
+
 			/**
 			 * \brief Generates a unique identifier
 			 * \return The generated unique identifier
 			*/
-		static Uint16 Generate();
+		static Uint64 Generate();
+			/**
+			 * \brief Claims a specific identifier, used to restore serialised identifiers
+			 * \param[in] ident to claim
+			 * \retval true The identifier is now alive
+			 * \retval false The index is already in use or invalid, nothing was claimed
+			 * \note Indices more than MaxAcquireGrowth past the highest index in use are invalid,
+			 * so a corrupt identifier can not grow the tables without bound
+			*/
+		static bool Acquire(Uint64 ident);
+			/**
+			 * \brief Returns an identifier so its index may be reused
+			 * \param[in] ident to release
+			 * \note Releasing an identifier that is not alive does nothing
+			*/
+		static void Release(Uint64 ident);
+			/**
+			 * \brief Returns whether an identifier has been generated and not released
+			 * \param[in] ident to check
+			 * \return True if the identifier is alive
+			*/
+		static bool IsAlive(Uint64 ident);
+
+			/**
+			 * \brief Returns the index of an identifier
+			 * \param[in] ident to decompose
+			 * \return Index of the identifier
+			*/
+		static constexpr Uint32 GetIndex(Uint64 ident) { return static_cast<Uint32>(ident & 0xFFFFFFFFull); }
+			/**
+			 * \brief Returns the generation of an identifier
+			 * \param[in] ident to decompose
+			 * \return Generation of the identifier
+			*/
+		static constexpr Uint32 GetGeneration(Uint64 ident) { return static_cast<Uint32>(ident >> 32); }
+			/**
+			 * \brief Composes an identifier
+			 * \param[in] index of the identifier
+			 * \param[in] generation of the identifier
+			 * \return The identifier
+			*/
+		static constexpr Uint64 Make(Uint32 index, Uint32 generation) { return (static_cast<Uint64>(generation) << 32) | index; }
 
 	private:
 			/**
-			 * \brief The next identifier to be generated
+			 * \brief Current generation of each index
+			*/
+		static std::vector<Uint32> s_generations;
+			/**
+			 * \brief Whether each index is currently in use
+			*/
+		static std::vector<bool> s_alive;
+			/**
+			 * \brief Released indices available for reuse
+			*/
+		static std::vector<Uint32> s_freeList;
+			/**
+			 * \brief Position of each index in the free list, or NotFree
+			*/
+		static std::vector<Uint32> s_freePositions;
+		static constexpr Uint32 NotFree = UINT32_MAX;
+
+			/**
+			 * \brief Adds an index to the free list
+			*/
+		static void PushFree(Uint32 index);
+			/**
+			 * \brief Removes an index from the free list, if it is in it
 			*/
-		static Uint16 s_next;
+		static void RemoveFree(Uint32 index);
 	};
 }
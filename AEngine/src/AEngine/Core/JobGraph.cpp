@@ -0,0 +1,92 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#include "JobGraph.h"
+#include "AEngine/Core/Logger.h"
+#include <chrono>
+
+namespace AEngine
+{
+	JobGraph::Stage JobGraph::Add(const std::string& name, JobSystem::Task task)
+	{
+		UniquePtr<Node> node = MakeUnique<Node>();
+		node->name = name;
+		node->task = std::move(task);
+		m_nodes.push_back(std::move(node));
+		return m_nodes.size() - 1;
+	}
+
+	void JobGraph::Precede(Stage before, Stage after)
+	{
+		if (before >= after || after >= m_nodes.size())
+		{
+			AE_LOG_ERROR("JobGraph::Precede::Error -> Stage {} must be added before stage {}", before, after);
+			return;
+		}
+
+		m_nodes[before]->successors.push_back(after);
+		++m_nodes[after]->dependencies;
+	}
+
+	void JobGraph::Run()
+	{
+		for (UniquePtr<Node>& node : m_nodes)
+		{
+			node->remaining.store(node->dependencies, std::memory_order_relaxed);
+		}
+
+		// stages are forked as their last dependency finishes, so the counter is only done at the end
+		JobCounter counter;
+		for (Stage stage = 0; stage < m_nodes.size(); ++stage)
+		{
+			if (m_nodes[stage]->dependencies == 0)
+			{
+				Launch(stage, counter);
+			}
+		}
+
+		JobSystem::Instance().Wait(counter);
+	}
+
+	void JobGraph::Clear()
+	{
+		m_nodes.clear();
+	}
+
+	bool JobGraph::IsEmpty() const
+	{
+		return m_nodes.empty();
+	}
+
+	std::vector<JobGraph::Timing> JobGraph::GetTimings() const
+	{
+		std::vector<Timing> timings;
+		timings.reserve(m_nodes.size());
+		for (const UniquePtr<Node>& node : m_nodes)
+		{
+			timings.push_back({ &node->name, node->seconds });
+		}
+
+		return timings;
+	}
+
+	void JobGraph::Launch(Stage stage, JobCounter& counter)
+	{
+		JobSystem::Instance().Run([this, stage, &counter]() {
+			Node& node = *m_nodes[stage];
+			const auto start = std::chrono::steady_clock::now();
+			node.task();
+			node.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+			// forked before this stage finishes, so the counter cannot reach zero in between
+			for (Stage successor : node.successors)
+			{
+				if (m_nodes[successor]->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				{
+					Launch(successor, counter);
+				}
+			}
+		}, counter);
+	}
+}
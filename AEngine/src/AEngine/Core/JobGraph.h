@@ -0,0 +1,94 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#pragma once
+#include "AEngine/Core/Types.h"
+#include "JobSystem.h"
+#include <atomic>
+#include <string>
+#include <vector>
+
+namespace AEngine
+{
+		/**
+		 * \class JobGraph
+		 * \brief Stages of work run on the JobSystem as soon as the stages they depend on finish
+		 * \details
+		 * A stage may only depend on stages added before it, so a graph can never contain a cycle.
+		 * Graphs are built once and run every frame, and time each stage as it runs.
+		*/
+	class JobGraph
+	{
+	public:
+			/**
+			 * \brief Handle to a stage of the graph
+			*/
+		using Stage = Size_t;
+
+			/**
+			 * \struct Timing
+			 * \brief How long a stage took when the graph last ran
+			*/
+		struct Timing
+		{
+			const std::string* name;
+			double seconds;
+		};
+
+	public:
+		JobGraph() = default;
+		JobGraph(const JobGraph&) = delete;
+		void operator=(const JobGraph&) = delete;
+
+			/**
+			 * \brief Adds a stage
+			 * \param[in] name of the stage, shown in timings
+			 * \param[in] task to run, may fork work of its own
+			 * \return Stage handle
+			*/
+		Stage Add(const std::string& name, JobSystem::Task task);
+			/**
+			 * \brief Makes a stage wait for another to finish
+			 * \param[in] before stage that must finish first
+			 * \param[in] after stage that waits, must have been added after before
+			*/
+		void Precede(Stage before, Stage after);
+			/**
+			 * \brief Runs every stage, blocking until all have finished
+			 * \note Stages without dependencies between them may run at the same time
+			*/
+		void Run();
+			/**
+			 * \brief Removes every stage
+			*/
+		void Clear();
+			/**
+			 * \brief Whether the graph has no stages
+			*/
+		bool IsEmpty() const;
+			/**
+			 * \brief Gets how long each stage took when the graph last ran
+			 * \return Timings in the order the stages were added
+			*/
+		std::vector<Timing> GetTimings() const;
+
+	private:
+		struct Node
+		{
+			std::string name;
+			JobSystem::Task task;
+			std::vector<Stage> successors;
+			Size_t dependencies{ 0 };
+			std::atomic<Size_t> remaining{ 0 };   // dependencies yet to finish this run
+			double seconds{ 0.0 };
+		};
+
+			/**
+			 * \brief Forks a stage whose dependencies have all finished
+			*/
+		void Launch(Stage stage, JobCounter& counter);
+
+		std::vector<UniquePtr<Node>> m_nodes;
+	};
+}
@@ -0,0 +1,314 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#include "JobSystem.h"
+#include "AEngine/Core/Logger.h"
+#include <algorithm>
+#include <chrono>
+
+namespace
+{
+		// index of the calling thread's queue, zero for threads outside the pool
+	thread_local AEngine::Size_t t_aeJobThread = 0;
+
+		// chunks per thread in a ParallelFor, so idle threads can steal the rest of uneven work
+	constexpr AEngine::Size_t g_aeChunksPerThread = 4;
+
+	AEngine::Uint64 Now()
+	{
+		using namespace std::chrono;
+		return static_cast<AEngine::Uint64>(duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count());
+	}
+}
+
+namespace AEngine
+{
+	bool JobCounter::IsDone() const
+	{
+		return m_pending.load(std::memory_order_acquire) == 0;
+	}
+
+	double JobSystem::Stats::GetUtilisation(Size_t thread) const
+	{
+		return seconds > 0.0 ? threads[thread].busySeconds / seconds : 0.0;
+	}
+
+	JobSystem& JobSystem::Instance()
+	{
+		static JobSystem instance;
+		return instance;
+	}
+
+	JobSystem::JobSystem()
+		: m_scratchBytes{ DefaultScratchBytes }, m_queued{ 0 }, m_stopping{ false }, m_statsStart{ Now() }
+	{
+		m_queues.push_back(MakeUnique<Queue>());
+		m_counters.push_back(MakeUnique<Counters>());
+	}
+
+	JobSystem::~JobSystem()
+	{
+		Shutdown();
+	}
+
+	void JobSystem::Initialise(unsigned int workers, Size_t scratchBytes)
+	{
+		if (!m_workers.empty())
+		{
+			AE_LOG_WARN("JobSystem::Initialise::Warning -> Already initialised");
+			return;
+		}
+
+		AE_LOG_INFO("JobSystem::Initialise -> {} workers", workers);
+		m_scratchBytes = scratchBytes;
+		m_stopping = false;
+		for (unsigned int i = 0; i < workers; ++i)
+		{
+			m_queues.push_back(MakeUnique<Queue>());
+			m_counters.push_back(MakeUnique<Counters>());
+		}
+
+		m_workers.reserve(workers);
+		for (unsigned int i = 0; i < workers; ++i)
+		{
+			m_workers.emplace_back(&JobSystem::WorkerLoop, this, i + 1);
+		}
+
+		ResetStats();
+	}
+
+	void JobSystem::Shutdown()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_sleepMutex);
+			m_stopping = true;
+		}
+
+		m_wake.notify_all();
+		for (std::thread& worker : m_workers)
+		{
+			worker.join();
+		}
+
+		m_workers.clear();
+		m_queues.resize(1);
+		m_counters.resize(1);
+	}
+
+	void JobSystem::Run(Task task, JobCounter& counter)
+	{
+		counter.m_pending.fetch_add(1, std::memory_order_relaxed);
+		Push({ std::move(task), nullptr, 0, 0, &counter });
+	}
+
+	void JobSystem::Wait(JobCounter& counter)
+	{
+		const Size_t index = GetThreadIndex();
+		while (!counter.IsDone())
+		{
+			if (!RunOne(index))
+			{
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	void JobSystem::ParallelFor(Size_t count, Size_t grain, const RangeJob& job)
+	{
+		grain = std::max<Size_t>(grain, 1);
+		if (m_workers.empty() || count <= grain)
+		{
+			if (count > 0)
+			{
+				job(0, count);
+			}
+
+			return;
+		}
+
+		const Size_t chunks = (m_workers.size() + 1) * g_aeChunksPerThread;
+		const Size_t chunk = std::max(grain, (count + chunks - 1) / chunks);
+
+		// fork every chunk but the first, which the calling thread runs straight away
+		JobCounter counter;
+		for (Size_t begin = chunk; begin < count; begin += chunk)
+		{
+			counter.m_pending.fetch_add(1, std::memory_order_relaxed);
+			Push({ {}, &job, begin, std::min(begin + chunk, count), &counter });
+		}
+
+		job(0, std::min(chunk, count));
+		Wait(counter);
+	}
+
+	ScratchArena& JobSystem::GetScratch()
+	{
+		thread_local ScratchArena scratch;
+		if (scratch.GetCapacity() == 0)
+		{
+			scratch.Reserve(m_scratchBytes);
+		}
+
+		return scratch;
+	}
+
+	Size_t JobSystem::GetWorkerCount() const
+	{
+		return m_workers.size();
+	}
+
+	unsigned int JobSystem::GetDefaultWorkerCount()
+	{
+		const unsigned int threads = std::thread::hardware_concurrency();
+		return threads > 1 ? threads - 1 : 0;
+	}
+
+	JobSystem::Stats JobSystem::GetStats() const
+	{
+		Stats stats;
+		stats.seconds = static_cast<double>(Now() - m_statsStart.load()) * 1e-9;
+		for (const UniquePtr<Counters>& counters : m_counters)
+		{
+			ThreadStats thread;
+			thread.jobs = counters->jobs.load(std::memory_order_relaxed);
+			thread.stolen = counters->stolen.load(std::memory_order_relaxed);
+			thread.failedSteals = counters->failedSteals.load(std::memory_order_relaxed);
+			thread.busySeconds = static_cast<double>(counters->busyNanoseconds.load(std::memory_order_relaxed)) * 1e-9;
+			stats.threads.push_back(thread);
+		}
+
+		return stats;
+	}
+
+	void JobSystem::ResetStats()
+	{
+		for (UniquePtr<Counters>& counters : m_counters)
+		{
+			counters->jobs = 0;
+			counters->stolen = 0;
+			counters->failedSteals = 0;
+			counters->busyNanoseconds = 0;
+		}
+
+		m_statsStart = Now();
+	}
+
+	void JobSystem::LogReport() const
+	{
+		const Stats stats = GetStats();
+		AE_LOG_INFO("JobSystem::Report -> {} threads over {:.3f}s", stats.threads.size(), stats.seconds);
+		for (Size_t i = 0; i < stats.threads.size(); ++i)
+		{
+			const ThreadStats& thread = stats.threads[i];
+			AE_LOG_INFO("JobSystem::Report -> Thread {}: {} jobs, {} stolen, {} contended steals, {:.1f}% busy",
+				i, thread.jobs, thread.stolen, thread.failedSteals, stats.GetUtilisation(i) * 100.0);
+		}
+	}
+
+	void JobSystem::WorkerLoop(Size_t index)
+	{
+		t_aeJobThread = index;
+		while (true)
+		{
+			if (RunOne(index))
+			{
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(m_sleepMutex);
+			m_wake.wait(lock, [this]() { return m_stopping || m_queued > 0; });
+			if (m_stopping)
+			{
+				return;
+			}
+		}
+	}
+
+	void JobSystem::Push(Job job)
+	{
+		// counted before it is queued, so a thief can never take it before it is counted
+		++m_queued;
+		Queue& queue = *m_queues[GetThreadIndex()];
+		{
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			queue.jobs.push_back(std::move(job));
+		}
+
+		// taking the lock orders the count before a sleeping worker checks it
+		{
+			std::lock_guard<std::mutex> lock(m_sleepMutex);
+		}
+		m_wake.notify_one();
+	}
+
+	bool JobSystem::RunOne(Size_t index)
+	{
+		Job job;
+		bool found = false;
+		{
+			// newest first from our own queue, its data is most likely still in cache
+			Queue& own = *m_queues[index];
+			std::lock_guard<std::mutex> lock(own.mutex);
+			if (!own.jobs.empty())
+			{
+				job = std::move(own.jobs.back());
+				own.jobs.pop_back();
+				found = true;
+			}
+		}
+
+		// oldest first from everyone else, usually the largest piece of their work
+		Counters& counters = *m_counters[index];
+		for (Size_t i = 1; !found && i < m_queues.size(); ++i)
+		{
+			Queue& victim = *m_queues[(index + i) % m_queues.size()];
+			std::unique_lock<std::mutex> lock(victim.mutex, std::try_to_lock);
+			if (!lock.owns_lock())
+			{
+				counters.failedSteals.fetch_add(1, std::memory_order_relaxed);
+				continue;
+			}
+
+			if (!victim.jobs.empty())
+			{
+				job = std::move(victim.jobs.front());
+				victim.jobs.pop_front();
+				counters.stolen.fetch_add(1, std::memory_order_relaxed);
+				found = true;
+			}
+		}
+
+		if (!found)
+		{
+			return false;
+		}
+
+		--m_queued;
+		Execute(job, index);
+		return true;
+	}
+
+	void JobSystem::Execute(Job& job, Size_t index)
+	{
+		const Uint64 start = Now();
+		if (job.range)
+		{
+			(*job.range)(job.begin, job.end);
+		}
+		else
+		{
+			job.task();
+		}
+
+		Counters& counters = *m_counters[index];
+		counters.busyNanoseconds.fetch_add(Now() - start, std::memory_order_relaxed);
+		counters.jobs.fetch_add(1, std::memory_order_relaxed);
+		job.counter->m_pending.fetch_sub(1, std::memory_order_release);
+	}
+
+	Size_t JobSystem::GetThreadIndex() const
+	{
+		return t_aeJobThread;
+	}
+}
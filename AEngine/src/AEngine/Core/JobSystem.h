@@ -0,0 +1,257 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#pragma once
+#include "AEngine/Core/Types.h"
+#include "ScratchArena.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace AEngine
+{
+		/**
+		 * \class JobCounter
+		 * \brief Counts the unfinished jobs forked against it
+		 * \details Pass to JobSystem::Run() to fork jobs and to JobSystem::Wait() to join them.
+		*/
+	class JobCounter
+	{
+	public:
+		JobCounter() = default;
+		JobCounter(const JobCounter&) = delete;
+		void operator=(const JobCounter&) = delete;
+
+			/**
+			 * \brief Whether every job forked against the counter has finished
+			*/
+		bool IsDone() const;
+
+	private:
+		friend class JobSystem;
+		std::atomic<Size_t> m_pending{ 0 };
+	};
+
+		/**
+		 * \class JobSystem
+		 * \brief Work stealing scheduler for engine work
+		 * \details
+		 * Every worker owns a queue of jobs. A thread pushes the jobs it forks onto its own queue
+		 * and takes the most recent back off it, while idle threads steal the oldest jobs from
+		 * the others. Threads outside the pool share one queue. A thread waiting on a counter
+		 * runs queued jobs until the counter is done, so jobs may fork and wait themselves.
+		 *
+		 * Each thread also owns a ScratchArena for memory that lives no longer than a job.
+		 * \note Until Initialise() is called there are no workers, and jobs run on the waiting thread.
+		*/
+	class JobSystem
+	{
+	public:
+			/**
+			 * \brief Work forked with Run()
+			*/
+		using Task = std::function<void()>;
+			/**
+			 * \brief Work over the range [begin, end)
+			*/
+		using RangeJob = std::function<void(Size_t begin, Size_t end)>;
+
+			/**
+			 * \struct ThreadStats
+			 * \brief Work done by one thread since the stats were last reset
+			*/
+		struct ThreadStats
+		{
+			Uint64 jobs{ 0 };           ///< Jobs run
+			Uint64 stolen{ 0 };         ///< Jobs taken from another thread's queue
+			Uint64 failedSteals{ 0 };   ///< Queues found locked by another thread while looking for work
+			double busySeconds{ 0.0 };  ///< Time spent running jobs
+		};
+
+			/**
+			 * \struct Stats
+			 * \brief Contention and utilisation of the job system
+			 * \note The first thread is every thread outside the pool, such as the main thread
+			*/
+		struct Stats
+		{
+			std::vector<ThreadStats> threads;
+			double seconds{ 0.0 };      ///< Time since the stats were last reset
+
+				/**
+				 * \brief Returns the fraction of the time a thread spent running jobs
+				*/
+			double GetUtilisation(Size_t thread) const;
+		};
+
+			/**
+			 * \brief Default size of each thread's scratch arena
+			*/
+		static constexpr Size_t DefaultScratchBytes = 1024 * 1024;
+
+		static JobSystem& Instance();
+		~JobSystem();
+
+		JobSystem(const JobSystem&) = delete;
+		void operator=(const JobSystem&) = delete;
+
+			/**
+			 * \brief Starts the worker threads
+			 * \param[in] workers number of threads besides the calling thread
+			 * \param[in] scratchBytes size of each thread's scratch arena
+			*/
+		void Initialise(unsigned int workers, Size_t scratchBytes = DefaultScratchBytes);
+			/**
+			 * \brief Joins the worker threads
+			 * \note Must not be called while work is running
+			*/
+		void Shutdown();
+
+			/**
+			 * \brief Forks a job
+			 * \param[in] task to run
+			 * \param[in,out] counter to join the job with
+			*/
+		void Run(Task task, JobCounter& counter);
+			/**
+			 * \brief Joins every job forked against a counter, running queued jobs until they finish
+			 * \param[in] counter to wait on
+			*/
+		void Wait(JobCounter& counter);
+			/**
+			 * \brief Runs a job over [0, count) in chunks, blocking until every chunk has finished
+			 * \param[in] count number of items
+			 * \param[in] grain least number of items per chunk, larger grains suit cheap items
+			 * \param[in] job to run on each chunk, must be safe to call from several threads at once
+			 * \note May be called from inside a job
+			*/
+		void ParallelFor(Size_t count, Size_t grain, const RangeJob& job);
+			/**
+			 * \brief Runs a function on every element of a range, such as the entities of an EnTT view
+			 * \param[in] range to iterate, gathered into scratch memory before the work is split, or the heap if it does not fit
+			 * \param[in] grain least number of elements per chunk
+			 * \param[in] func called with each element, must be safe to call from several threads at once
+			 * \note The range must not change until ParallelForEach returns
+			*/
+		template <typename Range, typename Func>
+		void ParallelForEach(const Range& range, Size_t grain, const Func& func);
+
+			/**
+			 * \brief Gets the scratch arena of the calling thread
+			 * \note Release what is allocated before the job returns, ScratchScope does so
+			*/
+		ScratchArena& GetScratch();
+			/**
+			 * \brief Gets the number of worker threads
+			*/
+		Size_t GetWorkerCount() const;
+			/**
+			 * \brief Gets the number of workers to start so every hardware thread is used once
+			*/
+		static unsigned int GetDefaultWorkerCount();
+
+			/**
+			 * \brief Gets the work done by each thread since the stats were last reset
+			*/
+		Stats GetStats() const;
+			/**
+			 * \brief Restarts the stats
+			*/
+		void ResetStats();
+			/**
+			 * \brief Logs the jobs, steals and utilisation of each thread
+			*/
+		void LogReport() const;
+
+	private:
+		struct Job
+		{
+			Task task;                // forked with Run(), empty for a chunk of a range
+			const RangeJob* range;    // set for a chunk of ParallelFor()
+			Size_t begin;
+			Size_t end;
+			JobCounter* counter;
+		};
+
+		struct Queue
+		{
+			std::mutex mutex;
+			std::deque<Job> jobs;
+		};
+
+		struct Counters
+		{
+			std::atomic<Uint64> jobs{ 0 };
+			std::atomic<Uint64> stolen{ 0 };
+			std::atomic<Uint64> failedSteals{ 0 };
+			std::atomic<Uint64> busyNanoseconds{ 0 };
+		};
+
+		JobSystem();
+		void WorkerLoop(Size_t index);
+		void Push(Job job);
+			/**
+			 * \brief Runs one queued job, preferring the thread's own queue
+			 * \return false if every queue was empty
+			*/
+		bool RunOne(Size_t index);
+		void Execute(Job& job, Size_t index);
+		Size_t GetThreadIndex() const;
+
+		// queue 0 belongs to the threads outside the pool, then one per worker
+		std::vector<UniquePtr<Queue>> m_queues;
+		std::vector<UniquePtr<Counters>> m_counters;
+		std::vector<std::thread> m_workers;
+		Size_t m_scratchBytes;
+
+		std::mutex m_sleepMutex;
+		std::condition_variable m_wake;
+		std::atomic<Size_t> m_queued;
+		std::atomic<bool> m_stopping;
+		std::atomic<Uint64> m_statsStart;
+	};
+
+	template <typename Range, typename Func>
+	void JobSystem::ParallelForEach(const Range& range, Size_t grain, const Func& func)
+	{
+		// views cannot be split by index, so copy their elements somewhere that can
+		using Element = std::decay_t<decltype(*std::begin(range))>;
+		ScratchArena& scratch = GetScratch();
+		ScratchScope scope(scratch);
+
+		const Size_t count = static_cast<Size_t>(std::distance(std::begin(range), std::end(range)));
+		std::vector<Element> overflow;
+		Element* elements = nullptr;
+		if (scratch.CanAllocate(count * sizeof(Element), alignof(Element)))
+		{
+			elements = scratch.Allocate<Element>(count);
+			Size_t gathered = 0;
+			for (auto it = std::begin(range); it != std::end(range); ++it)
+			{
+				new (&elements[gathered++]) Element(*it);
+			}
+		}
+		else
+		{
+			// too large for the arena, pay for one heap allocation rather than failing
+			overflow.reserve(count);
+			overflow.insert(overflow.end(), std::begin(range), std::end(range));
+			elements = overflow.data();
+		}
+
+		ParallelFor(count, grain, [elements, &func](Size_t begin, Size_t end) {
+			for (Size_t i = begin; i < end; ++i)
+			{
+				func(elements[i]);
+			}
+		});
+	}
+}
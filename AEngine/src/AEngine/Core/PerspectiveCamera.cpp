@@ -35,6 +35,11 @@ namespace AEngine
 		return m_projection * m_view;
 	}
 
+	Math::Frustum PerspectiveCamera::GetFrustum() const
+	{
+		return Math::Frustum(GetProjectionViewMatrix());
+	}
+
 	//--------------------------------------------------------------------------------
 	// Projection Matrix Components
 	//--------------------------------------------------------------------------------
@@ -3,6 +3,7 @@
  * \author Christien Alden (34119981)
 */
 #pragma once
+#include "AEngine/Math/Bounds.h"
 #include "AEngine/Math/Math.h"
 
 namespace AEngine
@@ -96,6 +97,11 @@ namespace AEngine
 			 * PVM = P * V
 			*/
 		const Math::mat4 GetProjectionViewMatrix() const;
+			/**
+			 * \brief Returns the world space frustum of the camera
+			 * \return The frustum built from the projection view matrix
+			*/
+		Math::Frustum GetFrustum() const;
 
 	protected:
 		Math::mat4 m_projection;
@@ -0,0 +1,86 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#include "ScratchArena.h"
+#include "AEngine/Core/Logger.h"
+#include <algorithm>
+
+namespace AEngine
+{
+	ScratchArena::ScratchArena(Size_t capacity)
+		: m_capacity{ 0 }, m_offset{ 0 }, m_peak{ 0 }
+	{
+		Reserve(capacity);
+	}
+
+	void ScratchArena::Reserve(Size_t capacity)
+	{
+		if (m_offset != 0)
+		{
+			AE_LOG_ERROR("ScratchArena::Reserve::Error -> Memory is still allocated");
+			return;
+		}
+
+		m_buffer = capacity > 0 ? MakeUnique<Uint8[]>(capacity) : nullptr;
+		m_capacity = capacity;
+		m_peak = 0;
+	}
+
+	void* ScratchArena::Allocate(Size_t bytes, Size_t alignment)
+	{
+		const Size_t begin = GetAlignedOffset(alignment);
+		if (begin + bytes > m_capacity)
+		{
+			AE_LOG_FATAL("ScratchArena::Allocate::Out of memory -> {} of {} bytes used, {} requested", m_offset, m_capacity, bytes);
+		}
+
+		m_offset = begin + bytes;
+		m_peak = std::max(m_peak, m_offset);
+		return m_buffer.get() + begin;
+	}
+
+	bool ScratchArena::CanAllocate(Size_t bytes, Size_t alignment) const
+	{
+		const Size_t begin = GetAlignedOffset(alignment);
+		return begin <= m_capacity && bytes <= m_capacity - begin;
+	}
+
+	Size_t ScratchArena::GetMarker() const
+	{
+		return m_offset;
+	}
+
+	void ScratchArena::Release(Size_t marker)
+	{
+		m_offset = std::min(marker, m_offset);
+	}
+
+	Size_t ScratchArena::GetCapacity() const
+	{
+		return m_capacity;
+	}
+
+	Size_t ScratchArena::GetPeak() const
+	{
+		return m_peak;
+	}
+
+	Size_t ScratchArena::GetAlignedOffset(Size_t alignment) const
+	{
+		const Intptr_t base = reinterpret_cast<Intptr_t>(m_buffer.get());
+		const Intptr_t mask = static_cast<Intptr_t>(alignment) - 1;
+		return static_cast<Size_t>(((base + static_cast<Intptr_t>(m_offset) + mask) & ~mask) - base);
+	}
+
+	ScratchScope::ScratchScope(ScratchArena& arena)
+		: m_arena{ arena }, m_marker{ arena.GetMarker() }
+	{
+
+	}
+
+	ScratchScope::~ScratchScope()
+	{
+		m_arena.Release(m_marker);
+	}
+}
@@ -0,0 +1,105 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#pragma once
+#include "AEngine/Core/Types.h"
+#include <cstddef>
+#include <type_traits>
+
+namespace AEngine
+{
+		/**
+		 * \class ScratchArena
+		 * \brief Linear allocator for short lived memory
+		 * \details
+		 * Allocations bump an offset into one fixed block and are freed together by releasing
+		 * back to a marker, so temporary arrays cost no heap allocation. Each thread of the
+		 * JobSystem owns an arena, see JobSystem::GetScratch().
+		 * \note Only trivially destructible types may live in an arena, nothing is destroyed
+		*/
+	class ScratchArena
+	{
+	public:
+			/**
+			 * \param[in] capacity of the arena in bytes
+			*/
+		explicit ScratchArena(Size_t capacity = 0);
+			/**
+			 * \brief Replaces the block of the arena
+			 * \param[in] capacity of the arena in bytes
+			 * \note Must not be called while memory is allocated
+			*/
+		void Reserve(Size_t capacity);
+			/**
+			 * \brief Allocates uninitialised memory
+			 * \param[in] bytes to allocate
+			 * \param[in] alignment of the memory, a power of two
+			 * \return Pointer to the memory, valid until released
+			 * \note Running out of memory is fatal, check CanAllocate() when the size is not bounded
+			*/
+		void* Allocate(Size_t bytes, Size_t alignment = alignof(std::max_align_t));
+			/**
+			 * \brief Checks whether an allocation fits in what is left of the arena
+			 * \param[in] bytes to allocate
+			 * \param[in] alignment of the memory, a power of two
+			 * \retval true if Allocate() would succeed
+			*/
+		bool CanAllocate(Size_t bytes, Size_t alignment = alignof(std::max_align_t)) const;
+			/**
+			 * \brief Allocates an uninitialised array
+			 * \param[in] count number of elements
+			 * \return Pointer to the first element
+			*/
+		template <typename T>
+		T* Allocate(Size_t count)
+		{
+			static_assert(std::is_trivially_destructible_v<T>, "ScratchArena never destroys what it holds");
+			return static_cast<T*>(Allocate(count * sizeof(T), alignof(T)));
+		}
+			/**
+			 * \brief Gets a marker to release back to
+			 * \return Marker of the current offset
+			*/
+		Size_t GetMarker() const;
+			/**
+			 * \brief Frees everything allocated since a marker was taken
+			 * \param[in] marker returned by GetMarker()
+			*/
+		void Release(Size_t marker);
+			/**
+			 * \brief Gets the capacity of the arena in bytes
+			*/
+		Size_t GetCapacity() const;
+			/**
+			 * \brief Gets the most bytes the arena has held at once
+			*/
+		Size_t GetPeak() const;
+
+	private:
+		Size_t GetAlignedOffset(Size_t alignment) const;
+
+		UniquePtr<Uint8[]> m_buffer;
+		Size_t m_capacity;
+		Size_t m_offset;
+		Size_t m_peak;
+	};
+
+		/**
+		 * \class ScratchScope
+		 * \brief Releases everything allocated from an arena during its lifetime
+		*/
+	class ScratchScope
+	{
+	public:
+		explicit ScratchScope(ScratchArena& arena);
+		~ScratchScope();
+
+		ScratchScope(const ScratchScope&) = delete;
+		void operator=(const ScratchScope&) = delete;
+
+	private:
+		ScratchArena& m_arena;
+		Size_t m_marker;
+	};
+}
@@ -7,6 +7,8 @@
 #include "AEngine/Core/Types.h"
 #include "AEngine/Resource/AssetManager.h"
 #include "AEngine/Core/Application.h"
+#include "AEngine/Core/Identifier.h"
+#include "AEngine/Core/JobSystem.h"
 #include "AEngine/Events/EventHandler.h"
 #include "AEngine/Events/KeyEvent.h"
 #include "AEngine/Events/MouseEvent.h"
@@ -19,9 +21,14 @@
 #include "AEngine/Physics/Collider.h"
 #include "AEngine/Physics/CollisionBody.h"
 #include "AEngine/Physics/PlayerController.h"
+#include "AEngine/Script/ScriptEngine.h"
+#include "AEngine/Script/ScriptState.h"
 
+#include <algorithm>
 #include <iostream>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace AEngine
 {
@@ -223,7 +230,16 @@ namespace AEngine
 
 		// get the transform for the selected entity
 		TransformComponent* tc = m_selectedEntity.GetComponent<TransformComponent>();
-		Math::mat4 transform = tc->ToMat4();
+
+		// the guizmo works in world space, children are moved back into their parent's space
+		Math::mat4 parentTransform{ 1.0f };
+		Entity parent = m_selectedEntity.GetParent();
+		if (parent.IsValid())
+		{
+			parentTransform = parent.GetComponent<WorldTransformComponent>()->matrix;
+		}
+
+		Math::mat4 transform = parentTransform * tc->ToMat4();
 
 
 		// get the snap value
@@ -256,9 +272,10 @@ namespace AEngine
 
 		if (ImGuizmo::IsUsing())
 		{
+			Math::mat4 local = Math::inverse(parentTransform) * transform;
 			Math::vec3 translation, rotation, scale;
 			ImGuizmo::DecomposeMatrixToComponents(
-				Math::value_ptr(transform),
+				Math::value_ptr(local),
 				Math::value_ptr(translation),
 				Math::value_ptr(rotation),
 				Math::value_ptr(scale)
@@ -480,6 +497,12 @@ namespace AEngine
 					ImGui::EndTabItem();
 				}
 
+				if (ImGui::BeginTabItem("Profiling"))
+				{
+					ProfilingPanel();
+					ImGui::EndTabItem();
+				}
+
 				if (ImGui::BeginTabItem("Debug Camera"))
 				{
 					ShowDebugCameraConfig();
@@ -518,7 +541,7 @@ namespace AEngine
 
 	void Editor::ShowHierarchy()
 	{
-		std::vector<Uint16> entityIds;
+		std::vector<Uint64> entityIds;
 		m_scene->GetEntityIds(entityIds);
 
 		ImGui::Begin(std::string("Hierarchy (Scene : " + m_scene->GetIdent() + ")").c_str());
@@ -758,7 +781,7 @@ namespace AEngine
 		if(tc != nullptr)
 		{
 			ImGui::Text("Name: %s", tc->tag.c_str());
-			ImGui::Text("ID: %d", tc->ident);
+			ImGui::Text("ID: %u (generation %u)", Identifier::GetIndex(tc->ident), Identifier::GetGeneration(tc->ident));
 		}
 	}
 
@@ -1785,6 +1808,82 @@ namespace AEngine
 		ImGui::Separator();
 	}
 
+	void Editor::ProfilingPanel()
+	{
+		const RenderQueue::Stats renderStats = m_scene->GetRenderStats();
+		ImGui::SeparatorText("Render Queue");
+		ImGui::Text("Meshes Submitted: %u", renderStats.submissions);
+		ImGui::Text("Draw Calls: %u", renderStats.drawCalls);
+		ImGui::Text("State Changes: %u", renderStats.GetStateChanges());
+		ImGui::Text("  Shader: %u", renderStats.shaderBinds);
+		ImGui::Text("  Material: %u", renderStats.materialBinds);
+		ImGui::Text("  Vertex Array: %u", renderStats.vertexArrayBinds);
+
+		const Scene::CullingStats& cullingStats = m_scene->GetCullingStats();
+		ImGui::SeparatorText("Culling");
+		ImGui::Text("Visible: %u", cullingStats.visible);
+		ImGui::Text("Culled: %u", cullingStats.culled);
+
+		const AnimationScheduler::Stats& animationStats = m_scene->GetAnimationStats();
+		ImGui::SeparatorText("Animation");
+		ImGui::Text("Animators: %u", animationStats.animators);
+		ImGui::Text("Evaluated: %u", animationStats.evaluated);
+		ImGui::Text("Shared: %u", animationStats.shared);
+		ImGui::Text("Deferred: %u", animationStats.deferred);
+
+		const Scene::PhysicsSyncStats& physicsSyncStats = m_scene->GetPhysicsSyncStats();
+		ImGui::SeparatorText("Physics Sync");
+		ImGui::Text("Bodies: %u", physicsSyncStats.bodies);
+		ImGui::Text("Synced: %u", physicsSyncStats.synced);
+		ImGui::Text("Time: %.3f ms", physicsSyncStats.seconds * 1000.0);
+
+		// slowest scripts first, timings are of the last finished frame
+		std::vector<std::pair<const Script*, Script::Timing>> scriptTimings;
+		for (const auto& [ident, script] : AssetManager<Script>::Instance())
+		{
+			const Script::Timing timing = script->GetFrameTiming();
+			if (timing.calls > 0)
+			{
+				scriptTimings.emplace_back(script.get(), timing);
+			}
+		}
+
+		std::sort(scriptTimings.begin(), scriptTimings.end(), [](const auto& lhs, const auto& rhs) {
+			return lhs.second.seconds > rhs.second.seconds;
+		});
+
+		ImGui::SeparatorText("Scripts");
+		for (const auto& [script, timing] : scriptTimings)
+		{
+			ImGui::Text("%s: %.3f ms, %u calls", script->GetIdent().c_str(), timing.seconds * 1000.0, timing.calls);
+		}
+
+		const ScriptState::GCStats& gcStats = ScriptEngine::GetState().GetGCStats();
+		ImGui::SeparatorText("Lua GC");
+		ImGui::Text("Heap: %.2f MB", static_cast<double>(gcStats.heapBytes) / (1024.0 * 1024.0));
+		ImGui::Text("Time: %.3f ms, %u steps", gcStats.seconds * 1000.0, gcStats.steps);
+		ImGui::Text("Cycles: %u", gcStats.cycles);
+
+		const JobSystem::Stats jobStats = JobSystem::Instance().GetStats();
+		ImGui::SeparatorText("Jobs");
+		for (Size_t i = 0; i < jobStats.threads.size(); ++i)
+		{
+			const JobSystem::ThreadStats& thread = jobStats.threads[i];
+			ImGui::Text("Thread %zu: %.1f%% busy, %llu jobs, %llu stolen, %llu contended", i, jobStats.GetUtilisation(i) * 100.0,
+				static_cast<unsigned long long>(thread.jobs), static_cast<unsigned long long>(thread.stolen), static_cast<unsigned long long>(thread.failedSteals));
+		}
+
+		for (const JobGraph::Timing& timing : m_scene->GetFrameJobTimings())
+		{
+			ImGui::Text("%s: %.3f ms", timing.name->c_str(), timing.seconds * 1000.0);
+		}
+
+		if (ImGui::Button("Reset Job Stats"))
+		{
+			JobSystem::Instance().ResetStats();
+		}
+	}
+
 	void Editor::HelpMarker(const char *label)
 	{
 		// from ImGui::Demo
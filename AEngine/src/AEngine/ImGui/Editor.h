@@ -156,6 +156,11 @@ namespace AEngine
 // Physics
 //------------------------------------------------------------------------------
 		void PhysicsPanel();
+
+//------------------------------------------------------------------------------
+// Profiling
+//------------------------------------------------------------------------------
+		void ProfilingPanel();
 		void ColliderPanel(CollisionBody* body, Collider* collider, const char* label);
 		void CollisionBodyPanel(CollisionBody* body);
 		void RigidBodyPanel(RigidBody* body);
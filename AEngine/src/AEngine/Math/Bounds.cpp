@@ -0,0 +1,119 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#include "Bounds.h"
+
+namespace AEngine
+{
+	namespace Math
+	{
+	//--------------------------------------------------------------------------------
+	// AABB
+	//--------------------------------------------------------------------------------
+		bool AABB::IsValid() const
+		{
+			return min.x <= max.x && min.y <= max.y && min.z <= max.z;
+		}
+
+		void AABB::Expand(const vec3& point)
+		{
+			min = Math::min(min, point);
+			max = Math::max(max, point);
+		}
+
+		void AABB::Expand(const AABB& other)
+		{
+			if (!other.IsValid())
+			{
+				return;
+			}
+
+			min = Math::min(min, other.min);
+			max = Math::max(max, other.max);
+		}
+
+		vec3 AABB::GetCenter() const
+		{
+			return (min + max) * 0.5f;
+		}
+
+		vec3 AABB::GetExtents() const
+		{
+			return (max - min) * 0.5f;
+		}
+
+		AABB AABB::Transform(const mat4& transform) const
+		{
+			if (!IsValid())
+			{
+				return *this;
+			}
+
+			// transform the centre, then project the extents onto the world axes
+			const vec3 center = vec3(transform * vec4(GetCenter(), 1.0f));
+			const vec3 extents = GetExtents();
+			const mat3 basis = mat3(transform);
+
+			vec3 worldExtents{ 0.0f };
+			for (int axis = 0; axis < 3; ++axis)
+			{
+				worldExtents += Math::abs(basis[axis]) * extents[axis];
+			}
+
+			return { center - worldExtents, center + worldExtents };
+		}
+
+	//--------------------------------------------------------------------------------
+	// Frustum
+	//--------------------------------------------------------------------------------
+		Frustum::Frustum()
+		{
+			// planes that every point is in front of
+			for (vec4& plane : m_planes)
+			{
+				plane = vec4(0.0f, 0.0f, 0.0f, 1.0f);
+			}
+		}
+
+		Frustum::Frustum(const mat4& projectionView)
+		{
+			// Gribb/Hartmann: each plane is the fourth row plus or minus another row
+			const mat4 m = transpose(projectionView);
+			m_planes[Left]   = m[3] + m[0];
+			m_planes[Right]  = m[3] - m[0];
+			m_planes[Bottom] = m[3] + m[1];
+			m_planes[Top]    = m[3] - m[1];
+			m_planes[Near]   = m[3] + m[2];
+			m_planes[Far]    = m[3] - m[2];
+
+			for (vec4& plane : m_planes)
+			{
+				plane /= length(vec3(plane));
+			}
+		}
+
+		bool Frustum::Intersects(const AABB& box) const
+		{
+			const vec3 center = box.GetCenter();
+			const vec3 extents = box.GetExtents();
+			for (const vec4& plane : m_planes)
+			{
+				// distance of the centre against the projected radius of the box
+				const vec3 normal = vec3(plane);
+				const float radius = dot(extents, Math::abs(normal));
+				if (dot(normal, center) + plane.w < -radius)
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		const vec4& Frustum::GetPlane(Plane plane) const
+		{
+			return m_planes[plane];
+		}
+	}
+}
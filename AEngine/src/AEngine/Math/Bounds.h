@@ -0,0 +1,105 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+ * \brief Bounding volumes used for visibility tests
+*/
+#pragma once
+#include "Math.h"
+#include <limits>
+
+namespace AEngine
+{
+	namespace Math
+	{
+			/**
+			 * \struct AABB
+			 * \brief Axis aligned bounding box
+			 * \details
+			 * A default constructed box is empty (min > max) and becomes valid once a point is added.
+			*/
+		struct AABB
+		{
+			vec3 min{ std::numeric_limits<float>::max() };
+			vec3 max{ std::numeric_limits<float>::lowest() };
+
+				/**
+				 * \brief Returns whether the box contains at least one point
+				 * \return True if min <= max on every axis
+				*/
+			bool IsValid() const;
+				/**
+				 * \brief Grows the box to contain a point
+				 * \param[in] point to contain
+				*/
+			void Expand(const vec3& point);
+				/**
+				 * \brief Grows the box to contain another box
+				 * \param[in] other box to contain
+				 * \note Invalid boxes are ignored
+				*/
+			void Expand(const AABB& other);
+				/**
+				 * \brief Returns the centre of the box
+				 * \return Centre of the box
+				*/
+			vec3 GetCenter() const;
+				/**
+				 * \brief Returns the half size of the box on each axis
+				 * \return Half extents of the box
+				*/
+			vec3 GetExtents() const;
+				/**
+				 * \brief Returns the box that bounds this box after a transform
+				 * \param[in] transform to apply
+				 * \return Axis aligned box containing the transformed box
+				 * \note Invalid boxes are returned unchanged
+				*/
+			AABB Transform(const mat4& transform) const;
+		};
+
+			/**
+			 * \class Frustum
+			 * \brief The six clip planes of a camera
+			 * \details
+			 * Planes are extracted from the combined projection view matrix, with normals
+			 * pointing into the frustum.
+			*/
+		class Frustum
+		{
+		public:
+				/**
+				 * \enum Plane
+				 * \brief Index of each plane
+				*/
+			enum Plane
+			{
+				Left, Right, Bottom, Top, Near, Far, Count
+			};
+
+				/**
+				 * \brief Creates a frustum that contains everything
+				*/
+			Frustum();
+				/**
+				 * \param[in] projectionView combined projection and view matrix of a camera
+				*/
+			explicit Frustum(const mat4& projectionView);
+				/**
+				 * \brief Returns whether a box is at least partially inside the frustum
+				 * \param[in] box in the same space as the frustum
+				 * \return False if the box is entirely outside any plane
+				 * \note Boxes near a frustum corner may be reported as visible when they are not
+				*/
+			bool Intersects(const AABB& box) const;
+				/**
+				 * \brief Returns a plane of the frustum
+				 * \param[in] plane index of the plane
+				 * \return Plane as (normal, distance), normalised
+				*/
+			const vec4& GetPlane(Plane plane) const;
+
+		private:
+			vec4 m_planes[Count];
+		};
+	}
+}
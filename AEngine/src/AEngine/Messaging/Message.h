@@ -5,7 +5,7 @@
 */
 #pragma once
 #include "AEngine/Core/Types.h"
-#include <sol/sol.hpp>
+#include "MessageData.h"
 #include <functional>
 #include <set>
 
@@ -13,14 +13,13 @@ namespace AEngine
 {
 	struct Message;
 
-	using Agent = Uint16;
+	using Agent = Uint64;
 	using AgentSet = std::set<Agent>;
 	using AgentCategory = Uint8;
 	using AgentCategorySet = std::set<AgentCategory>;
 
 	using MessageType = Uint8;
 	using MessageTypeSet = std::set<MessageType>;
-	using MessageData = sol::table;
 	using MessageCallback = std::function<void(Message)>;
 
 		/**
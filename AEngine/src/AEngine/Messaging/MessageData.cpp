@@ -0,0 +1,44 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#include "MessageData.h"
+
+namespace AEngine
+{
+	MessageData::MessageData()
+		: m_buffer{}, m_type{ nullptr }, m_table{ nullptr }
+	{
+
+	}
+
+	MessageData::MessageData(sol::table table)
+		: m_buffer{}, m_type{ nullptr }, m_table{ nullptr }
+	{
+		// a nil table is an empty payload
+		if (table.valid())
+		{
+			m_table = MakeShared<sol::table>(std::move(table));
+		}
+	}
+
+	bool MessageData::IsTable() const
+	{
+		return m_table != nullptr;
+	}
+
+	bool MessageData::IsEmpty() const
+	{
+		return m_type == nullptr && m_table == nullptr;
+	}
+
+	sol::table MessageData::GetTable() const
+	{
+		if (m_table)
+		{
+			return *m_table;
+		}
+
+		return sol::table();
+	}
+}
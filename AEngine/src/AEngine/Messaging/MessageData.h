@@ -0,0 +1,120 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+ * \brief Payload carried by a Message.
+*/
+#pragma once
+#include "AEngine/Core/Types.h"
+#include <sol/sol.hpp>
+#include <cstring>
+#include <type_traits>
+
+namespace AEngine
+{
+		/**
+		 * \class MessageData
+		 * \brief Payload of a message, either a small native value or a Lua table.
+		 * \details
+		 * Native payloads are stored inline, so C++ systems can send messages without a Lua state,
+		 * and copying the payload into each mailbox is a memcpy. \n
+		 * Lua tables are shared between copies of the payload rather than re-referenced per copy.
+		*/
+	class MessageData
+	{
+	public:
+			/**
+			 * \brief Largest native payload in bytes
+			*/
+		static constexpr Size_t Capacity = 32;
+
+			/**
+			 * \brief Creates an empty payload
+			*/
+		MessageData();
+			/**
+			 * \brief Creates a payload holding a Lua table
+			 * \param[in] table to share with the receivers
+			 * \note Implicit so scripts and existing callers can keep passing tables
+			*/
+		MessageData(sol::table table);
+
+			/**
+			 * \brief Creates a payload holding a native value
+			 * \tparam T trivially copyable type no larger than Capacity
+			 * \param[in] value to copy into the payload
+			 * \return The payload
+			*/
+		template <typename T>
+		static MessageData Create(const T& value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "MessageData::Create -> Native payloads must be trivially copyable");
+			static_assert(sizeof(T) <= Capacity, "MessageData::Create -> Native payload exceeds MessageData::Capacity");
+			static_assert(alignof(T) <= alignof(std::max_align_t), "MessageData::Create -> Native payload is over aligned");
+
+			MessageData data;
+			data.m_type = TypeOf<T>();
+			std::memcpy(data.m_buffer, &value, sizeof(T));
+			return data;
+		}
+
+			/**
+			 * \brief Returns the native value held by the payload
+			 * \tparam T type the payload was created with
+			 * \return Pointer to the value, or nullptr if the payload does not hold a T
+			*/
+		template <typename T>
+		const T* Get() const
+		{
+			if (m_type != TypeOf<T>())
+			{
+				return nullptr;
+			}
+
+			return reinterpret_cast<const T*>(m_buffer);
+		}
+
+			/**
+			 * \brief Returns whether the payload holds a native value of type T
+			 * \tparam T type to check
+			 * \return True if the payload holds a T
+			*/
+		template <typename T>
+		bool Is() const
+		{
+			return m_type == TypeOf<T>();
+		}
+
+			/**
+			 * \brief Returns whether the payload holds a Lua table
+			 * \return True if the payload holds a Lua table
+			*/
+		bool IsTable() const;
+			/**
+			 * \brief Returns whether the payload holds nothing
+			 * \return True if the payload is empty
+			*/
+		bool IsEmpty() const;
+			/**
+			 * \brief Returns the Lua table held by the payload
+			 * \return The table, or a nil reference if the payload holds no table
+			*/
+		sol::table GetTable() const;
+
+	private:
+		using TypeTag = const void*;
+
+			/**
+			 * \brief Returns an address unique to T, used to tag native payloads
+			*/
+		template <typename T>
+		static TypeTag TypeOf()
+		{
+			static const char tag = 0;
+			return &tag;
+		}
+
+		alignas(std::max_align_t) unsigned char m_buffer[Capacity];
+		TypeTag m_type;
+		SharedPtr<sol::table> m_table;
+	};
+}
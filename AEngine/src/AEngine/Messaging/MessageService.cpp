@@ -3,7 +3,7 @@
 
 namespace AEngine
 {
-	MessageAgent MessageService::CreateAgent(Uint16 identifier)
+	MessageAgent MessageService::CreateAgent(Uint64 identifier)
 	{
 		return MessageServiceImpl::Instance().CreateAgent(identifier);
 	}
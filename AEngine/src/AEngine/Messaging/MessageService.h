@@ -21,7 +21,7 @@ namespace AEngine
 			 * \return The created MessageAgent.
 			 * \throw std::runtime_error If the identifier is already in use.
 			*/
-		static MessageAgent CreateAgent(Uint16 identifier);
+		static MessageAgent CreateAgent(Uint64 identifier);
 			/**
 			 * \brief Dispatches all queued messages.
 			*/
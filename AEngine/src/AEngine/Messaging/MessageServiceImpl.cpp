@@ -3,6 +3,7 @@
  * \author Christien Alden (34119981)
 */
 #include "MessageServiceImpl.h"
+#include <algorithm>
 #include <stdexcept>
 
 namespace AEngine
@@ -13,6 +14,12 @@ namespace AEngine
 		return instance;
 	}
 
+	MessageServiceImpl::MessageServiceImpl()
+		: m_handlerRows{ 0 }, m_arenaHead{ 0 }, m_arenaCount{ 0 }, m_dispatching{ false }
+	{
+		m_typeColumns.fill(NoColumn);
+	}
+
 //--------------------------------------------------------------------------------
 // Agent Creation and Modification
 //--------------------------------------------------------------------------------
@@ -23,7 +30,21 @@ namespace AEngine
 			throw std::runtime_error("Agent already exists");
 		}
 
-		m_agents.insert(identifier);
+		// reuse a purged slot before growing the table
+		Uint32 slot = 0;
+		if (!m_freeSlots.empty())
+		{
+			slot = m_freeSlots.back();
+			m_freeSlots.pop_back();
+			m_slots[slot] = { identifier, true };
+		}
+		else
+		{
+			slot = static_cast<Uint32>(m_slots.size());
+			m_slots.push_back({ identifier, true });
+		}
+
+		m_slotLookup[identifier] = slot;
 		return MessageAgent(identifier, *this);
 	}
 
@@ -34,12 +55,18 @@ namespace AEngine
 
 	void MessageServiceImpl::AddAgentToCategory(Agent agent, AgentCategory category)
 	{
-		if (!AgentExists(agent))
+		Uint32 slot;
+		if (!FindSlot(agent, slot))
 		{
 			return;
 		}
 
-		m_categories[category].insert(agent);
+		AgentSlot& agentSlot = m_slots[slot];
+		if (!agentSlot.categories.test(category))
+		{
+			agentSlot.categories.set(category);
+			m_categories[category].push_back(slot);
+		}
 	}
 
 	void MessageServiceImpl::AddAgentToCategory(Agent agent, AgentCategorySet categories)
@@ -52,12 +79,18 @@ namespace AEngine
 
 	void MessageServiceImpl::RemoveAgentFromCategory(Agent agent, AgentCategory category)
 	{
-		if (!AgentExists(agent))
+		Uint32 slot;
+		if (!FindSlot(agent, slot))
 		{
 			return;
 		}
 
-		m_categories[category].erase(agent);
+		AgentSlot& agentSlot = m_slots[slot];
+		if (agentSlot.categories.test(category))
+		{
+			agentSlot.categories.reset(category);
+			EraseFromCategory(category, slot);
+		}
 	}
 
 	void MessageServiceImpl::RemoveAgentFromCategory(Agent agent, AgentCategorySet categories)
@@ -75,8 +108,15 @@ namespace AEngine
 			return;
 		}
 
+		// the table must not change under a running handler
+		if (m_dispatching)
+		{
+			m_pendingHandlers.push_back({ agent, type, std::move(callback) });
+			return;
+		}
+
 		// currently overwrites any existing handler
-		m_messageHandlers[agent][type] = callback;
+		SetHandler(agent, type, std::move(callback));
 	}
 
 	void MessageServiceImpl::UnregisterMessageHandler(Agent agent, MessageType type)
@@ -86,7 +126,13 @@ namespace AEngine
 			return;
 		}
 
-		m_messageHandlers[agent].erase(type);
+		if (m_dispatching)
+		{
+			m_pendingHandlers.push_back({ agent, type, MessageCallback() });
+			return;
+		}
+
+		SetHandler(agent, type, MessageCallback());
 	}
 
 //--------------------------------------------------------------------------------
@@ -94,69 +140,91 @@ namespace AEngine
 //--------------------------------------------------------------------------------
 	void MessageServiceImpl::DispatchMessages()
 	{
-		// iterate through mailboxes
-		using Mailbox = std::pair<const Agent, std::queue<Message>>;
-		for (Mailbox &mailbox : m_mailboxes)
+		// only deliver what was queued before dispatch, replies go out next dispatch
+		const Size_t count = m_arenaCount;
+		const Size_t columns = m_columnTypes.size();
+
+		m_dispatching = true;
+		for (Size_t i = 0; i < count; ++i)
 		{
-			// get agent identifier and message queue
-			Agent current = mailbox.first;
-			MessageQueue &queue = mailbox.second;
+			// the arena may grow while a handler runs, so take the message out first
+			Envelope& envelope = m_arena[m_arenaHead];
+			const Uint32 slot = envelope.slot;
+			Message message = std::move(envelope.message);
+			m_arenaHead = (m_arenaHead + 1) % m_arena.size();
+			--m_arenaCount;
+
+			// the receiver may have been purged and its slot reused since the message was sent
+			const AgentSlot& receiver = m_slots[slot];
+			if (!receiver.alive || receiver.agent != message.receiver || slot >= m_handlerRows)
+			{
+				continue;
+			}
 
-			// iterate through messages
-			while (!queue.empty())
+			const Uint16 column = m_typeColumns[message.type];
+			if (column == NoColumn)
 			{
-				// get handler for message type
-				MessageType type = queue.front().type;
-				MessageCallback callback = m_messageHandlers[current][type];
+				continue;
+			}
 
-				// check that handler exists
-				if (callback)
-				{
-					callback(queue.front());
-				}
+			const MessageCallback& callback = m_handlers[slot * columns + column];
+			if (callback)
+			{
+				callback(std::move(message));
+			}
+		}
+		m_dispatching = false;
 
-				// remove from queue
-				queue.pop();
+		// apply handler changes made by handlers
+		for (PendingHandler& pending : m_pendingHandlers)
+		{
+			if (AgentExists(pending.agent))
+			{
+				SetHandler(pending.agent, pending.type, std::move(pending.callback));
 			}
 		}
+		m_pendingHandlers.clear();
 
 		// remove agents that have been marked for removal
 		PurgeAgents();
 	}
 
-	void MessageServiceImpl::SendMessageToAllAgents(Agent from, MessageType type, MessageData data)
+	void MessageServiceImpl::SendMessageToAllAgents(Agent from, MessageType type, const MessageData& data)
 	{
-		for (auto agent : m_agents)
+		if (!AgentExists(from))
 		{
-			SendMessageToAgent(from, agent, type, data);
+			return;
+		}
+
+		// walk the slots directly rather than looking each agent up
+		const Uint32 slotCount = static_cast<Uint32>(m_slots.size());
+		for (Uint32 slot = 0; slot < slotCount; ++slot)
+		{
+			if (m_slots[slot].alive)
+			{
+				SendToSlot(from, slot, type, data);
+			}
 		}
 	}
 
-	void MessageServiceImpl::SendMessageToAgent(Agent from, Agent to, MessageType type, MessageData data)
+	void MessageServiceImpl::SendMessageToAgent(Agent from, Agent to, MessageType type, const MessageData& data)
 	{
 		if (!AgentExists(from))
 		{
 			return;
 		}
 
-		// do not send message to self
-		if (from == to)
+		// check that receiving agent exists
+		Uint32 slot;
+		if (!FindSlot(to, slot))
 		{
 			return;
 		}
 
-		// generate message
-		Message message;
-		message.sender = from;
-		message.receiver = to;
-		message.type = type;
-		message.payload = data;
-
-		// add message to receiver's mailbox
-		AddToMailbox(to, message);
+		SendToSlot(from, slot, type, data);
 	}
 
-	void MessageServiceImpl::SendMessageToAgent(Agent from, const AgentSet &to, MessageType type, MessageData data)
+	void MessageServiceImpl::SendMessageToAgent(Agent from, const AgentSet &to, MessageType type, const MessageData& data)
 	{
 		for (auto &agent : to)
 		{
@@ -164,21 +232,20 @@ namespace AEngine
 		}
 	}
 
-	void MessageServiceImpl::SendMessageToCategory(Agent from, AgentCategory to, MessageType type, MessageData data)
+	void MessageServiceImpl::SendMessageToCategory(Agent from, AgentCategory to, MessageType type, const MessageData& data)
 	{
-		// check that category exists
-		if (m_categories.find(to) == m_categories.end())
+		if (!AgentExists(from))
 		{
 			return;
 		}
 
-		for (auto & agent : m_categories.at(to))
+		for (Uint32 slot : m_categories[to])
 		{
-			SendMessageToAgent(from, agent, type, data);
+			SendToSlot(from, slot, type, data);
 		}
 	}
 
-	void MessageServiceImpl::SendMessageToCategory(Agent from, const AgentCategorySet &to, MessageType type, MessageData data)
+	void MessageServiceImpl::SendMessageToCategory(Agent from, const AgentCategorySet &to, MessageType type, const MessageData& data)
 	{
 		for (auto &category : to)
 		{
@@ -191,17 +258,19 @@ namespace AEngine
 //--------------------------------------------------------------------------------
 	const AgentCategorySet MessageServiceImpl::GetRegisteredAgentCategories(Agent agent) const
 	{
-		if (!AgentExists(agent))
+		Uint32 slot;
+		if (!FindSlot(agent, slot))
 		{
 			return AgentCategorySet{};
 		}
 
 		AgentCategorySet categories;
-		for (auto &group : m_categories)
+		const std::bitset<CategoryCount>& membership = m_slots[slot].categories;
+		for (Size_t category = 0; category < CategoryCount; ++category)
 		{
-			if (group.second.find(agent) != group.second.end())
+			if (membership.test(category))
 			{
-				categories.insert(group.first);
+				categories.insert(static_cast<AgentCategory>(category));
 			}
 		}
 
@@ -210,15 +279,20 @@ namespace AEngine
 
 	const MessageTypeSet MessageServiceImpl::GetRegisteredMessageTypes(Agent agent) const
 	{
-		if (!AgentExists(agent))
+		Uint32 slot;
+		if (!FindSlot(agent, slot) || slot >= m_handlerRows)
 		{
 			return MessageTypeSet{};
 		}
 
 		MessageTypeSet types;
-		for (auto &handler : m_messageHandlers.at(agent))
+		const Size_t columns = m_columnTypes.size();
+		for (Size_t column = 0; column < columns; ++column)
 		{
-			types.insert(handler.first);
+			if (m_handlers[slot * columns + column])
+			{
+				types.insert(m_columnTypes[column]);
+			}
 		}
 
 		return types;
@@ -227,42 +301,164 @@ namespace AEngine
 //--------------------------------------------------------------------------------
 // Private
 //--------------------------------------------------------------------------------
-	void MessageServiceImpl::AddToMailbox(Agent agent, Message &message)
+	void MessageServiceImpl::AddToMailbox(Uint32 slot, Message&& message)
 	{
-		// check that receiving agent exists
-		if (m_agents.find(agent) == m_agents.end())
+		if (m_arenaCount == m_arena.size())
+		{
+			GrowArena();
+		}
+
+		Envelope& envelope = m_arena[(m_arenaHead + m_arenaCount) % m_arena.size()];
+		envelope.slot = slot;
+		envelope.message = std::move(message);
+		++m_arenaCount;
+	}
+
+	void MessageServiceImpl::SendToSlot(Agent from, Uint32 slot, MessageType type, const MessageData& data)
+	{
+		// do not send message to self
+		const Agent to = m_slots[slot].agent;
+		if (from == to)
+		{
+			return;
+		}
+
+		AddToMailbox(slot, Message{ from, to, type, data });
+	}
+
+	void MessageServiceImpl::GrowArena()
+	{
+		// unroll the ring into the new storage so the head is back at zero
+		const Size_t capacity = m_arena.empty() ? 64 : m_arena.size() * 2;
+		std::vector<Envelope> arena(capacity);
+		for (Size_t i = 0; i < m_arenaCount; ++i)
+		{
+			arena[i] = std::move(m_arena[(m_arenaHead + i) % m_arena.size()]);
+		}
+
+		m_arena = std::move(arena);
+		m_arenaHead = 0;
+	}
+
+	void MessageServiceImpl::SetHandler(Agent agent, MessageType type, MessageCallback&& callback)
+	{
+		Uint32 slot;
+		if (!FindSlot(agent, slot))
 		{
 			return;
 		}
 
-		m_mailboxes[agent].push(message);
+		// clearing a handler that was never set needs no storage
+		if (!callback && (m_typeColumns[type] == NoColumn || slot >= m_handlerRows))
+		{
+			return;
+		}
+
+		const Uint16 column = GetOrAddColumn(type);
+		const Size_t columns = m_columnTypes.size();
+		if (slot >= m_handlerRows)
+		{
+			m_handlerRows = m_slots.size();
+			m_handlers.resize(m_handlerRows * columns);
+		}
+
+		m_handlers[slot * columns + column] = std::move(callback);
+	}
+
+	Uint16 MessageServiceImpl::GetOrAddColumn(MessageType type)
+	{
+		if (m_typeColumns[type] != NoColumn)
+		{
+			return m_typeColumns[type];
+		}
+
+		// re-lay the table out with the extra column, this only happens once per type
+		const Size_t oldColumns = m_columnTypes.size();
+		const Size_t newColumns = oldColumns + 1;
+		std::vector<MessageCallback> handlers(m_handlerRows * newColumns);
+		for (Size_t row = 0; row < m_handlerRows; ++row)
+		{
+			for (Size_t column = 0; column < oldColumns; ++column)
+			{
+				handlers[row * newColumns + column] = std::move(m_handlers[row * oldColumns + column]);
+			}
+		}
+
+		m_handlers = std::move(handlers);
+		m_typeColumns[type] = static_cast<Uint16>(oldColumns);
+		m_columnTypes.push_back(type);
+		return m_typeColumns[type];
+	}
+
+	bool MessageServiceImpl::FindSlot(Agent agent, Uint32& slot) const
+	{
+		auto it = m_slotLookup.find(agent);
+		if (it == m_slotLookup.end())
+		{
+			return false;
+		}
+
+		slot = it->second;
+		return true;
+	}
+
+	void MessageServiceImpl::EraseFromCategory(Size_t category, Uint32 slot)
+	{
+		// membership order does not matter, swap with the back to erase
+		std::vector<Uint32>& members = m_categories[category];
+		auto it = std::find(members.begin(), members.end(), slot);
+		if (it != members.end())
+		{
+			*it = members.back();
+			members.pop_back();
+		}
 	}
 
 	bool AEngine::MessageServiceImpl::AgentExists(Agent agent) const
 	{
 		return {
-			m_agents.find(agent) != m_agents.end()
+			m_slotLookup.find(agent) != m_slotLookup.end()
 		};
 	}
 
 	void MessageServiceImpl::PurgeAgents()
 	{
+		const Size_t columns = m_columnTypes.size();
 		for (Agent agent : m_agentsToRemove)
 		{
-			// remove agent from all groups
-			for (auto &category : m_categories)
+			// the agent may have been destroyed more than once
+			Uint32 slot;
+			if (!FindSlot(agent, slot))
 			{
-				category.second.erase(agent);
+				continue;
 			}
 
-			// remove agent's message handlers
-			m_messageHandlers.erase(agent);
+			// remove agent from the groups it joined
+			std::bitset<CategoryCount>& membership = m_slots[slot].categories;
+			for (Size_t category = 0; membership.any() && category < CategoryCount; ++category)
+			{
+				if (membership.test(category))
+				{
+					membership.reset(category);
+					EraseFromCategory(category, slot);
+				}
+			}
 
-			// remove agent's mailbox
-			m_mailboxes.erase(agent);
+			// remove agent's message handlers
+			if (slot < m_handlerRows)
+			{
+				for (Size_t column = 0; column < columns; ++column)
+				{
+					m_handlers[slot * columns + column] = nullptr;
+				}
+			}
 
-			// remove agent from registered agents
-			m_agents.erase(agent);
+			// remove agent from registered agents, queued messages to it are dropped on dispatch
+			m_slots[slot].alive = false;
+			m_slotLookup.erase(agent);
+			m_freeSlots.push_back(slot);
 		}
+
+		m_agentsToRemove.clear();
 	}
 }
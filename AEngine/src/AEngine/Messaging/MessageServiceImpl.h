@@ -6,8 +6,10 @@
 #include "AEngine/Core/Types.h"
 #include "Message.h"
 #include "MessageAgent.h"
-#include <map>
-#include <queue>
+#include <array>
+#include <bitset>
+#include <unordered_map>
+#include <vector>
 
 namespace AEngine
 {
@@ -83,10 +85,11 @@ namespace AEngine
 			/**
 			 * \brief Delivers all messages in the mailboxes of each agent.
 			 * \details
-			 * This will iterate through each agent and deliver all messages in their mailbox. \n
-			 * If the agent has no messages in their mailbox, then nothing will happen. \n
-			 * If the agent has messages in their mailbox, then the message will be delivered to the agent's message handler. \n
-			 * If the agent has no message handler for the message type, then the message will be ignored.
+			 * Queued messages are delivered in the order they were sent. \n
+			 * Each message is delivered to the receiving agent's handler for the message type. \n
+			 * If the agent has no message handler for the message type, then the message will be ignored. \n
+			 * Messages sent by handlers are delivered on the next dispatch.
+			 * \note Handlers registered or unregistered from within a handler take effect once the dispatch completes.
 			*/
 		void DispatchMessages();
 
@@ -96,7 +99,7 @@ namespace AEngine
 			 * \param[in] type The type of the message.
 			 * \param[in] data The data of the message.
 			*/
-		void SendMessageToAllAgents(Agent from, MessageType type, MessageData data);
+		void SendMessageToAllAgents(Agent from, MessageType type, const MessageData& data);
 			/**
 			 * \brief Send a message from the given agent to the given agent.
 			 * \param[in] from The agent sending the message.
@@ -105,7 +108,7 @@ namespace AEngine
 			 * \param[in] data The data of the message.
 			 * \note If the receiver does not exist, then the message will be ignored.
 			*/
-		void SendMessageToAgent(Agent from, Agent to, MessageType type, MessageData data);
+		void SendMessageToAgent(Agent from, Agent to, MessageType type, const MessageData& data);
 			/**
 			 * \brief Send a message from the given agent to the given agents.
 			 * \param[in] from The agent sending the message.
@@ -113,7 +116,7 @@ namespace AEngine
 			 * \param[in] type The type of the message.
 			 * \param[in] data The data of the message.
 			*/
-		void SendMessageToAgent(Agent from, const AgentSet &to, MessageType type, MessageData data);
+		void SendMessageToAgent(Agent from, const AgentSet &to, MessageType type, const MessageData& data);
 
 			/**
 			 * \brief Send a message from the given agent to all agents in the given category.
@@ -123,7 +126,7 @@ namespace AEngine
 			 * \param[in] data The data of the message.
 			 * \note If the category does not exist, then the message will be ignored.
 			*/
-		void SendMessageToCategory(Agent from, AgentCategory to, MessageType type, const MessageData data);
+		void SendMessageToCategory(Agent from, AgentCategory to, MessageType type, const MessageData& data);
 			/**
 			 * \brief Send a message from the given agent to all agents in the given categories.
 			 * \param[in] from The agent sending the message.
@@ -131,7 +134,7 @@ namespace AEngine
 			 * \param[in] type The type of the message.
 			 * \param[in] data The data of the message.
 			*/
-		void SendMessageToCategory(Agent from, const AgentCategorySet &to, MessageType type, const MessageData data);
+		void SendMessageToCategory(Agent from, const AgentCategorySet &to, MessageType type, const MessageData& data);
 
 			/**
 			 * \brief Get the categories that an agent is registered to.
@@ -147,39 +150,144 @@ namespace AEngine
 		const MessageTypeSet GetRegisteredMessageTypes(Agent agent) const;
 
 	private:
-		using AgentMessageHandlers = std::map<MessageType, MessageCallback>;
-		using MessageQueue = std::queue<Message>;
+		static constexpr Uint16 NoColumn = UINT16_MAX;
+		static constexpr Size_t TypeCount = 256;
+		static constexpr Size_t CategoryCount = 256;
+
+			/**
+			 * \brief Dense storage for a registered agent
+			*/
+		struct AgentSlot
+		{
+			Agent agent;
+			bool alive;
+			std::bitset<CategoryCount> categories;   // categories the slot is a member of
+		};
+
+			/**
+			 * \brief Message queued in the arena, tagged with the receiver's slot
+			*/
+		struct Envelope
+		{
+			Uint32 slot;
+			Message message;
+		};
+
+			/**
+			 * \brief Handler change requested while messages were being dispatched
+			*/
+		struct PendingHandler
+		{
+			Agent agent;
+			MessageType type;
+			MessageCallback callback;
+		};
 
 	private:
-		MessageServiceImpl() = default;
+		MessageServiceImpl();
+			/**
+			 * \brief Holds the agent in each slot
+			*/
+		std::vector<AgentSlot> m_slots;
+			/**
+			 * \brief Slots released by purged agents, reused before the table grows
+			*/
+		std::vector<Uint32> m_freeSlots;
+			/**
+			 * \brief Maps agent identifiers to their slot
+			*/
+		std::unordered_map<Agent, Uint32> m_slotLookup;
+			/**
+			 * \brief Maps each message type to its column in the handler table
+			 * \details Only types that have had a handler registered are given a column
+			*/
+		std::array<Uint16, TypeCount> m_typeColumns;
+			/**
+			 * \brief Message type of each handler table column
+			*/
+		std::vector<MessageType> m_columnTypes;
+			/**
+			 * \brief Row major table of handlers, one row per slot and one column per type
+			*/
+		std::vector<MessageCallback> m_handlers;
+			/**
+			 * \brief Number of slots the handler table has rows for
+			*/
+		Size_t m_handlerRows;
+			/**
+			 * \brief Slots registered to each category
+			*/
+		std::array<std::vector<Uint32>, CategoryCount> m_categories;
 			/**
-			 * \brief Holds the message handlers for each agent.
+			 * \brief Ring buffer of queued messages, reused between dispatches
 			*/
-		std::map<Agent, AgentMessageHandlers> m_messageHandlers;
+		std::vector<Envelope> m_arena;
 			/**
-			 * \brief Holds the mailboxes for each agent.
+			 * \brief Index of the oldest queued message in the arena
 			*/
-		std::map<Agent, MessageQueue> m_mailboxes;
+		Size_t m_arenaHead;
 			/**
-			 * \brief Holds the categories that each agent is registered to.
+			 * \brief Number of queued messages in the arena
 			*/
-		std::map<AgentCategory, AgentSet> m_categories;
+		Size_t m_arenaCount;
 			/**
-			 * \brief Holds the agents that are currently registered
+			 * \brief Whether DispatchMessages() is currently running
 			*/
-		AgentSet m_agents;
+		bool m_dispatching;
+			/**
+			 * \brief Handler changes deferred until the current dispatch completes
+			*/
+		std::vector<PendingHandler> m_pendingHandlers;
 			/**
 			 * \brief Holds the agents that are currently registered to be removed.
 			*/
 		std::vector<Agent> m_agentsToRemove;
 
 			/**
-			 * \brief Add a message to the mailbox of the given agent.
-			 * \param[in] agent The agent to add the message to.
+			 * \brief Add a message to the arena for the given slot.
+			 * \param[in] slot The slot of the receiving agent.
 			 * \param[in] message The message to add.
-			 * \note If the agent does not exist, then the message will be dropped.
 			*/
-		void AddToMailbox(Agent agent, Message &message);
+		void AddToMailbox(Uint32 slot, Message&& message);
+			/**
+			 * \brief Sends a message once the sender has been validated.
+			 * \param[in] from The agent sending the message.
+			 * \param[in] slot The slot of the receiving agent.
+			 * \param[in] type The type of the message.
+			 * \param[in] data The data of the message.
+			*/
+		void SendToSlot(Agent from, Uint32 slot, MessageType type, const MessageData& data);
+			/**
+			 * \brief Grows the arena, keeping queued messages in order.
+			*/
+		void GrowArena();
+			/**
+			 * \brief Sets or clears a handler in the table.
+			 * \param[in] agent The agent owning the handler.
+			 * \param[in] type The message type of the handler.
+			 * \param[in] callback The handler, empty to clear it.
+			*/
+		void SetHandler(Agent agent, MessageType type, MessageCallback&& callback);
+			/**
+			 * \brief Returns the handler column for a type, adding one if needed.
+			 * \param[in] type The message type.
+			 * \return Column of the type in the handler table.
+			*/
+		Uint16 GetOrAddColumn(MessageType type);
+			/**
+			 * \brief Finds the slot of the given agent.
+			 * \param[in] agent The agent to find.
+			 * \param[out] slot The slot of the agent, if found.
+			 * \retval True The agent exists.
+			 * \retval False The agent does not exist.
+			*/
+		bool FindSlot(Agent agent, Uint32& slot) const;
+			/**
+			 * \brief Removes a slot from the members of a category.
+			 * \param[in] category The category to remove the slot from.
+			 * \param[in] slot The slot to remove.
+			*/
+		void EraseFromCategory(Size_t category, Uint32 slot);
 			/**
 			 * \brief Checks if the given agent exists.
 			 * \param[in] agent The agent to check.
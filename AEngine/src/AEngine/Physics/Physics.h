@@ -60,6 +60,28 @@ namespace AEngine
 			 */
 		virtual SharedPtr<RigidBody> AddRigidBody(const Math::vec3& position, const Math::quat& orientation) = 0;
 
+		// transform sync
+			/**
+			 * \brief Moves many bodies in one call.
+			 * \param[in] bodies The bodies to move, created by this world.
+			 * \param[in] positions The new position of each body.
+			 * \param[in] orientations The new orientation of each body.
+			 * \param[in] count The number of bodies.
+			 * \note Only pass the bodies whose transform changed, each one is pushed into the simulation.
+			 */
+		virtual void WriteTransforms(CollisionBody* const* bodies, const Math::vec3* positions, const Math::quat* orientations, Size_t count) = 0;
+			/**
+			 * \brief Reads the transforms of the bodies the simulation has moved since they were last read.
+			 * \param[in] bodies The bodies to read, created by this world.
+			 * \param[in] count The number of bodies.
+			 * \param[out] moved The index into bodies of each moved body, needs room for count entries.
+			 * \param[out] positions The position of each moved body, in the order of moved.
+			 * \param[out] orientations The orientation of each moved body, in the order of moved.
+			 * \return The number of moved bodies written to the output arrays.
+			 * \note Bodies at rest are skipped, reading clears the moved state of every body read.
+			 */
+		virtual Size_t ReadTransforms(RigidBody* const* bodies, Size_t count, Uint32* moved, Math::vec3* positions, Math::quat* orientations) = 0;
+
 		// rendering
 		virtual void Render(const Math::mat4& projectionView) const = 0;
 		virtual bool IsRenderingEnabled() const = 0;
@@ -3,6 +3,8 @@
 #include "AEngine/Core/Logger.h"
 #include "AEngine/Render/RenderCommand.h"
 #include "Platform/Assimp/AssimpAnimation.h"
+#include <unordered_map>
+#include <utility>
 
 namespace AEngine
 {
@@ -38,4 +40,69 @@ namespace AEngine
 	{
 		return m_RootNode;
 	}
-}
\ No newline at end of file
+
+	const std::vector<SkeletonNode>& Animation::GetSkeleton() const
+	{
+		return m_skeleton;
+	}
+
+	namespace
+	{
+			// Splits a transform without shear into translation, rotation and scale
+		BoneTransform Decompose(const Math::mat4& transform)
+		{
+			BoneTransform result;
+			result.translation = Math::vec3(transform[3]);
+			Math::mat3 basis;
+			for (int i = 0; i < 3; i++)
+			{
+				const float length = Math::length(Math::vec3(transform[i]));
+				result.scale[i] = length;
+				basis[i] = length > 0.0f ? Math::vec3(transform[i]) / length : Math::vec3(0.0f);
+			}
+
+			result.rotation = Math::normalize(Math::quat_cast(basis));
+			return result;
+		}
+	}
+
+	void Animation::BuildSkeleton()
+	{
+		std::unordered_map<std::string, int> channels;
+		for (int i = 0; i < static_cast<int>(m_bones.size()); i++)
+		{
+			channels.emplace(m_bones[i]->GetBoneName(), i);
+		}
+
+		// depth first with an explicit stack, each node is appended before its children
+		m_skeleton.clear();
+		std::vector<std::pair<const SceneNode*, int>> stack{ { &m_RootNode, -1 } };
+		while (!stack.empty())
+		{
+			const auto [node, parent] = stack.back();
+			stack.pop_back();
+
+			SkeletonNode flat{ parent, -1, nullptr, -1, node->transformation, Math::mat4(1.0f), Decompose(node->transformation) };
+			auto channel = channels.find(node->name);
+			if (channel != channels.end())
+			{
+				flat.channel = channel->second;
+				flat.bone = m_bones[channel->second].get();
+			}
+
+			auto info = m_BoneInfoMap.find(node->name);
+			if (info != m_BoneInfoMap.end())
+			{
+				flat.boneId = info->second.id;
+				flat.offset = info->second.offset;
+			}
+
+			const int index = static_cast<int>(m_skeleton.size());
+			m_skeleton.push_back(flat);
+			for (int i = node->numChildren - 1; i >= 0; i--)
+			{
+				stack.emplace_back(&node->children[i], index);
+			}
+		}
+	}
+}
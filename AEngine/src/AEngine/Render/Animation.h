@@ -38,6 +38,22 @@ namespace AEngine
 		std::vector<SceneNode> children;
 	};
 
+		/**
+		 * \struct SkeletonNode
+		 * \brief A node of the flattened node hierarchy
+		 * \note Parents always come before their children, so a pose is evaluated in one pass
+		**/
+	struct SkeletonNode
+	{
+		int parent;             // index of the parent node, -1 for the root
+		int channel;            // index into Animation::GetBones(), -1 if the node is not animated
+		const Bone* bone;       // animated channel of the node, null if the node is not animated
+		int boneId;             // index into the bone matrices, -1 if the node does not skin any vertices
+		Math::mat4 transform;   // local transform used when the node is not animated
+		Math::mat4 offset;      // bone offset, identity if the node does not skin any vertices
+		BoneTransform rest;     // transform split into translation, rotation and scale for blending
+	};
+
 		/**
 		 * \class Animation
 		 * \brief Abstract class that provides methods to use Animation
@@ -78,6 +94,11 @@ namespace AEngine
 			 * \return SceneNode&
 			*/
 		const SceneNode& GetRoot() const;
+			/**
+			 * \brief Get the node hierarchy flattened with parents first
+			 * \return vector<SkeletonNode>&
+			*/
+		const std::vector<SkeletonNode>& GetSkeleton() const;
 	
 	protected:
 			/**
@@ -87,6 +108,11 @@ namespace AEngine
 			 * \note path is of parent asset
 			*/
 		Animation(const std::string& ident, const std::string& path);
+			/**
+			 * \brief Flattens the node hierarchy and resolves each node's bone
+			 * \note Call once the root node, bone map and bones are loaded
+			*/
+		void BuildSkeleton();
 		
 		SceneNode m_RootNode;
 		std::map<std::string, BoneInfo> m_BoneInfoMap;
@@ -94,5 +120,6 @@ namespace AEngine
 		float m_duration;
 		float m_ticksPerSecond;
 		std::vector<SharedPtr<Bone>> m_bones;
+		std::vector<SkeletonNode> m_skeleton;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,191 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#include "AnimationScheduler.h"
+#include "AEngine/Core/JobSystem.h"
+#include "Animator.h"
+#include "Buffer.h"
+#include <algorithm>
+
+namespace
+{
+		// each palette range is 6400 bytes, a multiple of the 256 byte uniform offset alignment
+	constexpr AEngine::Intptr_t g_aePaletteSlotBytes = AEngine::Animator::MaxBones * sizeof(AEngine::Math::mat4);
+	static_assert(g_aePaletteSlotBytes % 256 == 0, "Palette slots must start on the uniform buffer offset alignment");
+
+		// evaluating a pose is expensive, gathering it is a copy
+	constexpr AEngine::Size_t g_aeEvaluateGrain = 4;
+	constexpr AEngine::Size_t g_aeGatherGrain = 32;
+}
+
+namespace AEngine
+{
+	AnimationScheduler::AnimationScheduler() = default;
+
+	AnimationScheduler::~AnimationScheduler() = default;
+
+	void AnimationScheduler::Clear()
+	{
+		m_items.clear();
+		m_slotCount = 0;
+	}
+
+	Uint32 AnimationScheduler::Submit(Animator& animator, float distance, bool visible, Uint32 stagger)
+	{
+		const Uint32 slot = visible ? m_slotCount++ : InvalidSlot;
+		m_items.push_back({ &animator, distance, visible, stagger, slot, nullptr });
+		return slot;
+	}
+
+	void AnimationScheduler::Update(float dt)
+	{
+		m_stats = Stats{};
+		m_due.clear();
+		m_sources.clear();
+		++m_frame;
+
+		for (Size_t i = 0; i < m_items.size(); ++i)
+		{
+			Item& item = m_items[i];
+			Animator& animator = *item.animator;
+			animator.Advance(dt);
+			++m_stats.animators;
+
+			// nothing is drawn, only keep time and evaluate when it is visible again
+			if (!item.visible || !animator.GetAnimation())
+			{
+				animator.DiscardPose();
+				continue;
+			}
+
+			const Uint32 interval = GetInterval(item.distance);
+			if (animator.HasPose() && (m_frame + item.stagger) % interval != 0)
+			{
+				++m_stats.deferred;
+				continue;
+			}
+
+			// a blended pose depends on more than one animation and time, so it is never shared
+			float time = 0.0f;
+			const Animation* animation = animator.GetPoseAnimation(time);
+			if (!animation)
+			{
+				m_sources.push_back(i);
+				continue;
+			}
+
+			m_due.push_back({ animation, time, i });
+		}
+
+		// group animators at the same point of the same animation, the first of each group evaluates
+		if (m_settings.sharePoses)
+		{
+			std::sort(m_due.begin(), m_due.end(), [](const Due& lhs, const Due& rhs) {
+				return lhs.animation != rhs.animation ? lhs.animation < rhs.animation : lhs.time < rhs.time;
+			});
+		}
+
+		const Animator* source = nullptr;
+		for (Size_t i = 0; i < m_due.size(); ++i)
+		{
+			const Due& due = m_due[i];
+			const bool sameAsLast = i > 0 && due.animation == m_due[i - 1].animation && due.time == m_due[i - 1].time;
+			if (m_settings.sharePoses && sameAsLast)
+			{
+				m_items[due.item].source = source;
+				++m_stats.shared;
+				continue;
+			}
+
+			m_sources.push_back(due.item);
+			source = m_items[due.item].animator;
+		}
+
+		m_stats.evaluated = static_cast<Uint32>(m_sources.size());
+
+		// each job only writes to its own animators and palette slots
+		JobSystem::Instance().ParallelFor(m_sources.size(), g_aeEvaluateGrain, [this](Size_t begin, Size_t end) {
+			for (Size_t i = begin; i < end; ++i)
+			{
+				m_items[m_sources[i]].animator->Evaluate();
+			}
+		});
+
+		m_palette.resize(static_cast<Size_t>(m_slotCount) * Animator::MaxBones);
+		JobSystem::Instance().ParallelFor(m_items.size(), g_aeGatherGrain, [this](Size_t begin, Size_t end) {
+			for (Size_t i = begin; i < end; ++i)
+			{
+				const Item& item = m_items[i];
+				if (item.source)
+				{
+					item.animator->CopyPose(*item.source);
+				}
+
+				if (item.slot != InvalidSlot)
+				{
+					const std::vector<Math::mat4>& pose = item.animator->GetFinalBoneMatrices();
+					std::copy(pose.begin(), pose.end(), m_palette.begin() + static_cast<Size_t>(item.slot) * Animator::MaxBones);
+				}
+			}
+		});
+	}
+
+	void AnimationScheduler::UploadPalette()
+	{
+		if (m_slotCount == 0)
+		{
+			return;
+		}
+
+		if (!m_paletteBuffer)
+		{
+			m_paletteBuffer = UniformBuffer::Create(UniformBlock::Skeleton);
+		}
+
+		// grow to the palette's capacity so a slowly growing crowd does not reallocate every frame
+		const Intptr_t bytes = static_cast<Intptr_t>(m_slotCount) * g_aePaletteSlotBytes;
+		if (bytes > m_paletteBuffer->Size())
+		{
+			const Intptr_t capacity = static_cast<Intptr_t>(m_palette.capacity() * sizeof(Math::mat4));
+			m_paletteBuffer->SetData(nullptr, capacity, BufferUsage::DynamicDraw);
+		}
+
+		m_paletteBuffer->SetSubData(m_palette.data(), bytes, 0);
+	}
+
+	void AnimationScheduler::BindPalette(Uint32 slot) const
+	{
+		m_paletteBuffer->BindRange(static_cast<Intptr_t>(slot) * g_aePaletteSlotBytes, g_aePaletteSlotBytes);
+	}
+
+	const Math::mat4* AnimationScheduler::GetPalette(Uint32 slot) const
+	{
+		return m_palette.data() + static_cast<Size_t>(slot) * Animator::MaxBones;
+	}
+
+	AnimationScheduler::Settings& AnimationScheduler::GetSettings()
+	{
+		return m_settings;
+	}
+
+	const AnimationScheduler::Stats& AnimationScheduler::GetStats() const
+	{
+		return m_stats;
+	}
+
+	Uint32 AnimationScheduler::GetInterval(float distance) const
+	{
+		if (distance < m_settings.fullRateDistance)
+		{
+			return 1;
+		}
+
+		if (distance < m_settings.halfRateDistance)
+		{
+			return 2;
+		}
+
+		return std::max<Uint32>(m_settings.farInterval, 1);
+	}
+}
@@ -0,0 +1,146 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+ * \brief Distance based animation level of detail and pose sharing
+*/
+#pragma once
+#include "AEngine/Core/Types.h"
+#include "AEngine/Math/Math.h"
+#include <limits>
+#include <vector>
+
+namespace AEngine
+{
+	class Animation;
+	class Animator;
+	class UniformBuffer;
+
+		/**
+		 * \class AnimationScheduler
+		 * \brief Advances the animators of a frame and decides which poses are evaluated
+		 * \details
+		 * Every submitted animator is advanced each frame so its clock never drifts, but its pose
+		 * is only evaluated as often as its distance from the camera calls for. Animators that are
+		 * not visible only keep time, and evaluate as soon as they are visible again. Animators
+		 * playing the same animation at the same time, without blending, evaluate one pose and share it.
+		 *
+		 * Poses are evaluated on the JobSystem and gathered into one palette holding the bone
+		 * matrices of every visible animator, which is uploaded once per frame. Each draw then
+		 * binds its animator's range of the palette.
+		*/
+	class AnimationScheduler
+	{
+	public:
+			/**
+			 * \brief Slot returned for animators that are not drawn
+			*/
+		static constexpr Uint32 InvalidSlot = std::numeric_limits<Uint32>::max();
+
+			/**
+			 * \struct Settings
+			 * \brief Distances at which animators are evaluated less often
+			*/
+		struct Settings
+		{
+			float fullRateDistance{ 20.0f };   ///< Closer than this the pose is evaluated every frame
+			float halfRateDistance{ 40.0f };   ///< Closer than this the pose is evaluated every second frame
+			Uint32 farInterval{ 4 };           ///< Frames between evaluations beyond halfRateDistance
+			bool sharePoses{ true };           ///< Share poses between animators at the same point of an animation
+		};
+
+			/**
+			 * \struct Stats
+			 * \brief Counters for the work done by the last Update()
+			*/
+		struct Stats
+		{
+			Uint32 animators{ 0 };   ///< Number of animators advanced
+			Uint32 evaluated{ 0 };   ///< Number of poses evaluated
+			Uint32 shared{ 0 };      ///< Number of poses copied from another animator
+			Uint32 deferred{ 0 };    ///< Number of visible animators that kept their last pose
+		};
+
+	public:
+		AnimationScheduler();
+		~AnimationScheduler();
+			/**
+			 * \brief Removes all submissions
+			 * \note This should be called once at the start of each frame
+			*/
+		void Clear();
+			/**
+			 * \brief Queues an animator for this frame's update
+			 * \param[in] animator to update, must outlive the next Update()
+			 * \param[in] distance from the camera
+			 * \param[in] visible whether the animator's model is drawn this frame
+			 * \param[in] stagger spreads animators at the same distance across frames, such as an entity id
+			 * \return Palette slot to bind when drawing, or InvalidSlot if the animator is not visible
+			*/
+		Uint32 Submit(Animator& animator, float distance, bool visible, Uint32 stagger);
+			/**
+			 * \brief Advances every submitted animator, evaluates the poses that are due and fills the palette
+			 * \param[in] dt delta time
+			 * \note Runs across the JobSystem, but does not touch the render context
+			*/
+		void Update(float dt);
+			/**
+			 * \brief Uploads the palette of every visible animator
+			 * \note Must be called on the render thread after Update()
+			*/
+		void UploadPalette();
+			/**
+			 * \brief Binds the bone matrices of a slot to UniformBlock::Skeleton
+			 * \param[in] slot returned by Submit()
+			*/
+		void BindPalette(Uint32 slot) const;
+			/**
+			 * \brief Returns the bone matrices of a slot
+			 * \param[in] slot returned by Submit()
+			 * \return Animator::MaxBones matrices, valid until the next Update()
+			*/
+		const Math::mat4* GetPalette(Uint32 slot) const;
+			/**
+			 * \brief Returns the settings, which may be changed between frames
+			 * \return Settings&
+			*/
+		Settings& GetSettings();
+			/**
+			 * \brief Returns the stats of the last update
+			 * \return Stats of the last update
+			*/
+		const Stats& GetStats() const;
+
+	private:
+		struct Item
+		{
+			Animator* animator;
+			float distance;
+			bool visible;
+			Uint32 stagger;
+			Uint32 slot;
+			const Animator* source;   // animator whose pose is shared this frame, null if none
+		};
+
+		struct Due
+		{
+			const Animation* animation;
+			float time;
+			Size_t item;
+		};
+
+			/**
+			 * \brief Returns the number of frames between evaluations at a distance
+			*/
+		Uint32 GetInterval(float distance) const;
+
+		Settings m_settings;
+		Stats m_stats;
+		std::vector<Item> m_items;
+		std::vector<Due> m_due;          // kept between frames to avoid reallocating
+		std::vector<Size_t> m_sources;   // items whose pose is evaluated this frame
+		std::vector<Math::mat4> m_palette;
+		Uint32 m_slotCount{ 0 };
+		Size_t m_frame{ 0 };
+		SharedPtr<UniformBuffer> m_paletteBuffer;
+	};
+}
@@ -1,5 +1,6 @@
 #include "Animator.h"
 #include "AEngine/Core/Logger.h"
+#include <algorithm>
 
 namespace AEngine
 {
@@ -11,18 +12,199 @@ namespace AEngine
 
 	void Animator::Load(const Animation& animation)
     {
-		m_FinalBoneMatrices.clear();
-
 		m_loadedAnimation = &animation;
+		m_hasPose = false;
+		m_blendPhase = 0.0f;
+
+			// Every clip's buffers are sized up front, so blending never allocates while playing
+		const Size_t nodes = animation.GetSkeleton().size();
+		for (Clip& clip : m_clips)
+		{
+			clip.animation = nullptr;
+			clip.cursors.resize(nodes);
+			clip.pose.resize(nodes);
+		}
+
+		m_blended.resize(nodes);
+		m_globalTransforms.assign(nodes, Math::mat4(1.0f));
 
-		m_currentTime = 0;
+		m_primary = Start(animation, false);
+		Fade(m_clips[m_primary], 1.0f, 0.0f);
 		
 		AE_LOG_DEBUG("Animation loaded: {}", m_loadedAnimation->GetName());
 
-        for (unsigned int i = 0; i < 100; i++)
-			m_FinalBoneMatrices.push_back(Math::mat4(1.0f));
+        m_FinalBoneMatrices.assign(MaxBones, Math::mat4(1.0f));
     }
 
+	void Animator::CrossFade(const Animation& animation, float duration)
+	{
+		if (!m_loadedAnimation || !IsCompatible(animation))
+		{
+			Load(animation);
+			return;
+		}
+
+			// Fading back to a clip that is still fading out carries on from its time
+		int primary = -1;
+		for (int i = 0; i < static_cast<int>(MaxClips); i++)
+		{
+			const Clip& clip = m_clips[i];
+			if (clip.animation == &animation && !clip.additive && !clip.inBlendSpace)
+				primary = i;
+		}
+
+		FadeOutBase(duration);
+		if (primary < 0 || !m_clips[primary].animation)
+			primary = Start(animation, false);
+
+		if (primary < 0)
+		{
+			AE_LOG_WARN("Animator::CrossFade::Warning -> No free clip, cutting to {}", animation.GetName());
+			Load(animation);
+			return;
+		}
+
+		Fade(m_clips[primary], 1.0f, duration);
+		m_primary = primary;
+		m_loadedAnimation = &animation;
+	}
+
+	void Animator::SetBlendSpace(const BlendPoint* points, Size_t count, float duration)
+	{
+		if (count == 0)
+			return;
+
+		if (!m_loadedAnimation)
+			Load(*points[0].animation);
+
+		FadeOutBase(duration);
+		for (Clip& clip : m_clips)
+			clip.inBlendSpace = false;
+
+		int primary = -1;
+		m_blendPhase = 0.0f;
+		for (Size_t i = 0; i < count; i++)
+		{
+			if (!IsCompatible(*points[i].animation))
+			{
+				AE_LOG_ERROR("Animator::SetBlendSpace::Error -> {} does not share the skeleton of {}", points[i].animation->GetName(), m_loadedAnimation->GetName());
+				continue;
+			}
+
+			const int index = Start(*points[i].animation, false);
+			if (index < 0)
+			{
+				AE_LOG_WARN("Animator::SetBlendSpace::Warning -> No free clip for {}", points[i].animation->GetName());
+				continue;
+			}
+
+			Clip& clip = m_clips[index];
+			clip.inBlendSpace = true;
+			clip.position = points[i].position;
+			Fade(clip, 1.0f, duration);
+			if (primary < 0)
+				primary = index;
+		}
+
+		if (primary >= 0)
+		{
+			m_primary = primary;
+			m_loadedAnimation = m_clips[primary].animation;
+		}
+
+		UpdateBlendWeights();
+	}
+
+	void Animator::SetBlendParameter(float parameter)
+	{
+		m_blendParameter = parameter;
+		UpdateBlendWeights();
+	}
+
+	int Animator::AddLayer(const Animation& animation, float weight, float duration)
+	{
+		if (!m_loadedAnimation || !IsCompatible(animation))
+		{
+			AE_LOG_ERROR("Animator::AddLayer::Error -> {} does not share the loaded skeleton", animation.GetName());
+			return -1;
+		}
+
+		const int index = Start(animation, true);
+		if (index < 0)
+		{
+			AE_LOG_WARN("Animator::AddLayer::Warning -> No free clip for {}", animation.GetName());
+			return -1;
+		}
+
+			// Layers add the difference from their first frame
+		Clip& clip = m_clips[index];
+		Sample(clip);
+		clip.reference = clip.pose;
+		Fade(clip, weight, duration);
+		return index;
+	}
+
+	void Animator::SetLayerWeight(int layer, float weight, float duration)
+	{
+		if (layer < 0 || layer >= static_cast<int>(MaxClips) || !m_clips[layer].additive || !m_clips[layer].animation)
+		{
+			AE_LOG_ERROR("Animator::SetLayerWeight::Error -> {} is not a layer", layer);
+			return;
+		}
+
+		Fade(m_clips[layer], weight, duration);
+	}
+
+	void Animator::RemoveLayer(int layer, float duration)
+	{
+		if (layer < 0 || layer >= static_cast<int>(MaxClips) || !m_clips[layer].additive || !m_clips[layer].animation)
+		{
+			AE_LOG_ERROR("Animator::RemoveLayer::Error -> {} is not a layer", layer);
+			return;
+		}
+
+		m_clips[layer].removing = true;
+		Fade(m_clips[layer], 0.0f, duration);
+	}
+
+	bool Animator::IsBlending() const
+	{
+		int contributing = 0;
+		for (const Clip& clip : m_clips)
+		{
+			if (clip.animation && GetWeight(clip) > 0.0f)
+				contributing++;
+		}
+
+		return contributing > 1;
+	}
+
+	const Animation* Animator::GetPoseAnimation(float& time) const
+	{
+		const Clip* single = nullptr;
+		for (const Clip& clip : m_clips)
+		{
+			if (!clip.animation || GetWeight(clip) <= 0.0f)
+				continue;
+
+				// A layer is added on top of the base pose, so the pose is a blend
+			if (single || clip.additive)
+				return nullptr;
+
+			single = &clip;
+		}
+
+			// Nothing has faded in yet, Evaluate holds the loaded animation
+		if (!single)
+			single = &m_clips[m_primary];
+
+		if (!single->animation)
+			return nullptr;
+
+		time = single->time;
+		return single->animation;
+	}
+
 	float Animator::GetDuration() const
 	{
 		return m_loadedAnimation->GetDuration() / m_loadedAnimation->GetTicksPerSecond();
@@ -30,47 +212,199 @@ namespace AEngine
 
 	void Animator::UpdateAnimation(float dt)
 	{
-		if (!m_isPlaying)
-			return;
-			// Loop animation seamlessly with fmod
-		m_currentTime += m_loadedAnimation->GetTicksPerSecond() * dt;
-		m_currentTime = fmod(m_currentTime, m_loadedAnimation->GetDuration());
-		CalculateBoneTransform(&m_loadedAnimation->GetRoot(), Math::mat4(1.0f));
+		Advance(dt);
+		Evaluate();
 	}
 
-	void Animator::CalculateBoneTransform(const SceneNode* node, Math::mat4 parentTransform)
+	void Animator::Advance(float dt)
 	{
-		Math::mat4 nodeTransform = node->transformation;
-		const Bone* Bone = GetBone(node->name);
+		if (!m_isPlaying || !m_loadedAnimation)
+			return;
+
+			// The blend space moves through its animations in step, at the rate of their weighted durations
+		float cyclesPerSecond = 0.0f;
+		float blendTotal = 0.0f;
+		for (const Clip& clip : m_clips)
+		{
+			if (!clip.animation || !clip.inBlendSpace)
+				continue;
 
-			// Check if node is a bone
-		if (Bone)
-			nodeTransform = Bone->GetLocalTransform(m_currentTime);
+			const float weight = GetWeight(clip);
+			cyclesPerSecond += weight * clip.animation->GetTicksPerSecond() / clip.animation->GetDuration();
+			blendTotal += weight;
+		}
+
+		if (blendTotal > 0.0f)
+			m_blendPhase = fmod(m_blendPhase + dt * cyclesPerSecond / blendTotal, 1.0f);
 
-			// Apply parent transform to child transform
-		Math::mat4 globalTransformation = parentTransform * nodeTransform;
+		for (Clip& clip : m_clips)
+		{
+			if (!clip.animation)
+				continue;
 
-  		const std::map<std::string, BoneInfo>& bonemap = m_loadedAnimation->GetBoneMap();
+				// Loop animation seamlessly with fmod
+			if (clip.inBlendSpace)
+				clip.time = m_blendPhase * clip.animation->GetDuration();
+			else
+				clip.time = fmod(clip.time + clip.animation->GetTicksPerSecond() * dt, clip.animation->GetDuration());
 
-			// Store bone final matrice for bone ID
-		if (bonemap.find(node->name) != bonemap.end())
-			m_FinalBoneMatrices[bonemap.at(node->name).id] = globalTransformation * bonemap.at(node->name).offset;
+			if (clip.weight < clip.targetWeight)
+				clip.weight = std::min(clip.weight + clip.fadeRate * dt, clip.targetWeight);
+			else if (clip.weight > clip.targetWeight)
+				clip.weight = std::max(clip.weight - clip.fadeRate * dt, clip.targetWeight);
 
-			// Calculate matrices for bone children
-		for (int i = 0; i < node->numChildren; i++)
-			CalculateBoneTransform(&node->children[i], globalTransformation);
+				// Faded out clips are freed, layers stay until removed
+			if (clip.weight == 0.0f && clip.targetWeight == 0.0f && (!clip.additive || clip.removing))
+				clip.animation = nullptr;
+		}
 	}
 
-	const Bone* Animator::GetBone(const std::string& name) const
+	void Animator::Evaluate()
 	{
-  		const std::vector<SharedPtr<Bone>> bones = m_loadedAnimation->GetBones();
+		if (!m_loadedAnimation)
+			return;
 
-		for (const auto& sharedPtrBone : bones)
+			// Sample each contributing clip once, then blend their local poses
+		Clip* single = nullptr;
+		int contributing = 0;
+		float baseTotal = 0.0f;
+		bool layered = false;
+		for (Clip& clip : m_clips)
 		{
-			if (sharedPtrBone->GetBoneName() == name)
-				return sharedPtrBone.get();
+			const float weight = GetWeight(clip);
+			if (!clip.animation || weight <= 0.0f)
+				continue;
+
+			Sample(clip);
+			if (clip.additive)
+			{
+				layered = true;
+				continue;
+			}
+
+			single = &clip;
+			baseTotal += weight;
+			contributing++;
 		}
-		return nullptr;
+
+			// Nothing has faded in yet, hold the loaded animation
+		if (contributing == 0)
+		{
+			if (!m_clips[m_primary].animation)
+				return;
+
+			single = &m_clips[m_primary];
+			Sample(*single);
+			contributing = 1;
+		}
+
+		const std::vector<SkeletonNode>& skeleton = m_loadedAnimation->GetSkeleton();
+		const bool blending = contributing > 1 || layered;
+		if (blending)
+		{
+			bool first = true;
+			for (const Clip& clip : m_clips)
+			{
+				const float weight = GetWeight(clip);
+				if (!clip.animation || clip.additive || weight <= 0.0f)
+					continue;
+
+				const float w = weight / baseTotal;
+				for (Size_t i = 0; i < skeleton.size(); i++)
+				{
+					const BoneTransform& pose = clip.pose[i];
+					BoneTransform& blended = m_blended[i];
+					if (first)
+					{
+						blended = { pose.translation * w, pose.rotation * w, pose.scale * w };
+						continue;
+					}
+
+						// Blend rotations in the same hemisphere so they take the short way round
+					const float sign = Math::dot(blended.rotation, pose.rotation) < 0.0f ? -1.0f : 1.0f;
+					blended.translation += pose.translation * w;
+					blended.rotation = blended.rotation + pose.rotation * (w * sign);
+					blended.scale += pose.scale * w;
+				}
+
+				first = false;
+			}
+
+			if (!first)
+			{
+				for (BoneTransform& blended : m_blended)
+					blended.rotation = Math::normalize(blended.rotation);
+			}
+			else
+			{
+				m_blended = single->pose;
+			}
+
+			for (const Clip& clip : m_clips)
+			{
+				const float weight = GetWeight(clip);
+				if (!clip.animation || !clip.additive || weight <= 0.0f)
+					continue;
+
+				for (Size_t i = 0; i < skeleton.size(); i++)
+				{
+					const BoneTransform& pose = clip.pose[i];
+					const BoneTransform& reference = clip.reference[i];
+					BoneTransform& blended = m_blended[i];
+					const Math::quat delta = Math::inverse(reference.rotation) * pose.rotation;
+					blended.translation += (pose.translation - reference.translation) * weight;
+					blended.rotation = Math::normalize(blended.rotation * Math::slerp(Math::quat(1.0f, 0.0f, 0.0f, 0.0f), delta, weight));
+					blended.scale *= Math::mix(Math::vec3(1.0f), pose.scale / reference.scale, weight);
+				}
+			}
+		}
+
+			// Parents come before children, so their global transform is always ready
+		const std::vector<SkeletonNode>& singleSkeleton = single->animation->GetSkeleton();
+		const int boneCount = static_cast<int>(m_FinalBoneMatrices.size());
+		for (Size_t i = 0; i < skeleton.size(); i++)
+		{
+			const SkeletonNode& node = skeleton[i];
+			Math::mat4 localTransform;
+			if (blending)
+				localTransform = Bone::Compose(m_blended[i]);
+			else
+				localTransform = singleSkeleton[i].bone ? Bone::Compose(single->pose[i]) : node.transform;
+
+			m_globalTransforms[i] = node.parent < 0 ? localTransform : m_globalTransforms[node.parent] * localTransform;
+
+				// Store bone final matrice for bone ID
+			if (node.boneId >= 0 && node.boneId < boneCount)
+				m_FinalBoneMatrices[node.boneId] = m_globalTransforms[i] * node.offset;
+		}
+
+		m_hasPose = true;
+	}
+
+	void Animator::CopyPose(const Animator& other)
+	{
+		m_FinalBoneMatrices = other.m_FinalBoneMatrices;
+		m_hasPose = other.m_hasPose;
+	}
+
+	bool Animator::HasPose() const
+	{
+		return m_hasPose;
+	}
+
+	void Animator::DiscardPose()
+	{
+		m_hasPose = false;
+	}
+
+	const Animation* Animator::GetAnimation() const
+	{
+		return m_loadedAnimation;
+	}
+
+	float Animator::GetTime() const
+	{
+		return m_loadedAnimation ? m_clips[m_primary].time : 0.0f;
 	}
 
 	std::vector<Math::mat4>& Animator::GetFinalBoneMatrices()
@@ -78,8 +412,149 @@ namespace AEngine
 		return m_FinalBoneMatrices;
 	}
 
+	const std::vector<Math::mat4>& Animator::GetFinalBoneMatrices() const
+	{
+		return m_FinalBoneMatrices;
+	}
+
 	const std::string& Animator::GetName()
 	{
 		return m_loadedAnimation->GetName();
 	}
+
+	bool Animator::IsCompatible(const Animation& animation) const
+	{
+		const std::vector<SkeletonNode>& loaded = m_loadedAnimation->GetSkeleton();
+		const std::vector<SkeletonNode>& skeleton = animation.GetSkeleton();
+		if (loaded.size() != skeleton.size())
+			return false;
+
+		for (Size_t i = 0; i < skeleton.size(); i++)
+		{
+			if (loaded[i].parent != skeleton[i].parent || loaded[i].boneId != skeleton[i].boneId)
+				return false;
+		}
+
+		return true;
+	}
+
+	int Animator::Start(const Animation& animation, bool additive)
+	{
+			// Take a free clip, or the faded out remains of a base clip
+		int index = -1;
+		for (int i = 0; i < static_cast<int>(MaxClips); i++)
+		{
+			const Clip& clip = m_clips[i];
+			if (!clip.animation)
+			{
+				index = i;
+				break;
+			}
+
+			const bool fadingOut = !clip.additive && clip.targetWeight == 0.0f;
+			if (fadingOut && (index < 0 || clip.weight < m_clips[index].weight))
+				index = i;
+		}
+
+		if (index < 0)
+			return -1;
+
+		Clip& clip = m_clips[index];
+		clip.animation = &animation;
+		clip.time = 0.0f;
+		clip.weight = 0.0f;
+		clip.targetWeight = 0.0f;
+		clip.fadeRate = 0.0f;
+		clip.blendWeight = 1.0f;
+		clip.position = 0.0f;
+		clip.inBlendSpace = false;
+		clip.additive = additive;
+		clip.removing = false;
+		clip.sampled = false;
+		std::fill(clip.cursors.begin(), clip.cursors.end(), BoneCursor{});
+		return index;
+	}
+
+	void Animator::Fade(Clip& clip, float weight, float duration)
+	{
+		clip.targetWeight = weight;
+		if (duration > 0.0f)
+		{
+			clip.fadeRate = 1.0f / duration;
+			return;
+		}
+
+		clip.weight = weight;
+		if (weight == 0.0f && (!clip.additive || clip.removing))
+			clip.animation = nullptr;
+	}
+
+	void Animator::FadeOutBase(float duration)
+	{
+		for (Clip& clip : m_clips)
+		{
+			if (clip.animation && !clip.additive)
+				Fade(clip, 0.0f, duration);
+		}
+	}
+
+	void Animator::UpdateBlendWeights()
+	{
+			// Find the nearest points either side of the parameter
+		int below = -1;
+		int above = -1;
+		for (int i = 0; i < static_cast<int>(MaxClips); i++)
+		{
+			const Clip& clip = m_clips[i];
+			if (!clip.animation || !clip.inBlendSpace)
+				continue;
+
+			if (clip.position <= m_blendParameter && (below < 0 || clip.position > m_clips[below].position))
+				below = i;
+			if (clip.position >= m_blendParameter && (above < 0 || clip.position < m_clips[above].position))
+				above = i;
+		}
+
+		for (Clip& clip : m_clips)
+		{
+			if (clip.inBlendSpace)
+				clip.blendWeight = 0.0f;
+		}
+
+			// Past either end of the blend space hold the last point
+		if (below < 0 || above < 0 || below == above)
+		{
+			const int nearest = below < 0 ? above : below;
+			if (nearest >= 0)
+				m_clips[nearest].blendWeight = 1.0f;
+			return;
+		}
+
+		const float span = m_clips[above].position - m_clips[below].position;
+		const float t = (m_blendParameter - m_clips[below].position) / span;
+		m_clips[below].blendWeight = 1.0f - t;
+		m_clips[above].blendWeight = t;
+	}
+
+	void Animator::Sample(Clip& clip)
+	{
+			// A clip whose time has not moved, such as a paused or deferred one, keeps its pose
+		if (clip.sampled && clip.sampledTime == clip.time)
+			return;
+
+		const std::vector<SkeletonNode>& skeleton = clip.animation->GetSkeleton();
+		for (Size_t i = 0; i < skeleton.size(); i++)
+		{
+			const SkeletonNode& node = skeleton[i];
+			clip.pose[i] = node.bone ? node.bone->Sample(clip.time, clip.cursors[i]) : node.rest;
+		}
+
+		clip.sampled = true;
+		clip.sampledTime = clip.time;
+	}
+
+	float Animator::GetWeight(const Clip& clip)
+	{
+		return clip.weight * (clip.inBlendSpace ? clip.blendWeight : 1.0f);
+	}
 }
\ No newline at end of file
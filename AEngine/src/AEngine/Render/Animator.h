@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <array>
 #include <vector>
 #include <map>
 #include <string>
@@ -13,13 +14,40 @@
 
 namespace AEngine
 {
+		/**
+		 * \struct BlendPoint
+		 * \brief An animation placed along the parameter of a blend space
+		**/
+    struct BlendPoint
+    {
+        const Animation* animation;
+        float position;
+    };
+
 		/**
 		 * \class Animator
 		 * \brief Loads an animation for a Skinned Model
+		 * \details
+		 * Besides playing one animation, an animator can crossfade between animations, blend a one
+		 * dimensional blend space and add additive layers on top. Blending happens on the local
+		 * translation, rotation and scale of each node of the flattened skeleton, so every clip
+		 * must share the skeleton of the animation first loaded.
+		 *
+		 * Each clip caches the pose it last sampled, so a clip is sampled at most once per time
+		 * however many blends read it. An animator holds at most MaxClips clips, and the buffers
+		 * of every clip are allocated by Load() and AddLayer(), so blending never allocates while playing.
 		**/
     class Animator
     {
     public:
+            /**
+             * \brief Number of bone matrices, must match MAX_BONES in the skinning shaders
+            */
+        static constexpr Size_t MaxBones = 100;
+            /**
+             * \brief Number of clips an animator blends at once, including additive layers
+            */
+        static constexpr Size_t MaxClips = 4;
             /**
              * \brief Default constructor
              * \note No animation is present
@@ -37,8 +65,64 @@ namespace AEngine
             /**
              * \brief Load animation to animator
              * \param[in] animation Animation to reference
+             * \note Cuts straight to the animation, dropping any blends and layers
             */
         void Load(const Animation& animation);
+            /**
+             * \brief Fades from the animations playing to another
+             * \param[in] animation Animation to fade to, must share the loaded skeleton
+             * \param[in] duration of the fade in seconds, zero cuts
+             * \note An animation still fading out keeps its time when faded back in
+            */
+        void CrossFade(const Animation& animation, float duration);
+            /**
+             * \brief Fades to a blend space, playing the animations either side of the blend parameter
+             * \param[in] points animations and their positions, at most MaxClips
+             * \param[in] count number of points
+             * \param[in] duration of the fade in seconds, zero cuts
+             * \note The animations of a blend space play in step, each scaled to its own duration
+            */
+        void SetBlendSpace(const BlendPoint* points, Size_t count, float duration);
+            /**
+             * \brief Sets the parameter choosing between the animations of the blend space
+             * \param[in] parameter position in the blend space
+            */
+        void SetBlendParameter(float parameter);
+            /**
+             * \brief Adds an animation on top of the blend, relative to its first frame
+             * \param[in] animation Additive animation, must share the loaded skeleton
+             * \param[in] weight of the layer
+             * \param[in] duration of the fade in seconds
+             * \return Layer index, or -1 if the animator has no free clip
+            */
+        int AddLayer(const Animation& animation, float weight, float duration = 0.0f);
+            /**
+             * \brief Fades the weight of a layer
+             * \param[in] layer index returned by AddLayer
+             * \param[in] weight of the layer
+             * \param[in] duration of the fade in seconds
+            */
+        void SetLayerWeight(int layer, float weight, float duration = 0.0f);
+            /**
+             * \brief Fades out and removes a layer
+             * \param[in] layer index returned by AddLayer
+             * \param[in] duration of the fade in seconds
+            */
+        void RemoveLayer(int layer, float duration = 0.0f);
+            /**
+             * \brief Whether more than one clip contributes to the pose
+             * \return bool
+             * \note A blending animator's pose cannot be shared by animation and time alone
+            */
+        bool IsBlending() const;
+            /**
+             * \brief Get the only animation contributing to the pose and its time
+             * \param[out] time of the returned animation in ticks
+             * \return Animation*, or nullptr if the pose blends more than one clip
+             * \note Unlike GetAnimation, this is the clip actually posing the skeleton, such as
+             * the only weighted point of a blend space
+            */
+        const Animation* GetPoseAnimation(float& time) const;
             /**
              * \brief Get duration of loaded animation
              * \return float
@@ -47,13 +131,52 @@ namespace AEngine
             /**
              * \brief Updated loaded animation
              * \param[in] dt delta time
+             * \note Same as Advance followed by Evaluate
+            */
+        void UpdateAnimation(float dt);
+            /**
+             * \brief Advances the animation time without evaluating a pose
+             * \param[in] dt delta time
             */
-        void Animator::UpdateAnimation(float dt);
+        void Advance(float dt);
+            /**
+             * \brief Evaluates the bone matrices at the current animation time
+            */
+        void Evaluate();
+            /**
+             * \brief Takes the bone matrices of another animator
+             * \param[in] other Animator playing the same animation at the same time
+            */
+        void CopyPose(const Animator& other);
+            /**
+             * \brief Whether the bone matrices have been evaluated since they were last discarded
+             * \return bool
+            */
+        bool HasPose() const;
+            /**
+             * \brief Marks the bone matrices as out of date, the next update must evaluate them
+            */
+        void DiscardPose();
+            /**
+             * \brief Get the loaded animation, or the last animation faded to
+             * \return Animation*, or nullptr if none is loaded
+            */
+        const Animation* GetAnimation() const;
+            /**
+             * \brief Get the current time of the loaded animation in ticks
+             * \return float
+            */
+        float GetTime() const;
             /**
              * \brief Get bone matrices for update time
              * \return vector<mat4>&
             */
         std::vector<Math::mat4>& GetFinalBoneMatrices();
+            /**
+             * \brief Get bone matrices for update time
+             * \return vector<mat4>&, always MaxBones long once an animation is loaded
+            */
+        const std::vector<Math::mat4>& GetFinalBoneMatrices() const;
             /**
              * \brief Get name of loaded animation
              * \return string&
@@ -63,21 +186,67 @@ namespace AEngine
 
     private:
             /**
-             * \brief Get Bone by name ID
-             * \return Bone*
+             * \struct Clip
+             * \brief An animation contributing to the pose and its cached sample
+            **/
+        struct Clip
+        {
+            const Animation* animation = nullptr;   // null if the clip is free
+            float time = 0.0f;
+            float weight = 0.0f;                    // fade weight, moves towards targetWeight
+            float targetWeight = 0.0f;
+            float fadeRate = 0.0f;                  // weight per second
+            float blendWeight = 1.0f;               // weight given by the blend space
+            float position = 0.0f;                  // position in the blend space
+            bool inBlendSpace = false;
+            bool additive = false;
+            bool removing = false;                  // layer is freed once faded out
+            bool sampled = false;                   // pose holds the sample at sampledTime
+            float sampledTime = 0.0f;
+            std::vector<BoneCursor> cursors;        // parallel to the skeleton
+            std::vector<BoneTransform> pose;        // parallel to the skeleton
+            std::vector<BoneTransform> reference;   // first frame of an additive layer
+        };
+
+            /**
+             * \brief Whether an animation shares the skeleton of the loaded animation
+            */
+        bool IsCompatible(const Animation& animation) const;
+            /**
+             * \brief Starts a clip playing an animation from its first frame
+             * \return Index of the clip, or -1 if every clip is in use
+            */
+        int Start(const Animation& animation, bool additive);
+            /**
+             * \brief Fades a clip towards a weight
+            */
+        void Fade(Clip& clip, float weight, float duration);
+            /**
+             * \brief Fades out every clip that is not an additive layer
+            */
+        void FadeOutBase(float duration);
+            /**
+             * \brief Computes the weight of each clip of the blend space from the blend parameter
+            */
+        void UpdateBlendWeights();
+            /**
+             * \brief Samples the local pose of a clip, unless it is cached at the clip's time
             */
-        const Bone* GetBone(const std::string& name) const;
+        void Sample(Clip& clip);
             /**
-             * \brief Calculates Bone transforms at a given time
-             * \param[in] node Node to search
-             * \param[in] parentTransform transform of parent
+             * \brief Returns the weight a clip contributes with
             */
-        void CalculateBoneTransform(const SceneNode* node, Math::mat4 parentTransform);
+        static float GetWeight(const Clip& clip);
 
         bool m_isPlaying = true;
-        const Animation* m_loadedAnimation;
-        float m_lastTime = -1.0f;
-        float m_currentTime;
+        bool m_hasPose = false;
+        const Animation* m_loadedAnimation = nullptr;
+        int m_primary = 0;                            // clip playing m_loadedAnimation
+        float m_blendParameter = 0.0f;
+        float m_blendPhase = 0.0f;                    // normalised time shared by the blend space
+        std::array<Clip, MaxClips> m_clips;
+        std::vector<BoneTransform> m_blended;         // parallel to the animation's skeleton
         std::vector<Math::mat4> m_FinalBoneMatrices;
+        std::vector<Math::mat4> m_globalTransforms;   // parallel to the animation's skeleton
     };
 }
\ No newline at end of file
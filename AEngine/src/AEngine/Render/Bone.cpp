@@ -1,111 +1,127 @@
 #include "Bone.h"
+#include <algorithm>
 
 namespace AEngine
 {
-    const std::string& Bone::GetBoneName() const
-	{ 
-		return m_name; 
-	}
-
-	const float Bone::GetScaleFactor(float currentTimeStamp, float nextTimeStamp, float animationTime) const
+	namespace
 	{
-		return (animationTime - currentTimeStamp) / (nextTimeStamp - currentTimeStamp);
-	}
-
-	const Math::mat4 Bone::InterpolatePosition(float animationTime) const
-	{
-		Math::vec3 position;
-
-			// Get closest index to animationTime
-		if (m_positions.size() > 1)
+			// Keys stepped through from the cursor before falling back to a binary search
+		constexpr Size_t MaxCursorSteps = 4;
+
+			/**
+			 * \brief Finds the keyframe at or before animationTime
+			 * \param[in] keys channel with at least two keyframes
+			 * \param[in] animationTime time of animation
+			 * \param[in] cursor keyframe found by the previous sample
+			 * \return index of the keyframe, always followed by another keyframe
+			**/
+		template <typename Key>
+		Size_t FindKey(const std::vector<Key>& keys, float animationTime, Size_t cursor)
 		{
-			unsigned int posIndex = 0;
-			for (unsigned int i = 0; i < m_positions.size() - 1; i++)
+			const Size_t last = keys.size() - 2;
+
+				// Playback moves forward a key or two each frame, so step on from the cached key
+			if (cursor <= last && keys[cursor].timeStamp <= animationTime)
 			{
-				if (animationTime < m_positions[i + 1].timeStamp)
+				const Size_t end = std::min(last, cursor + MaxCursorSteps);
+				for (Size_t i = cursor; i <= end; i++)
 				{
-					posIndex = i;
-					break;
+					if (animationTime < keys[i + 1].timeStamp)
+						return i;
 				}
 			}
 
-				// Calculate scale factor between two keyframes
-			float scaleFactor = GetScaleFactor(m_positions[posIndex].timeStamp, m_positions[posIndex + 1].timeStamp, animationTime);
-				// Interpolate between two vectors based on scale
-			position = Math::mix(m_positions[posIndex].position, m_positions[posIndex + 1].position, scaleFactor);
+				// Seeked or looped, search for the first key after animationTime
+			auto next = std::upper_bound(keys.begin() + 1, keys.end(), animationTime,
+				[](float time, const Key& key) { return time < key.timeStamp; });
+
+			return std::min(static_cast<Size_t>(next - keys.begin()) - 1, last);
 		}
-		else
-			position = m_positions[0].position;
+	}
 
-		return Math::translate(Math::mat4(1.0f), position);
+    const std::string& Bone::GetBoneName() const
+	{
+		return m_name;
 	}
 
-	const Math::mat4 Bone::InterpolateRotation(float animationTime) const
+	const float Bone::GetScaleFactor(float currentTimeStamp, float nextTimeStamp, float animationTime) const
 	{
-		Math::quat rotation;
+			// Clamp so times outside the channel hold the first or last key
+		return Math::clamp((animationTime - currentTimeStamp) / (nextTimeStamp - currentTimeStamp), 0.0f, 1.0f);
+	}
 
-			// Get closest index to animationTime
-		if (m_rotations.size() > 1)
-		{        
-			unsigned int rotIndex = 0;
-			for (unsigned int i = 0; i < m_rotations.size() - 1; i++)
-			{
-				if (animationTime < m_rotations[i + 1].timeStamp)
-				{
-					rotIndex = i;
-					break;
-				}
-			}
+	const Math::vec3 Bone::InterpolatePosition(float animationTime, Size_t& key) const
+	{
+		if (m_positions.size() == 1)
+			return m_positions[0].position;
 
-				// Calculate scale factor between two keyframes
-			float scaleFactor = GetScaleFactor(m_rotations[rotIndex].timeStamp, m_rotations[rotIndex + 1].timeStamp, animationTime);
-				// Interpolate between two quaternions based on scale 
-			rotation = Math::slerp(m_rotations[rotIndex].rotation, m_rotations[rotIndex + 1].rotation, scaleFactor);
-			rotation = Math::normalize(rotation);
-		}
-		else
-			rotation = m_rotations[0].rotation;
+		key = FindKey(m_positions, animationTime, key);
 
-		return Math::toMat4(rotation);
+			// Calculate scale factor between two keyframes
+		float scaleFactor = GetScaleFactor(m_positions[key].timeStamp, m_positions[key + 1].timeStamp, animationTime);
+			// Interpolate between two vectors based on scale
+		return Math::mix(m_positions[key].position, m_positions[key + 1].position, scaleFactor);
 	}
 
-	const Math::mat4 Bone::InterpolateScaling(float animationTime) const
+	const Math::quat Bone::InterpolateRotation(float animationTime, Size_t& key) const
 	{
-		Math::vec3 scale;
+		if (m_rotations.size() == 1)
+			return m_rotations[0].rotation;
 
-			// Get closest index to animationTime
-		if (m_scales.size() > 1)
-		{
-			unsigned int scaleIndex = 0;
-			for (unsigned int i = 0; i < m_scales.size() - 1; i++)
-			{
-				if (animationTime < m_scales[i + 1].timeStamp)
-				{
-					scaleIndex = i;
-					break;
-				}
-			}
+		key = FindKey(m_rotations, animationTime, key);
 
-				// Calculate scale factor between two keyframes
-			float scaleFactor = GetScaleFactor(m_scales[scaleIndex].timeStamp, m_scales[scaleIndex + 1].timeStamp, animationTime);
-				// Interpolate between two vectors based on scale
-			scale = Math::mix(m_scales[scaleIndex].scale, m_scales[scaleIndex + 1].scale, scaleFactor);
-		}
-		else
-			scale = m_scales[0].scale;
+			// Calculate scale factor between two keyframes
+		float scaleFactor = GetScaleFactor(m_rotations[key].timeStamp, m_rotations[key + 1].timeStamp, animationTime);
+			// Interpolate between two quaternions based on scale
+		return Math::normalize(Math::slerp(m_rotations[key].rotation, m_rotations[key + 1].rotation, scaleFactor));
+	}
+
+	const Math::vec3 Bone::InterpolateScaling(float animationTime, Size_t& key) const
+	{
+		if (m_scales.size() == 1)
+			return m_scales[0].scale;
+
+		key = FindKey(m_scales, animationTime, key);
 
-		return Math::scale(Math::mat4(1.0f), scale);
+			// Calculate scale factor between two keyframes
+		float scaleFactor = GetScaleFactor(m_scales[key].timeStamp, m_scales[key + 1].timeStamp, animationTime);
+			// Interpolate between two vectors based on scale
+		return Math::mix(m_scales[key].scale, m_scales[key + 1].scale, scaleFactor);
 	}
 
     const Math::mat4 Bone::GetLocalTransform(float animationTime) const
-	{ 
+	{
+			// A cursor past the end of every channel always takes the binary search
+		BoneCursor cursor{ SIZE_MAX, SIZE_MAX, SIZE_MAX };
+		return GetLocalTransform(animationTime, cursor);
+	}
+
+    const Math::mat4 Bone::GetLocalTransform(float animationTime, BoneCursor& cursor) const
+	{
+		return Compose(Sample(animationTime, cursor));
+	}
+
+	const BoneTransform Bone::Sample(float animationTime, BoneCursor& cursor) const
+	{
 			// Interpolate all transforms
-		Math::mat4 translation = InterpolatePosition(animationTime);
-		Math::mat4 rotation = InterpolateRotation(animationTime);
-		Math::mat4 scale = InterpolateScaling(animationTime);
-		translation * rotation * scale;
+		return {
+			InterpolatePosition(animationTime, cursor.position),
+			InterpolateRotation(animationTime, cursor.rotation),
+			InterpolateScaling(animationTime, cursor.scale)
+		};
+	}
+
+	const Math::mat4 Bone::Compose(const BoneTransform& transform)
+	{
+			// Compose translation * rotation * scale directly, scaling the rotation's columns
+		const Math::mat3 basis = Math::mat3_cast(transform.rotation);
+		Math::mat4 matrix;
+		matrix[0] = Math::vec4(basis[0] * transform.scale.x, 0.0f);
+		matrix[1] = Math::vec4(basis[1] * transform.scale.y, 0.0f);
+		matrix[2] = Math::vec4(basis[2] * transform.scale.z, 0.0f);
+		matrix[3] = Math::vec4(transform.translation, 1.0f);
 
 			// return a final transform
-		return translation * rotation * scale;
+		return matrix;
 	}
-}
\ No newline at end of file
+}
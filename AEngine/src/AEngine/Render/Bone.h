@@ -8,6 +8,7 @@
 #include <vector>
 #include <string>
 
+#include "AEngine/Core/Types.h"
 #include "AEngine/Math/Math.h"
 
 namespace AEngine
@@ -42,6 +43,32 @@ namespace AEngine
 		float timeStamp;
 	};
 
+		/**
+		 * \struct BoneCursor
+		 * \brief Caches the last keyframe used for each channel of a Bone
+		 * \details
+		 * Playback advances a few keys at most per frame, so sampling from the cached keys
+		 * avoids searching the whole channel. Seeking or looping falls back to a binary search.
+		 * \note Each animator owns its own cursors, as Bones are shared between animators
+		**/
+	struct BoneCursor
+	{
+		Size_t position = 0;
+		Size_t rotation = 0;
+		Size_t scale = 0;
+	};
+
+		/**
+		 * \struct BoneTransform
+		 * \brief Local transform of a bone, kept apart so poses can be blended
+		**/
+	struct BoneTransform
+	{
+		Math::vec3 translation;
+		Math::quat rotation;
+		Math::vec3 scale;
+	};
+
 		/**
 		 * \class Bone
 		 * \brief Stores animation data for a Bone
@@ -52,8 +79,28 @@ namespace AEngine
 			/**
 			 * \brief Update and return a bone transform
 			 * \param[in] animationTime current time in animation
+			 * \note Searches every channel, prefer the cursor overload during playback
 			**/
 		const Math::mat4 GetLocalTransform(float animationTime) const;
+			/**
+			 * \brief Update and return a bone transform, starting from cached keyframes
+			 * \param[in] animationTime current time in animation
+			 * \param[in,out] cursor keyframes used by the previous sample, updated for this sample
+			**/
+		const Math::mat4 GetLocalTransform(float animationTime, BoneCursor& cursor) const;
+			/**
+			 * \brief Samples the translation, rotation and scale of a bone without composing them
+			 * \param[in] animationTime current time in animation
+			 * \param[in,out] cursor keyframes used by the previous sample, updated for this sample
+			 * \return BoneTransform
+			**/
+		const BoneTransform Sample(float animationTime, BoneCursor& cursor) const;
+			/**
+			 * \brief Composes translation * rotation * scale
+			 * \param[in] transform to compose
+			 * \return mat4
+			**/
+		static const Math::mat4 Compose(const BoneTransform& transform);
 			/**
 			 * \brief Return a bone name
 			 * \return string
@@ -80,21 +127,24 @@ namespace AEngine
 			/**
 			 * \brief Interpolate a postion between two keyframes
 			 * \param[in] animationTime time of animation
-			 * \return position transform
+			 * \param[in,out] key cached keyframe index
+			 * \return position
 			**/
-		const Math::mat4 InterpolatePosition(float animationTime) const;
+		const Math::vec3 InterpolatePosition(float animationTime, Size_t& key) const;
 			/**
 			 * \brief Interpolate a rotation between two keyframes
 			 * \param[in] animationTime time of animation
-			 * \return rotation transform
+			 * \param[in,out] key cached keyframe index
+			 * \return rotation
 			**/
-		const Math::mat4 InterpolateRotation(float animationTime) const;
+		const Math::quat InterpolateRotation(float animationTime, Size_t& key) const;
 			/**
 			 * \brief Interpolate a scale between two keyframes
 			 * \param[in] animationTime time of animation
-			 * \return scale transform
+			 * \param[in,out] key cached keyframe index
+			 * \return scale
 			**/
-		const Math::mat4 InterpolateScaling(float animationTime) const;
+		const Math::vec3 InterpolateScaling(float animationTime, Size_t& key) const;
 
 	};
 }
\ No newline at end of file
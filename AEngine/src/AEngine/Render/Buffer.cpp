@@ -5,6 +5,7 @@
 #include "Buffer.h"
 #include "AEngine/Core/Logger.h"
 #include "AEngine/Render/RenderCommand.h"
+#include "Platform/Null/NullBuffer.h"
 #include "Platform/OpenGL/OpenGLBuffer.h"
 
 namespace
@@ -12,33 +13,51 @@ namespace
 	static constexpr unsigned int g_aeBufferElementTypeCounts[] = {
 		1, 2, 3, 4,   // bytes
 		1, 2, 3, 4,   // ubytes
+		1, 2, 3, 4,   // shorts
+		1, 2, 3, 4,   // ushorts
 		1, 2, 3, 4,   // ints
 		1, 2, 3, 4,   // uints
+		1, 2, 3, 4,   // halves
 		1, 2, 3, 4,   // floats
-		9, 16         // mat3, mat4
+		9, 16,        // mat3, mat4
+		4             // int 10_10_10_2
 	};
 
 	static constexpr AEngine::BufferElementPrecision g_aeBufferElementTypePrecisions[] = {
 #define BEP AEngine::BufferElementPrecision
 		BEP::Integer, BEP::Integer, BEP::Integer, BEP::Integer,   // bytes
 		BEP::Integer, BEP::Integer, BEP::Integer, BEP::Integer,   // ubytes
+		BEP::Integer, BEP::Integer, BEP::Integer, BEP::Integer,   // shorts
+		BEP::Integer, BEP::Integer, BEP::Integer, BEP::Integer,   // ushorts
 		BEP::Integer, BEP::Integer, BEP::Integer, BEP::Integer,   // ints
 		BEP::Integer, BEP::Integer, BEP::Integer, BEP::Integer,   // uints
+		BEP::Float,   BEP::Float,   BEP::Float,   BEP::Float,     // halves
 		BEP::Float,   BEP::Float,   BEP::Float,   BEP::Float,     // floats
-		BEP::Float,   BEP::Float                                  // mat3, mat4
+		BEP::Float,   BEP::Float,                                 // mat3, mat4
+		BEP::Float                                                // int 10_10_10_2, read as floats
 #undef BEP
 	};
 
+	// size of the whole element in bytes
 	static constexpr AEngine::Intptr_t g_aeBufferElementTypeSizes[] = {
 #define SO(x) sizeof(x)
-		SO(char),          SO(char),          SO(char),          SO(char),            // bytes
-		SO(unsigned char), SO(unsigned char), SO(unsigned char), SO(unsigned char),   // ubytes
-		SO(int),           SO(int),           SO(int),           SO(int),             // ints
-		SO(unsigned int),  SO(unsigned int),  SO(unsigned int),  SO(unsigned int),    // uints
-		SO(float),         SO(float),         SO(float),         SO(float),           // floats
-		SO(float),         SO(float)                                                  // mat3, mat4
+		1 * SO(char),           2 * SO(char),           3 * SO(char),           4 * SO(char),             // bytes
+		1 * SO(unsigned char),  2 * SO(unsigned char),  3 * SO(unsigned char),  4 * SO(unsigned char),    // ubytes
+		1 * SO(short),          2 * SO(short),          3 * SO(short),          4 * SO(short),            // shorts
+		1 * SO(unsigned short), 2 * SO(unsigned short), 3 * SO(unsigned short), 4 * SO(unsigned short),   // ushorts
+		1 * SO(int),            2 * SO(int),            3 * SO(int),            4 * SO(int),              // ints
+		1 * SO(unsigned int),   2 * SO(unsigned int),   3 * SO(unsigned int),   4 * SO(unsigned int),     // uints
+		1 * SO(unsigned short), 2 * SO(unsigned short), 3 * SO(unsigned short), 4 * SO(unsigned short),   // halves
+		1 * SO(float),          2 * SO(float),          3 * SO(float),          4 * SO(float),            // floats
+		9 * SO(float),          16 * SO(float),                                                           // mat3, mat4
+		SO(AEngine::Uint32)                                                                               // int 10_10_10_2
 #undef SO
 	};
+
+	static constexpr const char* g_aeUniformBlockNames[] = {
+		"CameraBlock",
+		"SkeletonBlock"
+	};
 }
 
 namespace AEngine
@@ -114,10 +133,11 @@ namespace AEngine
 	{
 		// for each element in layout, add the size of the element to the stride
 		// and set the offset of the element to the current stride
+		m_stride = 0;
 		for (auto& data : m_layout)
 		{
 			data.m_offset = m_stride;
-			m_stride += data.m_count * g_aeBufferElementTypeSizes[static_cast<int>(data.m_type)];
+			m_stride += g_aeBufferElementTypeSizes[static_cast<int>(data.m_type)];
 		}
 	}
 
@@ -130,6 +150,8 @@ namespace AEngine
 		{
 		case RenderLibrary::OpenGL:
 			return MakeShared<OpenGLVertexBuffer>();
+		case RenderLibrary::Null:
+			return MakeShared<NullVertexBuffer>();
 		default:
 			AE_LOG_FATAL("VertexBuffer::Create::RenderLibrary::Error -> None selected");
 		}
@@ -148,14 +170,64 @@ namespace AEngine
 //--------------------------------------------------------------------------------
 // IndexBuffer
 //--------------------------------------------------------------------------------
+	IndexBuffer::IndexBuffer()
+		: m_indexType{ IndexType::Uint32 }
+	{
+
+	}
+
+	IndexType IndexBuffer::GetIndexType() const
+	{
+		return m_indexType;
+	}
+
+	Intptr_t IndexBuffer::GetIndexSize(IndexType type)
+	{
+		return type == IndexType::Uint16 ? sizeof(Uint16) : sizeof(Uint32);
+	}
+
 	SharedPtr<IndexBuffer> IndexBuffer::Create()
 	{
 		switch (RenderCommand::GetLibrary())
 		{
 		case RenderLibrary::OpenGL:
 			return MakeShared<OpenGLIndexBuffer>();
+		case RenderLibrary::Null:
+			return MakeShared<NullIndexBuffer>();
 		default:
 			AE_LOG_FATAL("IndexBuffer::Create::RenderLibrary::Error -> None selected");
 		}
 	}
+
+//--------------------------------------------------------------------------------
+// UniformBuffer
+//--------------------------------------------------------------------------------
+	UniformBuffer::UniformBuffer(UniformBlock block)
+		: m_block{ block }
+	{
+
+	}
+
+	SharedPtr<UniformBuffer> UniformBuffer::Create(UniformBlock block)
+	{
+		switch (RenderCommand::GetLibrary())
+		{
+		case RenderLibrary::OpenGL:
+			return MakeShared<OpenGLUniformBuffer>(block);
+		case RenderLibrary::Null:
+			return MakeShared<NullUniformBuffer>(block);
+		default:
+			AE_LOG_FATAL("UniformBuffer::Create::RenderLibrary::Error -> None selected");
+		}
+	}
+
+	UniformBlock UniformBuffer::GetBlock() const
+	{
+		return m_block;
+	}
+
+	const char* UniformBuffer::GetBlockName(UniformBlock block)
+	{
+		return g_aeUniformBlockNames[static_cast<int>(block)];
+	}
 }
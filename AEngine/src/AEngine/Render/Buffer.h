@@ -221,10 +221,109 @@ namespace AEngine
 			 * \param[in] usage Usage of the buffer
 			*/
 		virtual void SetData(const Uint32* data, Intptr_t count, BufferUsage usage) = 0;
+			/**
+			 * \brief Set the data of the index buffer from 16-bit indices
+			 * \param[in] data Pointer to the data to be uploaded
+			 * \param[in] count the number of elements in the data
+			 * \param[in] usage Usage of the buffer
+			*/
+		virtual void SetData(const Uint16* data, Intptr_t count, BufferUsage usage) = 0;
+			/**
+			 * \brief Returns the width of the indices last uploaded
+			 * \return Index width, passed to RenderCommand::DrawIndexed
+			*/
+		IndexType GetIndexType() const;
+			/**
+			 * \brief Returns the size of one index in bytes
+			 * \param[in] type Index width
+			 * \return Size of one index in bytes
+			*/
+		static Intptr_t GetIndexSize(IndexType type);
 			/**
 			 * \brief Creates a new index buffer
 			 * \return Shared pointer to the index buffer
 			*/
 		static SharedPtr<IndexBuffer> Create();
+
+	protected:
+		IndexBuffer();
+			/**
+			 * \brief Width of the indices in the index buffer
+			*/
+		IndexType m_indexType;
+	};
+
+		/**
+		 * \class UniformBuffer
+		 * \brief Rendering API agnostic uniform buffer
+		 * \details
+		 * A uniform buffer backs one of the engine uniform blocks, allowing data shared by
+		 * many shaders to be uploaded once rather than per shader.
+		*/
+	class UniformBuffer
+	{
+	public:
+		virtual ~UniformBuffer() = default;
+			/**
+			 * \brief Binds the uniform buffer to the binding point of its block
+			*/
+		virtual void Bind() const = 0;
+			/**
+			 * \brief Binds part of the uniform buffer to the binding point of its block
+			 * \param[in] offset Offset in bytes to the start of the range
+			 * \param[in] bytes Size of the range in bytes
+			 * \note Offsets must be a multiple of the uniform buffer offset alignment, 256 bytes is always safe
+			*/
+		virtual void BindRange(Intptr_t offset, Intptr_t bytes) const = 0;
+			/**
+			 * \brief Unbinds the uniform buffer from the binding point of its block
+			*/
+		virtual void Unbind() const = 0;
+			/**
+			 * \brief Returns the size of the uniform buffer in bytes
+			 * \return Size of the uniform buffer in bytes
+			*/
+		virtual Intptr_t Size() const = 0;
+			/**
+			 * \brief Set the data of the uniform buffer
+			 * \param[in] data Pointer to the data to be uploaded
+			 * \param[in] bytes Size of the data in bytes
+			 * \param[in] usage Usage of the buffer
+			*/
+		virtual void SetData(const void* data, Intptr_t bytes, BufferUsage usage) = 0;
+			/**
+			 * \brief Sets a portion of the uniform buffer data
+			 * \param[in] data Pointer to the data to be uploaded
+			 * \param[in] bytes Size of the data in bytes
+			 * \param[in] offset Offset in bytes to start uploading the data
+			*/
+		virtual void SetSubData(const void* data, Intptr_t bytes, Intptr_t offset = 0) = 0;
+			/**
+			 * \brief Returns the block the uniform buffer backs
+			 * \return Block of the uniform buffer
+			*/
+		UniformBlock GetBlock() const;
+			/**
+			 * \brief Returns the name a shader must give a block to read from it
+			 * \param[in] block to get the name of
+			 * \return Name of the block in shader source
+			*/
+		static const char* GetBlockName(UniformBlock block);
+			/**
+			 * \brief Creates a new uniform buffer
+			 * \param[in] block The block the buffer backs
+			 * \return Shared pointer to the uniform buffer
+			*/
+		static SharedPtr<UniformBuffer> Create(UniformBlock block);
+
+	protected:
+			/**
+			 * \param[in] block The block the buffer backs
+			*/
+		explicit UniformBuffer(UniformBlock block);
+			/**
+			 * \brief Block the uniform buffer backs
+			*/
+		UniformBlock m_block;
 	};
 }
@@ -5,6 +5,7 @@
 #include "AEngine/Math/Math.h"
 #include "Font.h"
 #include "AEngine/Core/Logger.h"
+#include "AEngine/Render/RenderCommand.h"
 
 #include "AEngine/Core/Application.h"
 
@@ -49,7 +50,7 @@ namespace AEngine
 	}
 
 	Font::Font(const std::string& ident, const std::string& path)
-		: Asset(ident, path)
+		: Asset(ident, path), m_vbo{ 0 }, m_vao{ 0 }
 	{
 		m_textShader = Shader::Create(textCode);
 		Load(path);
@@ -72,21 +73,30 @@ namespace AEngine
 		}
 
 		FT_Set_Pixel_Sizes(face, 0, 48);
-		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+			// glyph metrics are still loaded headless, only the textures are skipped
+		const bool headless = RenderCommand::GetLibrary() == RenderLibrary::Null;
+		if (!headless)
+		{
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+		}
 
 		for (unsigned char c = 0; c < 128; c++)
 		{
 			if (FT_Load_Char(face, c, FT_LOAD_RENDER))
 				AE_LOG_WARN("TextManager::Load::Warning -> Failed to load a character");
 
-			unsigned int texture;
-			glGenTextures(1, &texture);
-			glBindTexture(GL_TEXTURE_2D, texture);
-			glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, face->glyph->bitmap.width, face->glyph->bitmap.rows, 0, GL_RED, GL_UNSIGNED_BYTE, face->glyph->bitmap.buffer);
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+			unsigned int texture = 0;
+			if (!headless)
+			{
+				glGenTextures(1, &texture);
+				glBindTexture(GL_TEXTURE_2D, texture);
+				glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, face->glyph->bitmap.width, face->glyph->bitmap.rows, 0, GL_RED, GL_UNSIGNED_BYTE, face->glyph->bitmap.buffer);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+			}
 
 			Character character = {
 				texture,
@@ -96,14 +106,17 @@ namespace AEngine
 			};
 			m_fontData.insert(std::pair<char, Character>(c, character));
 		}
-		glBindTexture(GL_TEXTURE_2D, 0);
 
 		FT_Done_Face(face);
 		FT_Done_FreeType(ft);
 
 		AE_LOG_TRACE("TextManager::Load::Success -> {}", fontPath);
 
-		GenerateFont();
+		if (!headless)
+		{
+			glBindTexture(GL_TEXTURE_2D, 0);
+			GenerateFont();
+		}
 	}
 
 	Font::~Font()
@@ -132,6 +145,12 @@ namespace AEngine
 
 	void Font::Render(bool billboard, bool screenspace, const PerspectiveCamera* camera, std::string text, Math::mat4 transform, Math::vec4 colour)
 	{
+			// the font was loaded without a graphics context
+		if (m_vao == 0)
+		{
+			return;
+		}
+
 		glDisable(GL_DEPTH_TEST);
 
 		Math::vec2 windowDimensions = Application::Instance().GetWindow()->GetSize();
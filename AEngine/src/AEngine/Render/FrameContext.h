@@ -0,0 +1,30 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+ * \brief Per-frame state shared by every draw
+*/
+#pragma once
+#include "AEngine/Math/Math.h"
+
+namespace AEngine
+{
+	class CubeMapTexture;
+	class PerspectiveCamera;
+
+		/**
+		 * \struct FrameContext
+		 * \brief State that is constant for a frame, gathered once before any pass
+		 * \details
+		 * This is built by the scene at the start of its update and passed down to the
+		 * render systems, so draws do not need to query the scene themselves.
+		 * \note The pointers are non-owning and only valid for the frame it was built
+		*/
+	struct FrameContext
+	{
+		const PerspectiveCamera* camera{ nullptr };       ///< Camera the frame is rendered from
+		const CubeMapTexture* environment{ nullptr };     ///< Cubemap used for reflections, may be null
+		Math::vec3 cameraPosition{ 0.0f };                ///< World position of the camera
+		Math::vec3 lightPosition{ 10.0f, 10.0f, 10.0f };  ///< World position of the scene light
+		Math::vec3 lightColor{ 1.0f, 1.0f, 1.0f };        ///< Colour of the scene light
+	};
+}
@@ -1,5 +1,6 @@
 #include "Framebuffer.h"
 #include "AEngine/Core/Logger.h"
+#include "Platform/Null/NullFramebuffer.h"
 #include "Platform/OpenGL/OpenGLFramebuffer.h"
 #include "RenderCommand.h"
 
@@ -13,6 +14,8 @@ namespace AEngine
 		{
 		case RenderLibrary::OpenGL:
 			return MakeShared<OpenGLFramebuffer>(windowSize);
+		case RenderLibrary::Null:
+			return MakeShared<NullFramebuffer>(windowSize);
 		default:
 			AE_LOG_FATAL("VertexArray::Create::Error -> Invalid RenderLibrary");
 		}
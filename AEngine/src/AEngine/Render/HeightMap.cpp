@@ -1,4 +1,3 @@
-#include <stb/stb_image.h>
 #include <stdexcept>
 
 #include "Heightmap.h"
@@ -15,32 +14,44 @@ namespace AEngine
 		return MakeShared<HeightMap>(ident, fname);
 	}
 
+	SharedPtr<Image> HeightMap::Decode(const std::string& fname)
+	{
+		// rows are stored bottom up so the first row sits at the lowest z
+		return Image::Load(fname, true);
+	}
+
+	SharedPtr<HeightMap> HeightMap::Create(const std::string& ident, const std::string& fname, const Image& image)
+	{
+		return MakeShared<HeightMap>(ident, fname, image);
+	}
+
 	HeightMap::HeightMap(const std::string& ident, const std::string& path)
+		: HeightMap(ident, path, *Decode(path))
+	{
+
+	}
+
+	HeightMap::HeightMap(const std::string& ident, const std::string& path, const Image& image)
 		: Asset(ident, path), m_vertexArray{ nullptr }, m_data{ },
 		  m_min{std::numeric_limits<float>::max()}, m_max{std::numeric_limits<float>::min()}, m_range{0.0f}
 	{
 		AE_LOG_DEBUG("HeightMap::Constructor");
 
-		// for stb_image
-		int width = 0;
-		int height = 0;
-		int numChannels = 0;
-		unsigned char* imgData = nullptr;
+		if (!image.IsValid())
+		{
+			AE_LOG_FATAL("HeightMap::Constructor -> failed to load '{}'", path);
+		}
 
-		// load image
-		stbi_set_flip_vertically_on_load(true);
-		imgData = stbi_load(path.c_str(), &width, &height, &numChannels, 0);
-		if (width != height)
+		if (image.GetWidth() != image.GetHeight())
 		{
 			AE_LOG_FATAL("HeightMap::Constructor -> width and height are not 1:1");
 		}
 
 		// set up height data
-		m_sideLength = width;
+		m_sideLength = image.GetWidth();
 		m_size = m_sideLength * m_sideLength;
 		m_data.resize(m_size);
-		ImportImageDataIntoHeightData(imgData, numChannels);
-		stbi_image_free(imgData);
+		ImportImageDataIntoHeightData(image.GetData(), image.GetChannels());
 
 		// normalise and centralise
 		NormaliseHeightData();
@@ -55,12 +66,12 @@ namespace AEngine
 		AE_LOG_DEBUG("HeightMap::Destructor");
 	}
 
-	void HeightMap::Render(const Math::mat4 &transform, const Shader &shader, const Math::mat4& projectionView)
+	void HeightMap::Render(const Math::mat4 &transform, const Shader &shader)
 	{
-		Render(transform, shader, projectionView, {}, {});
+		Render(transform, shader, {}, {});
 	}
 
-	void HeightMap::Render(const Math::mat4 &transform,  const Shader &shader, const Math::mat4& projectionView, const std::vector<std::string> &textures, const std::vector<float> &yRanges)
+	void HeightMap::Render(const Math::mat4 &transform,  const Shader &shader, const std::vector<std::string> &textures, const std::vector<float> &yRanges)
 	{
 		Size_t tsize = textures.size();
 		if (tsize > 3)
@@ -70,7 +81,6 @@ namespace AEngine
 
 		shader.Bind();
 		shader.SetUniformMat4("u_transform", transform);
-		shader.SetUniformMat4("u_projectionView", projectionView);
 		shader.SetUniformFloat("u_tilingFactor", 25.0f);
 		shader.SetUniformFloat("u_minLightingIntensity", 0.6f);
 		shader.SetUniformFloat("u_maxLightingIntensity", 2.5f);
@@ -118,7 +128,7 @@ namespace AEngine
 //--------------------------------------------------------------------------------
 // Private
 //--------------------------------------------------------------------------------
-	void HeightMap::ImportImageDataIntoHeightData(unsigned char *imgData, int numChannels)
+	void HeightMap::ImportImageDataIntoHeightData(const unsigned char *imgData, int numChannels)
 	{
 		for (unsigned int i = 0; i < m_size; i++)
 		{
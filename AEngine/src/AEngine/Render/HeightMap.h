@@ -6,6 +6,7 @@
 #pragma once
 #include "AEngine/Core/Types.h"
 #include "AEngine/Math/Math.h"
+#include "AEngine/Render/Image.h"
 #include "AEngine/Render/VertexArray.h"
 #include "AEngine/Resource/Asset.h"
 #include "Shader.h"
@@ -18,6 +19,11 @@ namespace AEngine
 	class HeightMap : public Asset
 	{
 	public:
+			/**
+			 * \brief Type decoded off the main thread by AssetManager::LoadAsync
+			*/
+		using Source = Image;
+
 			/**
 			 * \param[in] data of the heightmap in row-major
 			 * \param[in] size of one side of square heightmap
@@ -26,14 +32,14 @@ namespace AEngine
 			 * the heightmap is assumed to be square
 			*/
 		HeightMap::HeightMap(const std::string& ident, const std::string& path);
+		HeightMap(const std::string& ident, const std::string& path, const Image& image);
 		HeightMap(const HeightMap& copy);
 		~HeightMap();
 
-		void Render(const Math::mat4& transform, const Shader& shader, const Math::mat4& projectionView);
+		void Render(const Math::mat4& transform, const Shader& shader);
 		void Render(
 			const Math::mat4& transform,
 			const Shader& shader,
-			const Math::mat4& projectionView,
 			const std::vector<std::string>& textures,
 			const std::vector<float>& yRanges
 		);
@@ -44,6 +50,14 @@ namespace AEngine
 		void CentraliseHeightData();
 
 		static SharedPtr<HeightMap> Create(const std::string& ident, const std::string& fname);
+			/**
+			 * \brief Decodes the heightmap image, safe to call from any thread
+			*/
+		static SharedPtr<Image> Decode(const std::string& fname);
+			/**
+			 * \brief Creates the heightmap from an image returned by Decode()
+			*/
+		static SharedPtr<HeightMap> Create(const std::string& ident, const std::string& fname, const Image& image);
 
 	private:
 		std::vector<float> m_data;
@@ -68,7 +82,7 @@ namespace AEngine
 			**/
 		float SamplePoint(Size_t xCoord, Size_t zCoord) const;
 
-		void ImportImageDataIntoHeightData(unsigned char* imgData, int numChannels);
+		void ImportImageDataIntoHeightData(const unsigned char* imgData, int numChannels);
 		void NormaliseHeightData();
 	};
 }
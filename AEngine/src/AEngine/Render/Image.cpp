@@ -0,0 +1,66 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#include "Image.h"
+#include "AEngine/Core/Logger.h"
+#include <stb/stb_image.h>
+
+namespace AEngine
+{
+	Image::Image()
+		: m_data{ nullptr }, m_width{ 0 }, m_height{ 0 }, m_channels{ 0 }
+	{
+
+	}
+
+	Image::~Image()
+	{
+		stbi_image_free(m_data);
+	}
+
+	SharedPtr<Image> Image::Load(const std::string& path, bool flipVertically)
+	{
+		SharedPtr<Image> image(new Image());
+
+		// the thread flag overrides the global one, so concurrent loads cannot change each others flip
+		stbi_set_flip_vertically_on_load_thread(flipVertically);
+		image->m_data = stbi_load(path.c_str(), &image->m_width, &image->m_height, &image->m_channels, 0);
+		if (!image->m_data)
+		{
+			AE_LOG_ERROR("Image::Load::Failed -> {}", path);
+		}
+
+		return image;
+	}
+
+	bool Image::IsValid() const
+	{
+		return m_data != nullptr;
+	}
+
+	int Image::GetWidth() const
+	{
+		return m_width;
+	}
+
+	int Image::GetHeight() const
+	{
+		return m_height;
+	}
+
+	int Image::GetChannels() const
+	{
+		return m_channels;
+	}
+
+	const unsigned char* Image::GetData() const
+	{
+		return m_data;
+	}
+
+	Size_t Image::GetSize() const
+	{
+		return static_cast<Size_t>(m_width) * m_height * m_channels;
+	}
+}
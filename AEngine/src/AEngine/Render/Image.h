@@ -0,0 +1,63 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#pragma once
+#include "AEngine/Core/Types.h"
+#include <string>
+
+namespace AEngine
+{
+		/**
+		 * \class Image
+		 * \brief Decoded pixel data read from an image file
+		 * \details
+		 * Decoding holds no graphics state, so images may be loaded on any thread
+		 * and handed to the main thread to be uploaded.
+		*/
+	class Image
+	{
+	public:
+		~Image();
+
+		Image(const Image&) = delete;
+		Image& operator=(const Image&) = delete;
+
+			/**
+			 * \brief Decodes an image file
+			 * \param[in] path to the image
+			 * \param[in] flipVertically stores the bottom row first
+			 * \return The decoded image, check IsValid() for failure
+			 * \note The flip only applies to this call, so it is safe to use from several threads
+			*/
+		static SharedPtr<Image> Load(const std::string& path, bool flipVertically = false);
+
+			/**
+			 * \brief Checks that the image was decoded
+			 * \retval true if the pixel data is available
+			*/
+		bool IsValid() const;
+		int GetWidth() const;
+		int GetHeight() const;
+			/**
+			 * \brief Gets the number of 8-bit channels per pixel
+			*/
+		int GetChannels() const;
+			/**
+			 * \brief Gets the pixel data, rows are tightly packed
+			*/
+		const unsigned char* GetData() const;
+			/**
+			 * \brief Gets the size of the pixel data in bytes
+			*/
+		Size_t GetSize() const;
+
+	private:
+		Image();
+
+		unsigned char* m_data;
+		int m_width;
+		int m_height;
+		int m_channels;
+	};
+}
@@ -4,10 +4,8 @@
 #include "AEngine/Render/RenderCommand.h"
 #include "Platform/Assimp/AssimpMaterial.h"
 #include "AEngine/Render/Model.h"
-#include "AEngine/Scene/SceneManager.h"
-#include "AEngine/Scene/Entity.h"
-#include "AEngine/Skybox/Skybox.h"
-#include "AEngine/Render/RenderCommand.h"
+#include "AEngine/Skybox/CubeMapTexture.h"
+#include <string>
 
 namespace AEngine
 {
@@ -23,6 +21,7 @@ namespace AEngine
 	void Material::AddTexture(TextureType type, SharedPtr<Texture> texture)
 	{
 		m_textures[type] = texture;
+		m_uniforms.shader = nullptr;
 
 		if(type > 11)
 			m_isPBR = true;
@@ -46,9 +45,10 @@ namespace AEngine
 		return false;
 	}
 
-	void Material::Bind(const Shader& shader) const
+	void Material::Bind(const Shader& shader, const FrameContext& context) const
 	{
-		shader.SetUniformFloat4("u_baseColor", m_properties.baseColor);
+		const Uniforms& uniforms = GetUniforms(shader);
+		shader.SetUniform(uniforms.baseColor, m_properties.baseColor);
 		//shader.SetUniformFloat3("u_specularColor", m_properties.specularColor);
 		//shader.SetUniformFloat3("u_ambientColor", m_properties.ambientColor);
 		//shader.SetUniformFloat3("u_emissionColor", m_properties.emissionColor);
@@ -57,9 +57,9 @@ namespace AEngine
 		//shader.SetUniformFloat("u_ior", m_properties.ior);
 
 		if (m_textures.size() > 0)
-			shader.SetUniformInteger("u_hasTextures", 1);
+			shader.SetUniform(uniforms.hasTextures, 1);
 		else
-			shader.SetUniformInteger("u_hasTextures", 0);
+			shader.SetUniform(uniforms.hasTextures, 0);
 
 		unsigned int i = 0;
 		for(const auto& pair : m_textures)
@@ -68,21 +68,34 @@ namespace AEngine
 				continue;
 
 			pair.second->Bind(i);
-			shader.SetUniformInteger("u_texture" + pair.first, i);
+			shader.SetUniform(uniforms.textures[pair.first - Unknown], static_cast<int>(i));
 			i++;
 		}
 
-		SharedPtr<CubeMapTexture> hdr = SceneManager::GetActiveScene()->GetEntity("Skybox").GetComponent<SkyboxComponent>()->skybox->GetCubeMap();
-		if (hdr)
+		// the camera position is read from the CameraBlock
+		if (context.environment)
 		{
-			Math::vec3 camPos = SceneManager::GetActiveScene()->GetDebugCamera().GetPosition();
-
-			shader.SetUniformFloat3("u_camPos", camPos);
-			shader.SetUniformInteger("u_hdr", i);
-			hdr->Bind(i);
+			shader.SetUniform(uniforms.hdr, static_cast<int>(i));
+			context.environment->Bind(i);
 		}
 	}
 
+	const Material::Uniforms& Material::GetUniforms(const Shader& shader) const
+	{
+		if (m_uniforms.shader == &shader)
+			return m_uniforms;
+
+		// materials are drawn with the same shader frame after frame, so names are only looked up on a change
+		m_uniforms.shader = &shader;
+		m_uniforms.baseColor = shader.GetUniformHandle("u_baseColor");
+		m_uniforms.hasTextures = shader.GetUniformHandle("u_hasTextures");
+		m_uniforms.hdr = shader.GetUniformHandle("u_hdr");
+		for (const auto& pair : m_textures)
+			m_uniforms.textures[pair.first - Unknown] = shader.GetUniformHandle("u_texture" + std::to_string(pair.first));
+
+		return m_uniforms;
+	}
+
 	void Material::Unbind(const Shader& shader) const
 	{
 		unsigned int i = 0;
@@ -5,10 +5,12 @@
 
 #pragma once
 #include "AEngine/Core/Types.h"
+#include "FrameContext.h"
 #include "Shader.h"
 #include "Texture.h"
 #include "AEngine/Resource/Asset.h"
 
+#include <array>
 #include <map>
 
 namespace AEngine
@@ -104,9 +106,10 @@ namespace AEngine
 			/**
 			 * \brief Bind a materials textures and properties
 			 * \param[in] shader shared ptr to shader
+			 * \param[in] context of the current frame, supplies the environment map
 			 * \todo Remove shader --> Material should hold shader
 			**/
-		void Bind(const Shader& shader) const;
+		void Bind(const Shader& shader, const FrameContext& context) const;
 			/**
 			 * \brief Unbind a materials textures
 			 * \param[in] shader shared ptr to shader
@@ -132,5 +135,27 @@ namespace AEngine
 		SharedPtr<Shader> m_shader;
 		MaterialProperties m_properties;
 		bool m_isPBR = false;
+
+	private:
+			/**
+			 * \struct Uniforms
+			 * \brief Handles of the uniforms Bind sets, resolved for one shader
+			**/
+		struct Uniforms
+		{
+			const Shader* shader = nullptr;   // shader the handles belong to, null if unresolved
+			UniformHandle baseColor;
+			UniformHandle hasTextures;
+			UniformHandle hdr;
+			std::array<UniformHandle, AmbientOcclusion - Unknown + 1> textures;   // indexed by type - Unknown
+		};
+
+			/**
+			 * \brief Returns the uniform handles for a shader, resolving them if it was not the last bound
+			 * \param[in] shader to resolve the handles for
+			**/
+		const Uniforms& GetUniforms(const Shader& shader) const;
+
+		mutable Uniforms m_uniforms;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,222 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#include "MeshBuilder.h"
+#include "Model.h"
+#include <glm/gtc/packing.hpp>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace
+{
+		// half floats keep at least 1/1024 precision in this range, enough for texels of a 1024 texture
+	constexpr float g_aeHalfTexCoordLimit = 2.0f;
+
+	template <typename T>
+	AEngine::Uint8* Put(AEngine::Uint8* out, const T& value)
+	{
+		std::memcpy(out, &value, sizeof(T));
+		return out + sizeof(T);
+	}
+}
+
+namespace AEngine
+{
+	static_assert(MAX_BONE_INFLUENCE == 4, "MeshBuilder packs bone influences as four component attributes");
+
+	MeshBuilder::MeshBuilder(Uint32 vertexCount, Uint32 indexCount, bool skinned)
+		: m_positions(vertexCount, Math::vec3(0.0f)),
+		  m_texCoords(vertexCount, Math::vec2(0.0f)),
+		  m_normals(vertexCount, Math::vec3(0.0f)),
+		  m_boneIds(skinned ? static_cast<Size_t>(vertexCount) * MaxInfluences : 0, 0),
+		  m_boneWeights(skinned ? static_cast<Size_t>(vertexCount) * MaxInfluences : 0, 0.0f),
+		  m_indices{},
+		  m_skinned{ skinned }
+	{
+		m_indices.reserve(indexCount);
+	}
+
+	void MeshBuilder::SetPosition(Uint32 vertex, const Math::vec3& position)
+	{
+		m_positions[vertex] = position;
+	}
+
+	void MeshBuilder::SetTexCoord(Uint32 vertex, const Math::vec2& texCoord)
+	{
+		m_texCoords[vertex] = texCoord;
+	}
+
+	void MeshBuilder::SetNormal(Uint32 vertex, const Math::vec3& normal)
+	{
+		m_normals[vertex] = normal;
+	}
+
+	void MeshBuilder::AddBoneInfluence(Uint32 vertex, Uint32 boneId, float weight)
+	{
+		if (!m_skinned)
+		{
+			return;
+		}
+
+		// replace the lowest influence on the vertex
+		const Size_t index = static_cast<Size_t>(vertex) * MaxInfluences;
+		Size_t replacedIndex = index;
+		for (Size_t i = index + 1; i < index + MaxInfluences; ++i)
+		{
+			if (m_boneWeights[i] < m_boneWeights[replacedIndex])
+			{
+				replacedIndex = i;
+			}
+		}
+
+		if (weight > m_boneWeights[replacedIndex])
+		{
+			m_boneIds[replacedIndex] = boneId;
+			m_boneWeights[replacedIndex] = weight;
+		}
+	}
+
+	void MeshBuilder::AddIndex(Uint32 index)
+	{
+		m_indices.push_back(index);
+	}
+
+	MeshStream MeshBuilder::Build() const
+	{
+		MeshStream stream;
+		stream.vertexCount = static_cast<Uint32>(m_positions.size());
+		stream.indexCount = static_cast<Uint32>(m_indices.size());
+
+		// pick the smallest formats that keep the data intact
+		stream.format = m_skinned ? Skinned : 0;
+		for (const Math::vec2& texCoord : m_texCoords)
+		{
+			if (std::abs(texCoord.x) > g_aeHalfTexCoordLimit || std::abs(texCoord.y) > g_aeHalfTexCoordLimit)
+			{
+				stream.format |= FloatTexCoords;
+				break;
+			}
+		}
+
+		for (Uint32 boneId : m_boneIds)
+		{
+			if (boneId > std::numeric_limits<Uint8>::max())
+			{
+				stream.format |= WideBoneIds;
+				break;
+			}
+		}
+
+		// interleave the vertices
+		const Size_t stride = static_cast<Size_t>(GetStride(stream.format));
+		stream.vertices.resize(stride * stream.vertexCount);
+		Uint8* out = stream.vertices.data();
+		for (Size_t i = 0; i < m_positions.size(); ++i)
+		{
+			stream.bounds.Expand(m_positions[i]);
+			out = Put(out, m_positions[i]);
+
+			if (stream.format & FloatTexCoords)
+			{
+				out = Put(out, m_texCoords[i]);
+			}
+			else
+			{
+				out = Put(out, Math::packHalf2x16(m_texCoords[i]));
+			}
+
+			const float length = Math::length(m_normals[i]);
+			const Math::vec3 normal = length > 0.0f ? m_normals[i] / length : Math::vec3(0.0f);
+			out = Put(out, Math::packSnorm3x10_1x2(Math::vec4(normal, 0.0f)));
+
+			if (!m_skinned)
+			{
+				continue;
+			}
+
+			const Uint32* ids = &m_boneIds[i * MaxInfluences];
+			const float* weights = &m_boneWeights[i * MaxInfluences];
+			for (Uint32 j = 0; j < MaxInfluences; ++j)
+			{
+				// unused influences point at bone zero with no weight
+				const Uint32 id = weights[j] > 0.0f ? ids[j] : 0;
+				if (stream.format & WideBoneIds)
+				{
+					out = Put(out, static_cast<Uint16>(id));
+				}
+				else
+				{
+					out = Put(out, static_cast<Uint8>(id));
+				}
+			}
+
+			// quantize so the weights still sum to one, the rounding error goes to the strongest
+			float total = 0.0f;
+			Uint32 strongest = 0;
+			for (Uint32 j = 0; j < MaxInfluences; ++j)
+			{
+				total += weights[j];
+				strongest = weights[j] > weights[strongest] ? j : strongest;
+			}
+
+			Uint8 quantized[MaxInfluences] = {};
+			if (total > 0.0f)
+			{
+				int sum = 0;
+				for (Uint32 j = 0; j < MaxInfluences; ++j)
+				{
+					quantized[j] = static_cast<Uint8>(std::lround(weights[j] / total * 255.0f));
+					sum += quantized[j];
+				}
+
+				quantized[strongest] = static_cast<Uint8>(quantized[strongest] + 255 - sum);
+			}
+
+			out = Put(out, quantized);
+		}
+
+		// 16-bit indices whenever every vertex can be addressed
+		const bool narrow = stream.vertexCount <= static_cast<Uint32>(std::numeric_limits<Uint16>::max()) + 1;
+		stream.indexType = narrow ? IndexType::Uint16 : IndexType::Uint32;
+		if (narrow)
+		{
+			stream.indices.resize(m_indices.size() * sizeof(Uint16));
+			Uint8* indexOut = stream.indices.data();
+			for (Uint32 index : m_indices)
+			{
+				indexOut = Put(indexOut, static_cast<Uint16>(index));
+			}
+		}
+		else
+		{
+			stream.indices.resize(m_indices.size() * sizeof(Uint32));
+			std::memcpy(stream.indices.data(), m_indices.data(), stream.indices.size());
+		}
+
+		return stream;
+	}
+
+	Intptr_t MeshBuilder::GetStride(Uint32 format)
+	{
+		return GetLayout(format).GetStride();
+	}
+
+	VertexBufferLayout MeshBuilder::GetLayout(Uint32 format)
+	{
+		VertexBufferLayout layout{
+			{ BufferElementType::Float3, false },
+			{ (format & FloatTexCoords) ? BufferElementType::Float2 : BufferElementType::Half2, false },
+			{ BufferElementType::Int10_10_10_2, true }
+		};
+
+		if (format & Skinned)
+		{
+			layout.AddElement({ (format & WideBoneIds) ? BufferElementType::Ushort4 : BufferElementType::Ubyte4, false });
+			layout.AddElement({ BufferElementType::Ubyte4, true });
+		}
+
+		return layout;
+	}
+}
@@ -0,0 +1,129 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+ * \brief Packs mesh attributes into a single interleaved vertex stream
+*/
+#pragma once
+#include "AEngine/Core/Types.h"
+#include "AEngine/Math/Bounds.h"
+#include "AEngine/Math/Math.h"
+#include "Buffer.h"
+#include "Types.h"
+#include <vector>
+
+namespace AEngine
+{
+		/**
+		 * \struct MeshStream
+		 * \brief Interleaved vertices and indices of a mesh, ready to be uploaded
+		*/
+	struct MeshStream
+	{
+		Uint32 format{ 0 };                     ///< MeshBuilder::Format flags describing the vertex layout
+		Uint32 vertexCount{ 0 };                ///< Number of vertices in the stream
+		Uint32 indexCount{ 0 };                 ///< Number of indices in the stream
+		IndexType indexType{ IndexType::Uint32 };   ///< Width of each index
+		Math::AABB bounds;                      ///< Bounds of the vertex positions
+		std::vector<Uint8> vertices;            ///< vertexCount * MeshBuilder::GetStride(format) bytes
+		std::vector<Uint8> indices;             ///< indexCount * IndexBuffer::GetIndexSize(indexType) bytes
+	};
+
+		/**
+		 * \class MeshBuilder
+		 * \brief Collects mesh attributes and packs them into a compact interleaved vertex stream
+		 * \details
+		 * Each vertex is laid out as:
+		 * - position as three floats
+		 * - texture coordinates as two half floats, or two floats when they leave [-2, 2]
+		 * - normal as a normalized 10:10:10:2 integer
+		 * - bone ids as four bytes, or four shorts when there are more than 256 bones
+		 * - bone weights as four normalized bytes that sum to one
+		 *
+		 * The bone attributes are only present for skinned meshes. The attribute locations
+		 * match the order above, so shaders written for the unpacked float layout are unchanged.
+		 * Indices are stored as 16-bit when every vertex can be addressed with them.
+		*/
+	class MeshBuilder
+	{
+	public:
+			/**
+			 * \enum Format
+			 * \brief Flags describing the vertex layout of a MeshStream
+			*/
+		enum Format : Uint32
+		{
+			Skinned        = 1 << 0,   ///< Vertices hold bone ids and weights
+			FloatTexCoords = 1 << 1,   ///< Texture coordinates are stored as floats rather than half floats
+			WideBoneIds    = 1 << 2    ///< Bone ids are stored as shorts rather than bytes
+		};
+
+			/**
+			 * \param[in] vertexCount Number of vertices in the mesh
+			 * \param[in] indexCount Number of indices that will be added, used to reserve storage
+			 * \param[in] skinned Whether the vertices are influenced by bones
+			*/
+		MeshBuilder(Uint32 vertexCount, Uint32 indexCount, bool skinned);
+			/**
+			 * \brief Sets the position of a vertex
+			 * \param[in] vertex Index of the vertex
+			 * \param[in] position Position of the vertex
+			*/
+		void SetPosition(Uint32 vertex, const Math::vec3& position);
+			/**
+			 * \brief Sets the texture coordinates of a vertex
+			 * \param[in] vertex Index of the vertex
+			 * \param[in] texCoord Texture coordinates of the vertex
+			*/
+		void SetTexCoord(Uint32 vertex, const Math::vec2& texCoord);
+			/**
+			 * \brief Sets the normal of a vertex
+			 * \param[in] vertex Index of the vertex
+			 * \param[in] normal Normal of the vertex, normalized when packed
+			*/
+		void SetNormal(Uint32 vertex, const Math::vec3& normal);
+			/**
+			 * \brief Adds a bone influence to a vertex
+			 * \param[in] vertex Index of the vertex
+			 * \param[in] boneId Id of the bone
+			 * \param[in] weight Weight of the bone
+			 * \note Only the strongest influences are kept, the weakest is replaced once a vertex is full
+			*/
+		void AddBoneInfluence(Uint32 vertex, Uint32 boneId, float weight);
+			/**
+			 * \brief Appends an index
+			 * \param[in] index Index of the vertex
+			*/
+		void AddIndex(Uint32 index);
+			/**
+			 * \brief Packs the collected attributes
+			 * \return Interleaved vertices and indices
+			*/
+		MeshStream Build() const;
+
+			/**
+			 * \brief Returns the size of a vertex in bytes
+			 * \param[in] format MeshBuilder::Format flags
+			 * \return Size of a vertex in bytes
+			*/
+		static Intptr_t GetStride(Uint32 format);
+			/**
+			 * \brief Returns the vertex buffer layout for a format
+			 * \param[in] format MeshBuilder::Format flags
+			 * \return Layout of the interleaved vertices
+			*/
+		static VertexBufferLayout GetLayout(Uint32 format);
+
+	private:
+		static constexpr Uint32 MaxInfluences = 4;
+			/**
+			 * \brief Attributes as they were given, packed by Build
+			*/
+		std::vector<Math::vec3> m_positions;
+		std::vector<Math::vec2> m_texCoords;
+		std::vector<Math::vec3> m_normals;
+		std::vector<Uint32> m_boneIds;       // MaxInfluences per vertex
+		std::vector<float> m_boneWeights;    // MaxInfluences per vertex
+		std::vector<Uint32> m_indices;
+		bool m_skinned;
+	};
+}
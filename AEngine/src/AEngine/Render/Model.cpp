@@ -5,6 +5,7 @@
 #include "AEngine/Render/RenderCommand.h"
 #include "Types.h"
 #include "Platform/Assimp/AssimpModel.h"
+#include "Platform/Assimp/AssimpModelCache.h"
 #include "AEngine/Resource/AssetManager.h"
 
 namespace AEngine
@@ -23,90 +24,64 @@ namespace AEngine
 		}
 	}
 
-	void Model::Clear()
+	bool Model::Cook(const std::string& fname)
 	{
-		m_meshes.clear();
-		AE_LOG_DEBUG("Model::Clear");
+		switch (ResourceAPI::GetLibrary())
+		{
+		case ModelLoaderLibrary::Assimp:
+			return AssimpModelCache::Cook(fname);
+		default:
+			AE_LOG_FATAL("Model::Cook::ModelLoaderLibrary::Error -> None selected");
+		}
 	}
 
-	void Model::RenderOpaque(const Math::mat4& transform, const Shader &shader, const Math::mat4 &projectionView) const
+	SharedPtr<ModelSource> Model::Decode(const std::string& fname)
 	{
-		shader.Bind();
-		shader.SetUniformMat4("u_transform", transform);
-		shader.SetUniformMat4("u_projectionView", projectionView);
-
-		for (auto it = m_meshes.begin(); it != m_meshes.end(); ++it)
+		switch (ResourceAPI::GetLibrary())
 		{
-			SharedPtr<Material> mat = AssetManager<Material>::Instance().Get(it->second.id);
-			if(!mat->IsTransparent())
-			{
-				const VertexArray* va = (it->first).get();
-
-				mat->Bind(shader);
-				va->Bind();
-
-				// draw
-				RenderCommand::DrawIndexed(Primitive::Triangles, va->GetIndexBuffer()->GetCount(), 0);
-
-				mat->Unbind(shader);
-				va->Unbind();
-			}
+		case ModelLoaderLibrary::Assimp:
+			return AssimpModel::Decode(fname);
+		default:
+			AE_LOG_FATAL("Model::Decode::ModelLoaderLibrary::Error -> None selected");
 		}
-
-		shader.Unbind();
 	}
 
-	void Model::RenderTransparent(const Math::mat4& transform, const Shader &shader, const Math::mat4 &projectionView) const
+	SharedPtr<Model> Model::Create(const std::string& ident, const std::string& fname, const ModelSource& source)
 	{
-		shader.Bind();
-		shader.SetUniformMat4("u_transform", transform);
-		shader.SetUniformMat4("u_projectionView", projectionView);
-
-		for (auto it = m_meshes.begin(); it != m_meshes.end(); ++it)
+		switch (ResourceAPI::GetLibrary())
 		{
-			SharedPtr<Material> mat = AssetManager<Material>::Instance().Get(it->second.id);
-
-				/// @todo Definitely need a better way to render transparent meshes
-			if(mat->IsTransparent())
-			{
-				const VertexArray* va = (it->first).get();
-				mat->Bind(shader);
-				va->Bind();
-
-				// draw
-				RenderCommand::DrawIndexed(Primitive::Triangles, va->GetIndexBuffer()->GetCount(), 0);
-
-				mat->Unbind(shader);
-				va->Unbind();
-			}
+		case ModelLoaderLibrary::Assimp:
+			return MakeShared<AssimpModel>(ident, fname, static_cast<const AssimpModelSource&>(source));
+		default:
+			AE_LOG_FATAL("Model::Create::ModelLoaderLibrary::Error -> None selected");
 		}
+	}
 
-		shader.Unbind();
+	void Model::Clear()
+	{
+		m_meshes.clear();
+		m_meshBounds.clear();
+		m_bounds = Math::AABB{};
+		AE_LOG_DEBUG("Model::Clear");
 	}
 
-	void Model::Render(const Math::mat4& transform, const Shader& shader, const Math::mat4 & projectionView, Animator& animation, const TimeStep dt)
+	void Model::Render(const Math::mat4& transform, const Shader& shader, const FrameContext& context)
 	{
 		shader.Bind();
 		//shader.SetUniformInteger("u_texture1", 0);
 		shader.SetUniformMat4("u_transform", transform);
-		shader.SetUniformMat4("u_projectionView", projectionView);
-
-		animation.UpdateAnimation(dt);
-
-		auto transforms = animation.GetFinalBoneMatrices();
-		for (int i = 0; i < transforms.size(); ++i)
-			shader.SetUniformMat4("u_finalBonesMatrices[" + std::to_string(i) + "]", transforms[i]);
 
 		for (auto it = m_meshes.begin(); it != m_meshes.end(); ++it)
 		{
-			SharedPtr<Material> mat = AssetManager<Material>::Instance().Get(it->second.id);
+			const Material* mat = it->second.material.get();
 			const VertexArray* va = it->first.get();
 
-			mat->Bind(shader);
+			mat->Bind(shader, context);
 			va->Bind();
 
 			// draw
-			RenderCommand::DrawIndexed(Primitive::Triangles, va->GetIndexBuffer()->GetCount(), 0);
+			const IndexBuffer& indices = *va->GetIndexBuffer();
+			RenderCommand::DrawIndexed(Primitive::Triangles, indices.GetCount(), 0, indices.GetIndexType());
 
 			mat->Unbind(shader);
 			va->Unbind();
@@ -125,6 +100,16 @@ namespace AEngine
 		return (m_meshes[index].first).get();
 	}
 
+	const Math::AABB& Model::GetMeshBounds(int meshIndex) const
+	{
+		if (meshIndex < 0 || meshIndex >= static_cast<int>(m_meshBounds.size()))
+		{
+			AE_LOG_FATAL("Model::GetMeshBounds::Out of Bounds");
+		}
+
+		return m_meshBounds[meshIndex];
+	}
+
 	const std::string& Model::GetMaterial(int index) const
 	{
 		if (index > m_meshes.size())
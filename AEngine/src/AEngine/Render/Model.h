@@ -6,6 +6,7 @@
 #pragma once
 #include "AEngine/Core/TimeStep.h"
 #include "AEngine/Core/Types.h"
+#include "AEngine/Math/Bounds.h"
 #include "AEngine/Resource/Asset.h"
 
 #include "VertexArray.h"
@@ -28,6 +29,18 @@ namespace AEngine
 	{
 		std::string id;
 		int type; // 0 for opaque 1 for transparent
+		SharedPtr<Material> material; // cached on load to avoid per-draw asset lookups
+	};
+
+		/**
+		 * \class ModelSource
+		 * \brief Model data read from disk before any render objects are created
+		 * \details Each model loader library extends this with what it needs to finish the model
+		**/
+	class ModelSource
+	{
+	public:
+		virtual ~ModelSource() = default;
 	};
 
 		/**
@@ -38,30 +51,24 @@ namespace AEngine
 	{
 	public:
 		using mesh_material = std::pair<SharedPtr<VertexArray>, MaterialMetadata>;
+			/**
+			 * \brief Type decoded off the main thread by AssetManager::LoadAsync
+			**/
+		using Source = ModelSource;
 			/**
 			 * \brief Clear model data
 			**/
 		void Clear();
 
-			/**
-			 * \brief Render command for RenderableComponent
-			 * \param[in] transform model transform
-			 * \param[in] shader shader to use
-			 * \param[in] projectionview camera projection view
-			 * \todo remove shader pass responsibility to Material
-			**/
-		void RenderOpaque(const Math::mat4& transform, const Shader &shader, const Math::mat4 &projectionView) const;
-		void RenderTransparent(const Math::mat4& transform, const Shader &shader, const Math::mat4 &projectionView) const;
 			/**
 			 * \brief Render command for SkinnedRenderableComponent
 			 * \param[in] transform model transform
 			 * \param[in] shader shader to use
-			 * \param[in] projectionview camera projection view
-			 * \param[in] animator contains a currently loaded animation
-			 * \param[in] time TimeStep for updating animation
+			 * \param[in] context of the current frame
+			 * \note The bone palette must already be bound, see AnimationScheduler::BindPalette
 			 * \todo remove shader pass responsibility to Material
 			**/
-		void Render(const Math::mat4& transform, const Shader& shader, const Math::mat4& projectionView, Animator& animator, const TimeStep time);
+		void Render(const Math::mat4& transform, const Shader& shader, const FrameContext& context);
 			/**
 			 * \brief Get VertexArray for a mesh by index
 			 * \param[in] index Index of mesh
@@ -74,6 +81,16 @@ namespace AEngine
 		const std::string& GetMaterial(int meshIndex) const;
 
 		int GetMeshCount() const { return static_cast<int>(m_meshes.size()); }
+			/**
+			 * \brief Get the model space bounds of the whole model
+			 * \return Box containing every mesh in the bind pose
+			**/
+		const Math::AABB& GetBounds() const { return m_bounds; }
+			/**
+			 * \brief Get the model space bounds of a mesh by index
+			 * \param[in] meshIndex Index of mesh
+			**/
+		const Math::AABB& GetMeshBounds(int meshIndex) const;
 
 		virtual ~Model() = default;
 
@@ -86,6 +103,26 @@ namespace AEngine
 			 * \param[in] fname Asset path
 			**/
 		static SharedPtr<Model> Create(const std::string& ident, const std::string& fname);
+			/**
+			 * \brief Prepares a model ahead of time so later loads skip importing it
+			 * \param[in] fname Asset path
+			 * \retval true if the model was prepared
+			**/
+		static bool Cook(const std::string& fname);
+			/**
+			 * \brief Reads and processes the model file, safe to call from any thread
+			 * \param[in] fname Asset path
+			 * \note Textures used by the model's materials are decoded here too
+			**/
+		static SharedPtr<ModelSource> Decode(const std::string& fname);
+			/**
+			 * \brief Creates the model from data returned by Decode()
+			 * \param[in] ident Asset ident
+			 * \param[in] fname Asset path
+			 * \param[in] source Decoded model
+			 * \note Must be called on the thread that owns the render context
+			**/
+		static SharedPtr<Model> Create(const std::string& ident, const std::string& fname, const ModelSource& source);
 
 	protected:
 			/**
@@ -96,6 +133,8 @@ namespace AEngine
 		Model(const std::string& ident, const std::string& path);
 
 		std::vector<mesh_material> m_meshes;
+		std::vector<Math::AABB> m_meshBounds; // parallel to m_meshes
+		Math::AABB m_bounds;
 		std::map<std::string, BoneInfo> m_BoneInfoMap;
 		std::string m_directory;
 	};
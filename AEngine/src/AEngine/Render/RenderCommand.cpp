@@ -137,9 +137,14 @@ namespace AEngine
 		s_impl->PolygonMode(face, type);
 	}
 
-	void RenderCommand::DrawIndexed(Primitive type, Intptr_t count, void* offset)
+	void RenderCommand::DrawIndexed(Primitive type, Intptr_t count, void* offset, IndexType indexType)
 	{
-		s_impl->DrawIndexed(type, count, offset);
+		s_impl->DrawIndexed(type, count, offset, indexType);
+	}
+
+	void RenderCommand::DrawIndexedInstanced(Primitive type, Intptr_t count, void* offset, Intptr_t instanceCount, IndexType indexType)
+	{
+		s_impl->DrawIndexedInstanced(type, count, offset, instanceCount, indexType);
 	}
 
 	void RenderCommand::DrawArrays(Primitive type, int offset, Intptr_t count)
@@ -171,8 +171,19 @@ namespace AEngine
 			 * \param[in] type The type of primitive to draw
 			 * \param[in] count The number of indices to draw
 			 * \param[in] offset The offset in the index buffer
+			 * \param[in] indexType Width of the indices in the bound index buffer
 			*/
-		static void DrawIndexed(Primitive type, Intptr_t count, void* offset);
+		static void DrawIndexed(Primitive type, Intptr_t count, void* offset, IndexType indexType = IndexType::Uint32);
+			/**
+			 * \brief Draw an indexed array multiple times in one call
+			 * \param[in] type The type of primitive to draw
+			 * \param[in] count The number of indices to draw per instance
+			 * \param[in] offset The offset in the index buffer
+			 * \param[in] instanceCount The number of instances to draw
+			 * \param[in] indexType Width of the indices in the bound index buffer
+			 * \note Per-instance data is sourced from VertexArray::SetInstanceBuffer
+			*/
+		static void DrawIndexedInstanced(Primitive type, Intptr_t count, void* offset, Intptr_t instanceCount, IndexType indexType = IndexType::Uint32);
 			/**
 			 * \brief Draw an array
 			 * \param[in] type The type of primitive to draw
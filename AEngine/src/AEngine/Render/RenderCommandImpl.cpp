@@ -4,6 +4,7 @@
 */
 #include "RenderCommandImpl.h"
 #include "AEngine/Core/Logger.h"
+#include "Platform/Null/NullRenderCommand.h"
 #include "Platform/OpenGL/OpenGLRenderCommand.h"
 
 namespace AEngine
@@ -14,6 +15,8 @@ namespace AEngine
 		{
 		case RenderLibrary::OpenGL:
 			return MakeUnique<OpenGLRenderCommand>();
+		case RenderLibrary::Null:
+			return MakeUnique<NullRenderCommand>();
 		default:
 			AE_LOG_FATAL("RenderCommandImpl::Create::Error::RenderLibrary -> Does not exist");
 		}
@@ -120,7 +120,11 @@ namespace AEngine
 			/**
 			 * \copydoc RenderCommand::DrawIndexed
 			*/
-		virtual void DrawIndexed(Primitive type, Intptr_t count, void* offset = 0) = 0;
+		virtual void DrawIndexed(Primitive type, Intptr_t count, void* offset, IndexType indexType) = 0;
+			/**
+			 * \copydoc RenderCommand::DrawIndexedInstanced
+			*/
+		virtual void DrawIndexedInstanced(Primitive type, Intptr_t count, void* offset, Intptr_t instanceCount, IndexType indexType) = 0;
 			/**
 			 * \copydoc RenderCommand::DrawArrays
 			*/
@@ -1,6 +1,7 @@
 #include "RenderPipeline.h"
 #include "AEngine/Core/Application.h"
 #include "AEngine/Core/Window.h"
+#include "AEngine/Core/PerspectiveCamera.h"
 #include "RenderCommand.h"
 
 
@@ -35,19 +36,26 @@ namespace
 		uniform sampler2D normalTexture;
 		uniform sampler2D albedoTexture;
 
+		layout (std140) uniform CameraBlock
+		{
+			mat4 u_projectionView;
+			mat4 u_projection;
+			mat4 u_view;
+			vec4 u_cameraPosition;
+			vec4 u_lightPosition;
+			vec4 u_lightColor;
+		};
+
 		void main()
 		{
 			vec3 FragPos = texture(positionTexture, TexCoord).xyz;
 			vec3 Normal = texture(normalTexture, TexCoord).xyz;
 			vec4 Albedo = texture(albedoTexture, TexCoord);
 
-			vec3 LightPos = vec3(10.0, 10.0, 10.0);
-			vec3 LightColor = vec3(1.0, 1.0, 1.0);
-
-			vec3 LightDir = normalize(LightPos - FragPos);
+			vec3 LightDir = normalize(u_lightPosition.xyz - FragPos);
 			float diff = max(dot(Normal, LightDir), 0.35);
 
-			vec3 result = Albedo.rgb * diff * LightColor;
+			vec3 result = Albedo.rgb * diff * u_lightColor.rgb;
 
 			FragColor = vec4(result, 1.0);
 		}
@@ -59,17 +67,25 @@ namespace
         layout (location = 0) in vec3 aPos;
         layout (location = 1) in vec2 aTexCoord;
         layout (location = 2) in vec3 aNormal;
+        layout (location = 8) in mat4 aTransform;
 
         out vec3 FragPos;
         out vec3 Normal;
 
-        uniform mat4 u_projectionView;
-        uniform mat4 u_transform;
+        layout (std140) uniform CameraBlock
+        {
+            mat4 u_projectionView;
+            mat4 u_projection;
+            mat4 u_view;
+            vec4 u_cameraPosition;
+            vec4 u_lightPosition;
+            vec4 u_lightColor;
+        };
 
         void main()
         {
-            gl_Position = u_projectionView * u_transform * vec4(aPos, 1.0);
-            FragPos = vec3(u_transform * vec4(aPos, 1.0));
+            gl_Position = u_projectionView * aTransform * vec4(aPos, 1.0);
+            FragPos = vec3(aTransform * vec4(aPos, 1.0));
             Normal = aNormal;
         }
 
@@ -78,7 +94,16 @@ namespace
 
         uniform vec4 u_baseColor;
         uniform samplerCube u_hdr;
-        uniform vec3 u_camPos;
+
+        layout (std140) uniform CameraBlock
+        {
+            mat4 u_projectionView;
+            mat4 u_projection;
+            mat4 u_view;
+            vec4 u_cameraPosition;
+            vec4 u_lightPosition;
+            vec4 u_lightColor;
+        };
 
         in vec3 FragPos;
         in vec3 Normal;
@@ -87,7 +112,7 @@ namespace
 
         void main()
         {
-            vec3 I = normalize(FragPos - u_camPos);
+            vec3 I = normalize(FragPos - u_cameraPosition.xyz);
             vec3 R = reflect(I, normalize(Normal));
 
             vec3 hdr = texture(u_hdr, R).rgb;
@@ -139,6 +164,20 @@ namespace
     0, 1, 2,
     0, 2, 3
     };
+
+        /**
+         * \brief CPU mirror of the std140 CameraBlock declared by the engine shaders
+         * \note vec3 members are padded to vec4 to match the std140 layout
+        **/
+    struct CameraBlockData
+    {
+        AEngine::Math::mat4 projectionView;
+        AEngine::Math::mat4 projection;
+        AEngine::Math::mat4 view;
+        AEngine::Math::vec4 cameraPosition;
+        AEngine::Math::vec4 lightPosition;
+        AEngine::Math::vec4 lightColor;
+    };
 }
 
 namespace AEngine
@@ -160,12 +199,15 @@ namespace AEngine
         m_transparentShader = Shader::Create(transparentCode);
         m_finalShader = Shader::Create(finalShader);
 
-        m_gbuffer = Framebuffer::Create(Application::Instance().GetWindow()->GetSize());
+        m_gbuffer = Framebuffer::Create(Application::Instance().GetViewportSize());
         m_gbuffer->Attach(FramebufferAttachment::Color, 0);    // Position
         m_gbuffer->Attach(FramebufferAttachment::Color, 1);    // Normal
         m_gbuffer->Attach(FramebufferAttachment::Color, 2);    // Diffuse
         m_gbuffer->Attach(FramebufferAttachment::Color, 3);    // Result
         m_gbuffer->Attach(FramebufferAttachment::Depth);
+
+        m_cameraBuffer = UniformBuffer::Create(UniformBlock::Camera);
+        m_cameraBuffer->SetData(nullptr, static_cast<Intptr_t>(sizeof(CameraBlockData)), BufferUsage::DynamicDraw);
     }
 
 	RenderPipeline& RenderPipeline::Instance()
@@ -174,6 +216,32 @@ namespace AEngine
 		return instance;
 	}
 
+    void RenderPipeline::BindFrameUniforms(const FrameContext& context)
+    {
+        UploadCameraBlock(*m_cameraBuffer, context);
+        m_cameraBuffer->Bind();
+    }
+
+    void RenderPipeline::UploadCameraBlock(UniformBuffer& buffer, const FrameContext& context)
+    {
+        CameraBlockData data;
+        data.projection = context.camera->GetProjectionMatrix();
+        data.view = context.camera->GetViewMatrix();
+        data.projectionView = data.projection * data.view;
+        data.cameraPosition = Math::vec4(context.cameraPosition, 1.0f);
+        data.lightPosition = Math::vec4(context.lightPosition, 1.0f);
+        data.lightColor = Math::vec4(context.lightColor, 1.0f);
+
+        const Intptr_t bytes = static_cast<Intptr_t>(sizeof(CameraBlockData));
+        if (buffer.Size() < bytes)
+        {
+            buffer.SetData(&data, bytes, BufferUsage::DynamicDraw);
+            return;
+        }
+
+        buffer.SetSubData(&data, bytes, 0);
+    }
+
     SharedPtr<Shader> RenderPipeline::GetTransparentShader()
     {
         return m_transparentShader;
@@ -2,6 +2,8 @@
 #include "Types.h"
 #include "Framebuffer.h"
 #include "AEngine/Math/Math.h"
+#include "Buffer.h"
+#include "FrameContext.h"
 #include "Shader.h"
 #include "VertexArray.h"
 #include <glm/glm.hpp>
@@ -57,6 +59,21 @@ namespace AEngine
 			**/
         void ClearBuffers();
 
+			/**
+			 * \brief Upload the per-frame camera and light data and bind it to UniformBlock::Camera
+			 * \param[in] context of the frame, the camera must not be null
+			 * \retval void
+			 * \note Call once per frame before any pass, shaders read it from their CameraBlock
+			**/
+        void BindFrameUniforms(const FrameContext& context);
+			/**
+			 * \brief Upload the per-frame camera and light data to a buffer backing UniformBlock::Camera
+			 * \param[in] buffer to upload to, sized to the block if it is smaller
+			 * \param[in] context of the frame, the camera must not be null
+			 * \retval void
+			**/
+        static void UploadCameraBlock(UniformBuffer& buffer, const FrameContext& context);
+
             /// @todo REMOVE
         void TestRender();
 
@@ -75,5 +92,6 @@ namespace AEngine
         SharedPtr<Shader> m_lightingShader;
         SharedPtr<Shader> m_transparentShader;
         SharedPtr<Shader> m_finalShader;
+        SharedPtr<UniformBuffer> m_cameraBuffer;
     };
 }
\ No newline at end of file
@@ -0,0 +1,180 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#include "RenderQueue.h"
+#include "Material.h"
+#include "Model.h"
+#include "RenderCommand.h"
+#include "Shader.h"
+#include "VertexArray.h"
+#include <algorithm>
+#include <tuple>
+
+namespace AEngine
+{
+	RenderQueue::RenderQueue(Pass pass)
+		: m_pass{ pass }, m_stats{}, m_items{}, m_transforms{}, m_instanceData{}
+	{
+
+	}
+
+	void RenderQueue::Clear()
+	{
+		m_items.clear();
+		m_transforms.clear();
+		m_stats = Stats{};
+	}
+
+	void RenderQueue::Submit(const Model& model, const Shader& shader, const Math::mat4& transform)
+	{
+		const Uint32 transformIndex = static_cast<Uint32>(m_transforms.size());
+		const bool wantTransparent = (m_pass == Pass::Transparent);
+
+		bool queued = false;
+		for (const Model::mesh_material& mesh : model)
+		{
+			const Material* material = mesh.second.material.get();
+			if (!material || material->IsTransparent() != wantTransparent)
+			{
+				continue;
+			}
+
+			m_items.push_back({ &shader, material, mesh.first.get(), transformIndex });
+			++m_stats.submissions;
+			queued = true;
+		}
+
+		// only store the transform if a mesh references it
+		if (queued)
+		{
+			m_transforms.push_back(transform);
+		}
+	}
+
+	void RenderQueue::Flush(const FrameContext& context)
+	{
+		if (m_items.empty())
+		{
+			return;
+		}
+
+		// sort by state so that identical meshes are adjacent
+		std::sort(m_items.begin(), m_items.end(), [](const Item& lhs, const Item& rhs) {
+			return std::tie(lhs.shader, lhs.material, lhs.vertexArray)
+				< std::tie(rhs.shader, rhs.material, rhs.vertexArray);
+		});
+
+		const Shader* boundShader = nullptr;
+		const Material* boundMaterial = nullptr;
+		VertexArray* boundVertexArray = nullptr;
+
+		Size_t begin = 0;
+		while (begin < m_items.size())
+		{
+			// find the end of the batch sharing this state
+			const Item& batch = m_items[begin];
+			Size_t end = begin + 1;
+			while (end < m_items.size()
+				&& m_items[end].shader == batch.shader
+				&& m_items[end].material == batch.material
+				&& m_items[end].vertexArray == batch.vertexArray)
+			{
+				++end;
+			}
+
+			if (batch.shader != boundShader)
+			{
+				if (boundMaterial)
+				{
+					boundMaterial->Unbind(*boundShader);
+					boundMaterial = nullptr;
+				}
+
+				batch.shader->Bind();
+				boundShader = batch.shader;
+				++m_stats.shaderBinds;
+			}
+
+			if (batch.material != boundMaterial)
+			{
+				if (boundMaterial)
+				{
+					boundMaterial->Unbind(*boundShader);
+				}
+
+				batch.material->Bind(*boundShader, context);
+				boundMaterial = batch.material;
+				++m_stats.materialBinds;
+			}
+
+			// gather the batch transforms in draw order and upload them
+			m_instanceData.clear();
+			for (Size_t i = begin; i < end; ++i)
+			{
+				m_instanceData.push_back(m_transforms[m_items[i].transformIndex]);
+			}
+
+			// upload before binding, creating the instance buffer will unbind the vertex array
+			UploadInstances(*batch.vertexArray, m_instanceData.data(), m_instanceData.size());
+			if (batch.vertexArray != boundVertexArray)
+			{
+				batch.vertexArray->Bind();
+				boundVertexArray = batch.vertexArray;
+				++m_stats.vertexArrayBinds;
+			}
+
+			RenderCommand::DrawIndexedInstanced(
+				Primitive::Triangles,
+				batch.vertexArray->GetIndexBuffer()->GetCount(),
+				0,
+				static_cast<Intptr_t>(m_instanceData.size()),
+				batch.vertexArray->GetIndexBuffer()->GetIndexType()
+			);
+			++m_stats.drawCalls;
+
+			begin = end;
+		}
+
+		if (boundMaterial)
+		{
+			boundMaterial->Unbind(*boundShader);
+		}
+
+		boundVertexArray->Unbind();
+		boundShader->Unbind();
+
+		m_items.clear();
+		m_transforms.clear();
+	}
+
+	const RenderQueue::Stats& RenderQueue::GetStats() const
+	{
+		return m_stats;
+	}
+
+	void RenderQueue::UploadInstances(VertexArray& vertexArray, const Math::mat4* transforms, Size_t count)
+	{
+		const Intptr_t bytes = static_cast<Intptr_t>(count * sizeof(Math::mat4));
+
+		SharedPtr<VertexBuffer> buffer = vertexArray.GetInstanceBuffer();
+		if (!buffer)
+		{
+			buffer = VertexBuffer::Create();
+			buffer->SetLayout({ { BufferElementType::Mat4, false } });
+			buffer->SetData(transforms, bytes, BufferUsage::StreamDraw);
+			vertexArray.SetInstanceBuffer(buffer);
+			return;
+		}
+
+		// grow the buffer if needed, otherwise reuse the existing storage
+		if (bytes > buffer->Size())
+		{
+			buffer->SetData(transforms, bytes, BufferUsage::StreamDraw);
+		}
+		else
+		{
+			buffer->SetSubData(transforms, bytes, 0);
+		}
+	}
+}
@@ -0,0 +1,121 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+ * \brief State-sorted, instanced draw submission
+*/
+#pragma once
+#include "AEngine/Core/Types.h"
+#include "AEngine/Math/Math.h"
+#include "FrameContext.h"
+#include <vector>
+
+namespace AEngine
+{
+	class Material;
+	class Model;
+	class Shader;
+	class VertexArray;
+
+		/**
+		 * \class RenderQueue
+		 * \brief Gathers mesh submissions for a frame and draws them with the fewest state changes
+		 * \details
+		 * Submissions are sorted by shader, then material, then vertex array. Consecutive
+		 * submissions that share all three are drawn with a single instanced draw call, with
+		 * the per-instance transforms uploaded to the vertex array's instance buffer.
+		 * \note Shaders drawn through the queue must read the model transform from the
+		 * `mat4` attribute at VertexArray::InstanceAttributeLocation.
+		*/
+	class RenderQueue
+	{
+	public:
+			/**
+			 * \enum Pass
+			 * \brief Selects which meshes of a submitted model are queued
+			*/
+		enum class Pass
+		{
+			Opaque,        ///< Only meshes with an opaque material
+			Transparent    ///< Only meshes with a transparent material
+		};
+
+			/**
+			 * \struct Stats
+			 * \brief Counters for the work done by the queue since the last Clear()
+			*/
+		struct Stats
+		{
+			Uint32 submissions{ 0 };        ///< Number of meshes submitted
+			Uint32 drawCalls{ 0 };          ///< Number of draw calls issued
+			Uint32 shaderBinds{ 0 };        ///< Number of times the shader was changed
+			Uint32 materialBinds{ 0 };      ///< Number of times the material was changed
+			Uint32 vertexArrayBinds{ 0 };   ///< Number of times the vertex array was changed
+
+				/**
+				 * \brief Returns the total number of state changes
+				 * \return Sum of shader, material and vertex array binds
+				*/
+			Uint32 GetStateChanges() const { return shaderBinds + materialBinds + vertexArrayBinds; }
+		};
+
+	public:
+			/**
+			 * \param[in] pass Which meshes of submitted models this queue accepts
+			*/
+		explicit RenderQueue(Pass pass);
+			/**
+			 * \brief Removes all submissions and resets the stats
+			 * \note This should be called once at the start of each frame
+			*/
+		void Clear();
+			/**
+			 * \brief Queues the meshes of a model that match the queue's pass
+			 * \param[in] model to draw
+			 * \param[in] shader to draw the model with
+			 * \param[in] transform model to world transform
+			*/
+		void Submit(const Model& model, const Shader& shader, const Math::mat4& transform);
+			/**
+			 * \brief Sorts and draws all queued submissions
+			 * \param[in] context of the current frame
+			 * \note The camera is read from the per-frame CameraBlock
+			 * \note The queue is emptied but the stats are retained until Clear()
+			*/
+		void Flush(const FrameContext& context);
+			/**
+			 * \brief Returns the stats accumulated since the last Clear()
+			 * \return The stats of the queue
+			*/
+		const Stats& GetStats() const;
+
+	private:
+			/**
+			 * \struct Item
+			 * \brief A single queued mesh
+			*/
+		struct Item
+		{
+			const Shader* shader;
+			const Material* material;
+			VertexArray* vertexArray;
+			Uint32 transformIndex;
+		};
+
+		Pass m_pass;
+		Stats m_stats;
+		std::vector<Item> m_items;
+		std::vector<Math::mat4> m_transforms;
+			/**
+			 * \brief Scratch buffer for the transforms of the current batch in draw order
+			*/
+		std::vector<Math::mat4> m_instanceData;
+
+			/**
+			 * \brief Uploads instance transforms to a vertex array, creating its instance buffer if needed
+			 * \param[in] vertexArray to upload to
+			 * \param[in] transforms to upload
+			 * \param[in] count number of transforms
+			*/
+		static void UploadInstances(VertexArray& vertexArray, const Math::mat4* transforms, Size_t count);
+	};
+}
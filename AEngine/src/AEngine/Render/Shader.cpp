@@ -2,6 +2,7 @@
 #include "AEngine/Core/Application.h"
 #include "AEngine/Core/Logger.h"
 #include "AEngine/Render/RenderCommand.h"
+#include "Platform/Null/NullShader.h"
 #include "Platform/OpenGL/OpenGLShader.h"
 
 namespace AEngine
@@ -24,6 +25,8 @@ namespace AEngine
 		{
 		case RenderLibrary::OpenGL:
 			return MakeShared<OpenGLShader>(ident, fname);
+		case RenderLibrary::Null:
+			return MakeShared<NullShader>(ident, fname);
 		default:
 			AE_LOG_FATAL("Shader::Create::RenderLibrary::Error -> None selected");
 		}
@@ -34,6 +37,8 @@ namespace AEngine
 		{
 		case RenderLibrary::OpenGL:
 			return MakeShared<OpenGLShader>(shaderSource);
+		case RenderLibrary::Null:
+			return MakeShared<NullShader>(shaderSource);
 		default:
 			AE_LOG_FATAL("Shader::Create::RenderLibrary::Error -> None selected");
 		}
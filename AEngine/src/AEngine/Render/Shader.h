@@ -11,6 +11,21 @@
 
 namespace AEngine
 {
+		/**
+		 * \struct UniformHandle
+		 * \brief Resolved reference to a shader uniform
+		 * \details
+		 * Handles are obtained once with Shader::GetUniformHandle and can then be used to
+		 * upload values without any name lookups. A handle is only valid for the shader
+		 * that created it.
+		**/
+	struct UniformHandle
+	{
+		int id{ -1 };
+
+		bool IsValid() const { return id >= 0; }
+	};
+
 	class Shader : public Asset
 	{
 	public:
@@ -77,6 +92,82 @@ namespace AEngine
 			 * \retval void
 			**/
 		virtual void SetUniformMat4(const std::string& name, const Math::mat4& matrix) const = 0;
+			/**
+			 * \brief Upload an array of mat4 uniforms to shader
+			 * \param[in] name of uniform array
+			 * \param[in] matrices to upload
+			 * \param[in] count number of matrices
+			 * \retval void
+			**/
+		virtual void SetUniformMat4Array(const std::string& name, const Math::mat4* matrices, Size_t count) const = 0;
+
+//--------------------------------------------------------------------------------
+// Handle API
+//--------------------------------------------------------------------------------
+			/**
+			 * \brief Resolve a uniform name to a handle
+			 * \param[in] name of uniform
+			 * \return Handle to the uniform
+			 * \note The handle is invalid if the uniform is not active in the shader
+			**/
+		virtual UniformHandle GetUniformHandle(const std::string& name) const = 0;
+			/**
+			 * \brief Upload single integer uniform to shader
+			 * \param[in] handle of uniform
+			 * \param[in] value to upload
+			 * \retval void
+			**/
+		virtual void SetUniform(UniformHandle handle, int value) const = 0;
+			/**
+			 * \brief Upload single float uniform to shader
+			 * \param[in] handle of uniform
+			 * \param[in] value to upload
+			 * \retval void
+			**/
+		virtual void SetUniform(UniformHandle handle, float value) const = 0;
+			/**
+			 * \brief Upload a vec2 uniform to shader
+			 * \param[in] handle of uniform
+			 * \param[in] value to upload
+			 * \retval void
+			**/
+		virtual void SetUniform(UniformHandle handle, const Math::vec2& value) const = 0;
+			/**
+			 * \brief Upload a vec3 uniform to shader
+			 * \param[in] handle of uniform
+			 * \param[in] value to upload
+			 * \retval void
+			**/
+		virtual void SetUniform(UniformHandle handle, const Math::vec3& value) const = 0;
+			/**
+			 * \brief Upload a vec4 uniform to shader
+			 * \param[in] handle of uniform
+			 * \param[in] value to upload
+			 * \retval void
+			**/
+		virtual void SetUniform(UniformHandle handle, const Math::vec4& value) const = 0;
+			/**
+			 * \brief Upload a mat3 uniform to shader
+			 * \param[in] handle of uniform
+			 * \param[in] matrix to upload
+			 * \retval void
+			**/
+		virtual void SetUniform(UniformHandle handle, const Math::mat3& matrix) const = 0;
+			/**
+			 * \brief Upload a mat4 uniform to shader
+			 * \param[in] handle of uniform
+			 * \param[in] matrix to upload
+			 * \retval void
+			**/
+		virtual void SetUniform(UniformHandle handle, const Math::mat4& matrix) const = 0;
+			/**
+			 * \brief Upload an array of mat4 uniforms to shader
+			 * \param[in] handle of uniform array
+			 * \param[in] matrices to upload
+			 * \param[in] count number of matrices
+			 * \retval void
+			**/
+		virtual void SetUniformMat4Array(UniformHandle handle, const Math::mat4* matrices, Size_t count) const = 0;
 
 			/**
 			 * /
@@ -2,6 +2,7 @@
 #include "AEngine/Core/Application.h"
 #include "AEngine/Core/Logger.h"
 #include "AEngine/Render/RenderCommand.h"
+#include "Platform/Null/NullTexture.h"
 #include "Platform/OpenGL/OpenGLTexture.h"
 
 namespace AEngine
@@ -18,6 +19,26 @@ namespace AEngine
 		{
 		case RenderLibrary::OpenGL:
 			return MakeShared<OpenGLTexture>(ident, fname);
+		case RenderLibrary::Null:
+			return MakeShared<NullTexture>(ident, fname);
+		default:
+			AE_LOG_FATAL("Texture::Create::RenderLibrary::Error -> None selected");
+		}
+	}
+
+	SharedPtr<Image> Texture::Decode(const std::string& fname)
+	{
+		return Image::Load(fname);
+	}
+
+	SharedPtr<Texture> Texture::Create(const std::string& ident, const std::string& fname, const Image& image)
+	{
+		switch (RenderCommand::GetLibrary())
+		{
+		case RenderLibrary::OpenGL:
+			return MakeShared<OpenGLTexture>(ident, fname, image);
+		case RenderLibrary::Null:
+			return MakeShared<NullTexture>(ident, fname, image);
 		default:
 			AE_LOG_FATAL("Texture::Create::RenderLibrary::Error -> None selected");
 		}
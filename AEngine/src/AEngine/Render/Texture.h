@@ -2,6 +2,7 @@
 #include <string>
 #include "AEngine/Core/Types.h"
 #include "AEngine/Math/Math.h"
+#include "AEngine/Render/Image.h"
 #include "AEngine/Render/Types.h"
 #include "AEngine/Resource/Asset.h"
 
@@ -16,6 +17,11 @@ namespace AEngine
 	class Texture : public Asset
 	{
 	public:
+			/**
+			 * \brief Type decoded off the main thread by AssetManager::LoadAsync
+			*/
+		using Source = Image;
+
 			/**
 			 * \param[in] ident The identifier for the Texture
 			 * \param[in] path The path to the Texture
@@ -101,5 +107,18 @@ namespace AEngine
 		virtual void SetTextureBorderColor(Math::vec4 borderColor) = 0;
 
 		static SharedPtr<Texture> Create(const std::string& ident, const std::string& fname);
+			/**
+			 * \brief Decodes the image of a texture, safe to call from any thread
+			 * \param[in] fname The path to the texture
+			*/
+		static SharedPtr<Image> Decode(const std::string& fname);
+			/**
+			 * \brief Creates a texture from an already decoded image
+			 * \param[in] ident The identifier for the Texture
+			 * \param[in] fname The path to the Texture
+			 * \param[in] image Decoded with Decode()
+			 * \note Must be called on the thread that owns the render context
+			*/
+		static SharedPtr<Texture> Create(const std::string& ident, const std::string& fname, const Image& image);
 	};
 }
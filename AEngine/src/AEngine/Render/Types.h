@@ -14,6 +14,7 @@ namespace AEngine
 	enum class RenderLibrary
 	{
 		OpenGL,   ///< OpenGL rendering library
+		Null,     ///< Records work without a graphics context, for headless runs
 		Invalid   ///< No rendering library
 	};
 
@@ -116,6 +117,20 @@ namespace AEngine
 		StreamDraw     ///< The data will be uploaded once and used a few times
 	};
 
+		/**
+		 * \enum UniformBlock
+		 * \brief Engine uniform blocks and the binding points they are bound to
+		 * \details
+		 * Shaders that declare a block with the matching name are linked to the binding
+		 * point automatically when compiled.
+		*/
+	enum class UniformBlock
+	{
+		Camera,        ///< `CameraBlock`, per-frame camera and light data
+		Skeleton,      ///< `SkeletonBlock`, bone palette of the skinned mesh being drawn
+		Count          ///< Number of engine uniform blocks
+	};
+
 		/**
 		 * \enum BufferElementPrecision
 		 * \brief Rendering API agnostic buffer element precision
@@ -137,12 +152,26 @@ namespace AEngine
 		*/
 	enum class BufferElementType
 	{
-		Byte,  Byte2,  Byte3,  Byte4,    // Signed Byte
-		Ubyte, Ubyte2, Ubyte3, Ubyte4,   // Unsigned Byte
-		Int,   Int2,   Int3,   Int4,     // Signed Integer
-		Uint,  Uint2,  Uint3,  Uint4,    // Unsigned Integer
-		Float, Float2, Float3, Float4,   // Floating Point
-		Mat3,  Mat4                      // Matrix
+		Byte,   Byte2,   Byte3,   Byte4,     // Signed Byte
+		Ubyte,  Ubyte2,  Ubyte3,  Ubyte4,    // Unsigned Byte
+		Short,  Short2,  Short3,  Short4,    // Signed Short
+		Ushort, Ushort2, Ushort3, Ushort4,   // Unsigned Short
+		Int,    Int2,    Int3,    Int4,      // Signed Integer
+		Uint,   Uint2,   Uint3,   Uint4,     // Unsigned Integer
+		Half,   Half2,   Half3,   Half4,     // Half Precision Floating Point
+		Float,  Float2,  Float3,  Float4,    // Floating Point
+		Mat3,   Mat4,                        // Matrix
+		Int10_10_10_2                        // Four signed components packed into 32 bits, normalize for unit vectors
+	};
+
+		/**
+		 * \enum IndexType
+		 * \brief Width of the indices held by an index buffer
+		*/
+	enum class IndexType
+	{
+		Uint16,   ///< 16-bit indices, for meshes with at most 65536 vertices
+		Uint32    ///< 32-bit indices
 	};
 
 		/**
@@ -47,6 +47,10 @@ namespace AEngine
 
 	SharedPtr<VertexArray> UIRenderCommand::s_quad = nullptr;
     SharedPtr<Shader> UIRenderCommand::s_shader = nullptr;
+    UniformHandle UIRenderCommand::s_hasTexturesUniform;
+    UniformHandle UIRenderCommand::s_textureUniform;
+    UniformHandle UIRenderCommand::s_colorUniform;
+    UniformHandle UIRenderCommand::s_transformUniform;
 
     void UIRenderCommand::Init()
     {
@@ -78,6 +82,12 @@ namespace AEngine
 		s_quad->AddVertexBuffer(positionAndTextureBuffer);
 
         s_shader = Shader::Create(UI_Shader);
+
+        // every panel is drawn with this shader, resolve its uniforms once
+        s_hasTexturesUniform = s_shader->GetUniformHandle("u_hasTextures");
+        s_textureUniform = s_shader->GetUniformHandle("u_texture");
+        s_colorUniform = s_shader->GetUniformHandle("u_color");
+        s_transformUniform = s_shader->GetUniformHandle("u_transform");
     }
 
 	void UIRenderCommand::Teardown()
@@ -119,10 +129,10 @@ namespace AEngine
             texture->Bind();
             s_quad->Bind();
 
-            s_shader->SetUniformInteger("u_hasTextures", 1);
-            s_shader->SetUniformInteger("u_texture", 0);
-            s_shader->SetUniformFloat4("u_color", color);
-            s_shader->SetUniformMat4("u_transform", projectionTransform);
+            s_shader->SetUniform(s_hasTexturesUniform, 1);
+            s_shader->SetUniform(s_textureUniform, 0);
+            s_shader->SetUniform(s_colorUniform, color);
+            s_shader->SetUniform(s_transformUniform, projectionTransform);
 
             RenderCommand::DrawIndexed(Primitive::Triangles, s_quad->GetIndexBuffer()->GetCount(), 0);
             s_quad->Unbind();
@@ -134,9 +144,9 @@ namespace AEngine
             s_shader->Bind();
             s_quad->Bind();
 
-            s_shader->SetUniformInteger("u_hasTextures", 0);
-            s_shader->SetUniformFloat4("u_color", color);
-            s_shader->SetUniformMat4("u_transform", projectionTransform);
+            s_shader->SetUniform(s_hasTexturesUniform, 0);
+            s_shader->SetUniform(s_colorUniform, color);
+            s_shader->SetUniform(s_transformUniform, projectionTransform);
 
             RenderCommand::DrawIndexed(Primitive::Triangles, s_quad->GetIndexBuffer()->GetCount(), 0);
             s_quad->Unbind();
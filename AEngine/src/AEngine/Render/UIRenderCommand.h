@@ -38,5 +38,9 @@ namespace AEngine
     private:
         static SharedPtr<VertexArray> s_quad;
         static SharedPtr<Shader> s_shader;
+        static UniformHandle s_hasTexturesUniform;
+        static UniformHandle s_textureUniform;
+        static UniformHandle s_colorUniform;
+        static UniformHandle s_transformUniform;
     };
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 */
 #include "VertexArray.h"
 #include "AEngine/Core/Logger.h"
+#include "Platform/Null/NullVertexArray.h"
 #include "Platform/OpenGL/OpenGLVertexArray.h"
 #include "RenderCommand.h"
 
@@ -15,6 +16,8 @@ namespace AEngine
 		{
 		case RenderLibrary::OpenGL:
 			return MakeShared<OpenGLVertexArray>();
+		case RenderLibrary::Null:
+			return MakeShared<NullVertexArray>();
 		default:
 			AE_LOG_FATAL("VertexArray::Create::Error -> Invalid RenderLibrary");
 		}
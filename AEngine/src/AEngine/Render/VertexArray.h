@@ -16,6 +16,14 @@ namespace AEngine
 	class VertexArray
 	{
 	public:
+			/**
+			 * \brief First attribute location used by the instance buffer
+			 * \details
+			 * Per-vertex buffers are assigned locations sequentially from zero, so instance data
+			 * is placed at a fixed location above them to keep shader layouts stable.
+			*/
+		static constexpr Uint32 InstanceAttributeLocation = 8;
+
 		virtual ~VertexArray() = default;
 			/**
 			 * \brief Binds the vertex array
@@ -35,6 +43,14 @@ namespace AEngine
 			 * \param[in] indexBuffer The index buffer to set
 			*/
 		virtual void SetIndexBuffer(const SharedPtr<IndexBuffer>& indexBuffer) = 0;
+			/**
+			 * \brief Sets the per-instance vertex buffer of the vertex array
+			 * \param[in] instanceBuffer The vertex buffer to source per-instance data from
+			 * \details
+			 * The attributes of the buffer's layout advance once per instance and start at
+			 * #InstanceAttributeLocation; matrix elements occupy one location per column.
+			*/
+		virtual void SetInstanceBuffer(const SharedPtr<VertexBuffer>& instanceBuffer) = 0;
 			/**
 			 * \brief Gets the vertex buffers of the vertex array
 			 * \return The vertex buffers of the vertex array
@@ -45,6 +61,11 @@ namespace AEngine
 			 * \return The index buffer of the vertex array
 			*/
 		virtual const SharedPtr<IndexBuffer>& GetIndexBuffer() const = 0;
+			/**
+			 * \brief Gets the per-instance vertex buffer of the vertex array
+			 * \return The instance buffer, or nullptr if none has been set
+			*/
+		virtual const SharedPtr<VertexBuffer>& GetInstanceBuffer() const = 0;
 			/**
 			 * \brief Creates a vertex array
 			 * \return The created vertex array
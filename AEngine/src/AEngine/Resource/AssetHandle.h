@@ -0,0 +1,106 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#pragma once
+#include "AEngine/Core/Types.h"
+#include "AssetLoader.h"
+
+namespace AEngine
+{
+	template <typename T>
+	class AssetManager;
+
+		/**
+		 * \class AssetHandle
+		 * \brief Refers to an asset that may still be loading
+		 * \details Returned by AssetManager::LoadAsync, every handle to the same asset shares its state.
+		 * \note Handles are only completed on the main thread, so should only be used there.
+		*/
+	template <typename T>
+	class AssetHandle
+	{
+	public:
+		AssetHandle() = default;
+
+			/**
+			 * \brief Checks whether the asset has finished loading
+			*/
+		bool IsReady() const;
+			/**
+			 * \brief Gets the asset
+			 * \return The asset, or nullptr if it is still loading
+			*/
+		SharedPtr<T> Get() const;
+			/**
+			 * \brief Finishes loading the asset
+			 * \return The asset
+			 * \details Runs queued uploads while waiting, blocking on a future here would deadlock
+			 * as the upload it waits for can only run on this thread.
+			*/
+		SharedPtr<T> Wait() const;
+
+			/**
+			 * \brief Checks whether the handle refers to an asset
+			*/
+		explicit operator bool() const;
+
+	private:
+		friend class AssetManager<T>;
+
+		struct State
+		{
+			bool ready = false;
+			SharedPtr<T> asset;
+		};
+
+		explicit AssetHandle(SharedPtr<State> state);
+
+		SharedPtr<State> m_state;
+	};
+
+//--------------------------------------------------------------------------------
+// Implementation
+//--------------------------------------------------------------------------------
+
+	template <typename T>
+	AssetHandle<T>::AssetHandle(SharedPtr<State> state)
+		: m_state{ std::move(state) }
+	{
+
+	}
+
+	template <typename T>
+	bool AssetHandle<T>::IsReady() const
+	{
+		return m_state && m_state->ready;
+	}
+
+	template <typename T>
+	SharedPtr<T> AssetHandle<T>::Get() const
+	{
+		return IsReady() ? m_state->asset : nullptr;
+	}
+
+	template <typename T>
+	SharedPtr<T> AssetHandle<T>::Wait() const
+	{
+		if (!m_state)
+		{
+			return nullptr;
+		}
+
+		while (!m_state->ready && AssetLoader::Instance().WaitForUpload())
+		{
+			// the upload that completes this handle may be behind others
+		}
+
+		return m_state->asset;
+	}
+
+	template <typename T>
+	AssetHandle<T>::operator bool() const
+	{
+		return m_state != nullptr;
+	}
+}
@@ -0,0 +1,197 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#include "AssetLoader.h"
+#include "AEngine/Core/Logger.h"
+#include <chrono>
+
+namespace AEngine
+{
+	AssetLoader& AssetLoader::Instance()
+	{
+		static AssetLoader instance;
+		return instance;
+	}
+
+	AssetLoader::AssetLoader()
+		: m_stopping{ false }, m_decoding{ 0 }
+	{
+
+	}
+
+	AssetLoader::~AssetLoader()
+	{
+		// uploads are left alone, the render context may already be gone
+		std::unique_lock<std::mutex> lock(m_decodeMutex);
+		m_stopping = true;
+		m_decodeQueue.clear();
+		lock.unlock();
+
+		m_decodeReady.notify_all();
+		for (std::thread& worker : m_workers)
+		{
+			worker.join();
+		}
+	}
+
+	void AssetLoader::Initialise(unsigned int workers)
+	{
+		if (!m_workers.empty())
+		{
+			AE_LOG_WARN("AssetLoader::Initialise::Warning -> Already initialised");
+			return;
+		}
+
+		AE_LOG_INFO("AssetLoader::Initialise -> {} workers", workers);
+		m_stopping = false;
+		m_workers.reserve(workers);
+		for (unsigned int i = 0; i < workers; ++i)
+		{
+			m_workers.emplace_back(&AssetLoader::WorkerLoop, this);
+		}
+	}
+
+	void AssetLoader::Shutdown()
+	{
+		AE_LOG_INFO("AssetLoader::Shutdown");
+
+		// assets already asked for are finished so their handles become ready
+		Flush();
+
+		{
+			std::lock_guard<std::mutex> lock(m_decodeMutex);
+			m_stopping = true;
+		}
+
+		m_decodeReady.notify_all();
+		for (std::thread& worker : m_workers)
+		{
+			worker.join();
+		}
+
+		m_workers.clear();
+	}
+
+	void AssetLoader::QueueDecode(Job job)
+	{
+		if (m_workers.empty())
+		{
+			job();
+			return;
+		}
+
+		++m_decoding;
+		{
+			std::lock_guard<std::mutex> lock(m_decodeMutex);
+			m_decodeQueue.push_back(std::move(job));
+		}
+
+		m_decodeReady.notify_one();
+	}
+
+	void AssetLoader::QueueUpload(Job job)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_uploadMutex);
+			m_uploadQueue.push_back(std::move(job));
+		}
+
+		m_uploadReady.notify_one();
+	}
+
+	Size_t AssetLoader::ProcessUploads(TimeStep budget)
+	{
+		using Clock = std::chrono::steady_clock;
+		const Clock::time_point start = Clock::now();
+
+		Size_t count = 0;
+		std::unique_lock<std::mutex> lock(m_uploadMutex);
+		while (!m_uploadQueue.empty())
+		{
+			Job job = std::move(m_uploadQueue.front());
+			m_uploadQueue.pop_front();
+
+			// uploads may queue more work, so run them unlocked
+			lock.unlock();
+			job();
+			++count;
+
+			if (TimeStep(Clock::now() - start).Seconds() >= budget.Seconds())
+			{
+				break;
+			}
+
+			lock.lock();
+		}
+
+		return count;
+	}
+
+	void AssetLoader::Flush()
+	{
+		while (WaitForUpload())
+		{
+			// keep going until the workers have nothing left to hand over
+		}
+	}
+
+	bool AssetLoader::WaitForUpload()
+	{
+		// the decoding count drops after a job's upload is queued, so nothing is missed between the checks
+		std::unique_lock<std::mutex> lock(m_uploadMutex);
+		m_uploadReady.wait(lock, [this]() {
+			return !m_uploadQueue.empty() || m_decoding == 0;
+		});
+
+		if (m_uploadQueue.empty())
+		{
+			return false;
+		}
+
+		lock.unlock();
+		ProcessUploads(TimeStep(0.0f));
+		return true;
+	}
+
+	bool AssetLoader::IsIdle() const
+	{
+		std::lock_guard<std::mutex> lock(m_uploadMutex);
+		return m_uploadQueue.empty() && m_decoding == 0;
+	}
+
+	Size_t AssetLoader::GetWorkerCount() const
+	{
+		return m_workers.size();
+	}
+
+	void AssetLoader::WorkerLoop()
+	{
+		while (true)
+		{
+			std::unique_lock<std::mutex> lock(m_decodeMutex);
+			m_decodeReady.wait(lock, [this]() {
+				return m_stopping || !m_decodeQueue.empty();
+			});
+
+			if (m_decodeQueue.empty())
+			{
+				return;
+			}
+
+			Job job = std::move(m_decodeQueue.front());
+			m_decodeQueue.pop_front();
+			lock.unlock();
+
+			job();
+
+			// take the upload lock so a waiting Flush cannot miss the wake up
+			{
+				std::lock_guard<std::mutex> uploadLock(m_uploadMutex);
+				--m_decoding;
+			}
+
+			m_uploadReady.notify_all();
+		}
+	}
+}
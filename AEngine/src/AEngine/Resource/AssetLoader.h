@@ -0,0 +1,110 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#pragma once
+#include "AEngine/Core/TimeStep.h"
+#include "AEngine/Core/Types.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace AEngine
+{
+		/**
+		 * \class AssetLoader
+		 * \brief Runs asset loading work across a pool of worker threads
+		 * \details
+		 * Loading is split into two stages. Decode work reads and processes files and may run on
+		 * any thread, it must not touch the render context or an AssetManager. Upload work creates
+		 * the render objects and registers the asset, and always runs on the main thread, either
+		 * from ProcessUploads() once per frame or from Flush().
+		 * \note Until Initialise() is called decode work runs immediately on the calling thread.
+		*/
+	class AssetLoader
+	{
+	public:
+		using Job = std::function<void()>;
+
+		static AssetLoader& Instance();
+		~AssetLoader();
+
+		AssetLoader(const AssetLoader&) = delete;
+		void operator=(const AssetLoader&) = delete;
+
+			/**
+			 * \brief Starts the worker threads
+			 * \param[in] workers number of threads to decode on, zero decodes on the calling thread
+			*/
+		void Initialise(unsigned int workers);
+			/**
+			 * \brief Finishes the queued work and joins the worker threads
+			 * \note Must be called from the main thread
+			*/
+		void Shutdown();
+
+			/**
+			 * \brief Queues work to run on a worker thread
+			 * \param[in] job to run, may call QueueUpload()
+			*/
+		void QueueDecode(Job job);
+			/**
+			 * \brief Queues work to run on the main thread
+			 * \param[in] job to run
+			 * \note May be called from any thread
+			*/
+		void QueueUpload(Job job);
+
+			/**
+			 * \brief Runs queued uploads until the budget is spent
+			 * \param[in] budget time to spend this frame, at least one upload always runs
+			 * \return Number of uploads run
+			 * \note Must be called from the main thread
+			*/
+		Size_t ProcessUploads(TimeStep budget);
+			/**
+			 * \brief Blocks until every queued decode and upload has finished
+			 * \note Must be called from the main thread
+			*/
+		void Flush();
+			/**
+			 * \brief Runs uploads until at least one finishes or nothing is left to wait on
+			 * \retval false if there is no queued work left
+			 * \note Must be called from the main thread
+			*/
+		bool WaitForUpload();
+
+			/**
+			 * \brief Checks whether any decode or upload work is queued or running
+			*/
+		bool IsIdle() const;
+			/**
+			 * \brief Gets the number of worker threads
+			*/
+		Size_t GetWorkerCount() const;
+
+	private:
+		AssetLoader();
+		void WorkerLoop();
+
+		std::vector<std::thread> m_workers;
+
+		// decode jobs shared by the workers
+		std::mutex m_decodeMutex;
+		std::condition_variable m_decodeReady;
+		std::deque<Job> m_decodeQueue;
+		bool m_stopping;
+
+		// upload jobs run by the main thread
+		mutable std::mutex m_uploadMutex;
+		std::condition_variable m_uploadReady;
+		std::deque<Job> m_uploadQueue;
+
+		// decode jobs queued or running, each may still queue an upload
+		std::atomic<Size_t> m_decoding;
+	};
+}
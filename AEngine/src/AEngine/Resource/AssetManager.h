@@ -2,10 +2,22 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include "AEngine/Core/Logger.h"
+#include "AssetHandle.h"
+#include "AssetLoader.h"
 
 namespace AEngine
 {
+	namespace Detail
+	{
+			// assets declaring a Source type can be decoded off the main thread
+		template <typename T, typename = void>
+		struct HasSource : std::false_type {};
+		template <typename T>
+		struct HasSource<T, std::void_t<typename T::Source>> : std::true_type {};
+	}
+
 	template <typename T>
 	class AssetManager
 	{
@@ -16,6 +28,9 @@ namespace AEngine
 		void Clear();
 		SharedPtr<T> LoadSubAsset(const std::string& ident, const SharedPtr<T> assetToCopy);
 		SharedPtr<T> Load(const std::string& path);
+			// Loads an asset through the AssetLoader
+			// Assets with a Source type decode it on a worker, the rest are created during the upload
+		AssetHandle<T> LoadAsync(const std::string& path);
 		SharedPtr<T> Get(const std::string& ident);
 
 		typename std::map<std::string, typename SharedPtr<T>>::const_iterator begin();
@@ -26,7 +41,10 @@ namespace AEngine
 
 	private:
 		AssetManager() = default;
+		void FinishLoad(const std::string& ident, const SharedPtr<typename AssetHandle<T>::State>& state, SharedPtr<T> asset);
+
 		std::map<std::string, typename SharedPtr<T>> m_data;
+		std::map<std::string, AssetHandle<T>> m_pending;
 	};
 
 //--------------------------------------------------------------------------------
@@ -73,6 +91,70 @@ namespace AEngine
 		return obj;
 	}
 
+	template <typename T>
+	AssetHandle<T> AssetManager<T>::LoadAsync(const std::string& path)
+	{
+		Size_t last = path.find_last_of("/");
+		const std::string ident = path.substr(last + 1);
+
+		// test if exists or is already on its way
+		using State = typename AssetHandle<T>::State;
+		SharedPtr<T> obj = Get(ident);
+		if (obj)
+		{
+			SharedPtr<State> state = MakeShared<State>();
+			state->ready = true;
+			state->asset = obj;
+			return AssetHandle<T>(state);
+		}
+
+		auto it = m_pending.find(ident);
+		if (it != m_pending.end())
+		{
+			return it->second;
+		}
+
+		SharedPtr<State> state = MakeShared<State>();
+		AssetHandle<T> handle(state);
+		m_pending.emplace(ident, handle);
+
+		AssetLoader& loader = AssetLoader::Instance();
+		if constexpr (Detail::HasSource<T>::value)
+		{
+			loader.QueueDecode([this, ident, path, state]() {
+				SharedPtr<typename T::Source> source = T::Decode(path);
+				AssetLoader::Instance().QueueUpload([this, ident, path, state, source]() {
+					FinishLoad(ident, state, T::Create(ident, path, *source));
+				});
+			});
+		}
+		else
+		{
+			loader.QueueUpload([this, ident, path, state]() {
+				FinishLoad(ident, state, T::Create(ident, path));
+			});
+		}
+
+		return handle;
+	}
+
+	template <typename T>
+	void AssetManager<T>::FinishLoad(const std::string& ident, const SharedPtr<typename AssetHandle<T>::State>& state, SharedPtr<T> asset)
+	{
+		// a synchronous load may have finished first, keep the asset already shared out
+		SharedPtr<T> obj = Get(ident);
+		if (!obj)
+		{
+			m_data.emplace(std::make_pair(ident, asset));
+			obj = asset;
+		}
+
+		state->asset = obj;
+		state->ready = true;
+		m_pending.erase(ident);
+		AE_LOG_TRACE("AssetManager::LoadAsync::Success -> {}", ident);
+	}
+
 		// Copies an asset to the manager 
 		// Used when T::Create() is not possible
 	template <typename T>
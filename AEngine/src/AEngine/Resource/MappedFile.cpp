@@ -0,0 +1,124 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#include "MappedFile.h"
+
+#ifdef _WIN32
+	#define WIN32_LEAN_AND_MEAN
+	#define NOMINMAX
+	#include <Windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace AEngine
+{
+	MappedFile::MappedFile()
+		: m_data{ nullptr }, m_size{ 0 }, m_file{ nullptr }, m_mapping{ nullptr }
+	{
+
+	}
+
+#ifdef _WIN32
+	MappedFile::~MappedFile()
+	{
+		if (m_data)
+		{
+			UnmapViewOfFile(m_data);
+		}
+
+		if (m_mapping)
+		{
+			CloseHandle(m_mapping);
+		}
+
+		if (m_file)
+		{
+			CloseHandle(m_file);
+		}
+	}
+
+	UniquePtr<MappedFile> MappedFile::Open(const std::string& path)
+	{
+		UniquePtr<MappedFile> file(new MappedFile());
+		HANDLE handle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (handle == INVALID_HANDLE_VALUE)
+		{
+			return nullptr;
+		}
+
+		file->m_file = handle;
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(handle, &size) || size.QuadPart == 0)
+		{
+			return nullptr;
+		}
+
+		file->m_mapping = CreateFileMappingA(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!file->m_mapping)
+		{
+			return nullptr;
+		}
+
+		file->m_data = static_cast<const char*>(MapViewOfFile(file->m_mapping, FILE_MAP_READ, 0, 0, 0));
+		if (!file->m_data)
+		{
+			return nullptr;
+		}
+
+		file->m_size = static_cast<Size_t>(size.QuadPart);
+		return file;
+	}
+#else
+	MappedFile::~MappedFile()
+	{
+		if (m_data)
+		{
+			munmap(const_cast<char*>(m_data), m_size);
+		}
+	}
+
+	UniquePtr<MappedFile> MappedFile::Open(const std::string& path)
+	{
+		// the mapping outlives the descriptor, so it is closed straight away
+		int fd = open(path.c_str(), O_RDONLY);
+		if (fd < 0)
+		{
+			return nullptr;
+		}
+
+		struct stat info;
+		if (fstat(fd, &info) != 0 || info.st_size == 0)
+		{
+			close(fd);
+			return nullptr;
+		}
+
+		void* data = mmap(nullptr, static_cast<Size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+		close(fd);
+		if (data == MAP_FAILED)
+		{
+			return nullptr;
+		}
+
+		UniquePtr<MappedFile> file(new MappedFile());
+		file->m_data = static_cast<const char*>(data);
+		file->m_size = static_cast<Size_t>(info.st_size);
+		return file;
+	}
+#endif
+
+	const char* MappedFile::GetData() const
+	{
+		return m_data;
+	}
+
+	Size_t MappedFile::GetSize() const
+	{
+		return m_size;
+	}
+}
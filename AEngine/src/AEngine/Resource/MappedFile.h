@@ -0,0 +1,42 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#pragma once
+#include "AEngine/Core/Types.h"
+#include <string>
+
+namespace AEngine
+{
+		/**
+		 * \class MappedFile
+		 * \brief Read-only view of a file mapped into memory
+		 * \details Pages are read in by the OS as they are touched, so nothing is copied up front.
+		*/
+	class MappedFile
+	{
+	public:
+		~MappedFile();
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+			/**
+			 * \brief Maps a file
+			 * \param[in] path to the file
+			 * \return The mapped file, or nullptr if it could not be opened or is empty
+			*/
+		static UniquePtr<MappedFile> Open(const std::string& path);
+
+		const char* GetData() const;
+		Size_t GetSize() const;
+
+	private:
+		MappedFile();
+
+		const char* m_data;
+		Size_t m_size;
+		void* m_file;
+		void* m_mapping;
+	};
+}
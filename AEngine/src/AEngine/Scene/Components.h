@@ -7,6 +7,7 @@
 #pragma once
 #include "AEngine/Core/PerspectiveCamera.h"
 #include "AEngine/Core/Types.h"
+#include "AEngine/Math/Bounds.h"
 #include "AEngine/Math/Math.h"
 #include "AEngine/Physics/Collider.h"
 #include "AEngine/Physics/CollisionBody.h"
@@ -18,6 +19,7 @@
 #include "AEngine/AI/Grid.h"
 #include "AEngine/AI/BDIAgent.h"
 #include "AEngine/AI/FCM.h"
+#include <EnTT/entt.hpp>
 #include <string>
 
 namespace AEngine
@@ -32,11 +34,11 @@ namespace AEngine
 	struct TagComponent
 	{
 		std::string tag;
-		Uint16 ident;
+		Uint64 ident;
 
 		TagComponent() = default;
 		TagComponent(const TagComponent&) = default;
-		TagComponent(const std::string& tag, Uint16 ident)
+		TagComponent(const std::string& tag, Uint64 ident)
 			: tag(tag), ident(ident) {}
 	};
 
@@ -81,6 +83,71 @@ namespace AEngine
 		}
 	};
 
+	// links an entity into the scene graph, the transform component becomes relative to the parent
+	struct HierarchyComponent
+	{
+		entt::entity parent{ entt::null };
+		entt::entity firstChild{ entt::null };
+		entt::entity nextSibling{ entt::null };
+		entt::entity prevSibling{ entt::null };
+		Uint32 depth{ 0 };   // distance from the root, parents are always updated before their children
+	};
+
+	// world space transform of an entity, rebuilt by the scene only when its inputs change
+	struct WorldTransformComponent
+	{
+		Math::mat4 matrix{ 1.0f };
+		Uint32 version{ 0 };   // incremented each time the matrix is rebuilt
+
+		// inputs of the last rebuild
+		TransformComponent local;
+		Uint32 parentVersion{ 0 };
+		bool dirty{ true };   // forces a rebuild, set when the entity changes parent
+
+		bool Update(const TransformComponent& source, const WorldTransformComponent* parent)
+		{
+			const Uint32 sourceParentVersion = parent ? parent->version : 0;
+			if (!dirty
+				&& parentVersion == sourceParentVersion
+				&& local.translation == source.translation
+				&& local.orientation == source.orientation
+				&& local.scale == source.scale)
+			{
+				return false;
+			}
+
+			local = source;
+			parentVersion = sourceParentVersion;
+			dirty = false;
+			matrix = parent ? parent->matrix * source.ToMat4() : source.ToMat4();
+			++version;
+			return true;
+		}
+
+		Math::vec3 GetTranslation() const
+		{
+			return Math::vec3(matrix[3]);
+		}
+
+		Math::quat GetOrientation() const
+		{
+			// remove the scale from the basis before extracting the rotation
+			const Math::mat3 basis{
+				Math::normalize(Math::vec3(matrix[0])),
+				Math::normalize(Math::vec3(matrix[1])),
+				Math::normalize(Math::vec3(matrix[2]))
+			};
+			return Math::quat_cast(basis);
+		}
+
+		// moves a world space pose into the space of this transform, used when a child is placed in world space
+		void ToLocal(const Math::vec3& position, const Math::quat& orientation, TransformComponent& child) const
+		{
+			child.translation = Math::vec3(Math::inverse(matrix) * Math::vec4(position, 1.0f));
+			child.orientation = Math::normalize(Math::inverse(GetOrientation()) * orientation);
+		}
+	};
+
 	struct NavigationGridComponent
 	{
 		bool debug;
@@ -127,6 +194,28 @@ namespace AEngine
 		Animator animator;
 	};
 
+	struct BoundsComponent
+	{
+		Math::AABB world;        // world space bounds of the entity's model
+		bool visible = true;     // result of the last culling pass
+
+		// the bounds are only recomputed when the model or world transform changes
+		const Model* model = nullptr;
+		Uint32 transformVersion = 0;
+
+		void Update(const Model& source, const WorldTransformComponent& sourceTransform)
+		{
+			if (model == &source && transformVersion == sourceTransform.version)
+			{
+				return;
+			}
+
+			model = &source;
+			transformVersion = sourceTransform.version;
+			world = source.GetBounds().Transform(sourceTransform.matrix);
+		}
+	};
+
 	struct SkyboxComponent
 	{
 		bool active;
@@ -148,11 +237,13 @@ namespace AEngine
 	struct CollisionBodyComponent
 	{
 		SharedPtr<CollisionBody> ptr;
+		Uint32 syncedVersion{ 0 };   // world transform version last pushed to the body
 	};
 
 	struct RigidBodyComponent
 	{
 		SharedPtr<RigidBody> ptr;
+		Uint32 syncedVersion{ 0 };   // world transform version last pushed to the body
 	};
 
 	struct BoxColliderComponent
@@ -168,6 +259,7 @@ namespace AEngine
 	struct PlayerControllerComponent
 	{
 		PlayerController* ptr;
+		Uint32 syncedVersion{ 0 };   // world transform version last pushed to the controller
 	};
 
 	struct BDIComponent
@@ -12,4 +12,20 @@ namespace AEngine
 	{
 
 	}
+
+	bool Entity::SetParent(Entity parent)
+	{
+		return m_Scene->SetParent(m_EntityHandle, parent.m_EntityHandle);
+	}
+
+	Entity Entity::GetParent()
+	{
+		entt::entity parent = m_Scene->GetParent(m_EntityHandle);
+		if (parent == entt::null)
+		{
+			return Entity();
+		}
+
+		return Entity(parent, m_Scene);
+	}
 }
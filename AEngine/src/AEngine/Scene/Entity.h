@@ -88,6 +88,18 @@ namespace AEngine
 			m_Scene->m_entitiesStagedForRemoval.push_back(m_EntityHandle);
 		}
 
+			/**
+			 * @brief Attaches the entity to a parent, its transform becomes relative to the parent
+			 * @param[in] parent to attach to; an invalid entity detaches from the current parent
+			 * @return true if the parent was changed
+			**/
+		bool SetParent(Entity parent);
+			/**
+			 * @brief Returns the parent of the entity
+			 * @return Entity, invalid if the entity has no parent
+			**/
+		Entity GetParent();
+
 		Scene* GetScene() { return m_Scene; }
 
 		// utility methods and overloads
@@ -0,0 +1,78 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#include "EntityIndex.h"
+
+namespace AEngine
+{
+	void EntityIndex::Insert(entt::entity entity, Uint64 ident, const std::string& tag)
+	{
+		m_idents[ident] = entity;
+		m_tags.emplace(tag, entity);
+	}
+
+	void EntityIndex::Erase(entt::entity entity, Uint64 ident, const std::string& tag)
+	{
+		auto it = m_idents.find(ident);
+		if (it != m_idents.end() && it->second == entity)
+		{
+			m_idents.erase(it);
+		}
+
+		EraseTag(entity, tag);
+	}
+
+	void EntityIndex::Rename(entt::entity entity, const std::string& oldTag, const std::string& newTag)
+	{
+		EraseTag(entity, oldTag);
+		m_tags.emplace(newTag, entity);
+	}
+
+	entt::entity EntityIndex::Find(Uint64 ident) const
+	{
+		auto it = m_idents.find(ident);
+		if (it != m_idents.end())
+		{
+			return it->second;
+		}
+
+		return entt::null;
+	}
+
+	entt::entity EntityIndex::Find(const std::string& tag) const
+	{
+		auto it = m_tags.find(tag);
+		if (it != m_tags.end())
+		{
+			return it->second;
+		}
+
+		return entt::null;
+	}
+
+	void EntityIndex::Clear()
+	{
+		m_idents.clear();
+		m_tags.clear();
+	}
+
+	Size_t EntityIndex::Size() const
+	{
+		return m_idents.size();
+	}
+
+	void EntityIndex::EraseTag(entt::entity entity, const std::string& tag)
+	{
+		// tags may be shared, only remove the entry for this entity
+		auto range = m_tags.equal_range(tag);
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			if (it->second == entity)
+			{
+				m_tags.erase(it);
+				return;
+			}
+		}
+	}
+}
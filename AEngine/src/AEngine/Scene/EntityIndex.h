@@ -0,0 +1,79 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+ * \brief Hash indices from entity identifier and tag to registry handle
+*/
+#pragma once
+#include "AEngine/Core/Types.h"
+#include <EnTT/entt.hpp>
+#include <string>
+#include <unordered_map>
+
+namespace AEngine
+{
+		/**
+		 * \class EntityIndex
+		 * \brief Constant time lookup of entities by identifier and tag
+		 * \details
+		 * Tags are not required to be unique, when several entities share a tag any one of
+		 * them may be returned by a lookup.
+		 * \note The owner is responsible for keeping the index in step with the registry
+		*/
+	class EntityIndex
+	{
+	public:
+			/**
+			 * \brief Adds an entity to the index
+			 * \param[in] entity registry handle
+			 * \param[in] ident of the entity
+			 * \param[in] tag of the entity
+			*/
+		void Insert(entt::entity entity, Uint64 ident, const std::string& tag);
+			/**
+			 * \brief Removes an entity from the index
+			 * \param[in] entity registry handle
+			 * \param[in] ident of the entity
+			 * \param[in] tag of the entity
+			*/
+		void Erase(entt::entity entity, Uint64 ident, const std::string& tag);
+			/**
+			 * \brief Moves an entity to a new tag
+			 * \param[in] entity registry handle
+			 * \param[in] oldTag the entity was inserted with
+			 * \param[in] newTag to index the entity by
+			*/
+		void Rename(entt::entity entity, const std::string& oldTag, const std::string& newTag);
+			/**
+			 * \brief Finds an entity by identifier
+			 * \param[in] ident of the entity
+			 * \return Registry handle, or entt::null if not found
+			*/
+		entt::entity Find(Uint64 ident) const;
+			/**
+			 * \brief Finds an entity by tag
+			 * \param[in] tag of the entity
+			 * \return Registry handle, or entt::null if not found
+			*/
+		entt::entity Find(const std::string& tag) const;
+			/**
+			 * \brief Removes every entity from the index
+			*/
+		void Clear();
+			/**
+			 * \brief Returns the number of indexed entities
+			 * \return Number of indexed entities
+			*/
+		Size_t Size() const;
+
+	private:
+		std::unordered_map<Uint64, entt::entity> m_idents;
+		std::unordered_multimap<std::string, entt::entity> m_tags;
+
+			/**
+			 * \brief Removes a single entity from the tag index
+			 * \param[in] entity registry handle
+			 * \param[in] tag the entity was inserted with
+			*/
+		void EraseTag(entt::entity entity, const std::string& tag);
+	};
+}
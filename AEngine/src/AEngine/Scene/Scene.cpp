@@ -5,6 +5,7 @@
 **/
 #include "Scene.h"
 #include "AEngine/Core/Identifier.h"
+#include "AEngine/Core/JobSystem.h"
 #include "AEngine/Core/Logger.h"
 #include "AEngine/Core/PerspectiveCamera.h"
 #include "AEngine/Messaging/MessageService.h"
@@ -16,12 +17,22 @@
 #include "AEngine/Render/RenderCommand.h"
 #include "AEngine/Render/RenderPipeline.h"
 #include "AEngine/Render/UIRenderCommand.h"
+#include "AEngine/Script/ScriptEngine.h"
 #include "Components.h"
 #include "Entity.h"
 #include "SceneSerialiser.h"
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <chrono>
 #include <fstream>
 
+namespace
+{
+	// culling a renderable is a bounds update and a frustum test
+	constexpr AEngine::Size_t g_aeCullGrain = 64;
+}
+
 namespace AEngine
 {
 //--------------------------------------------------------------------------------
@@ -35,16 +46,22 @@ namespace AEngine
 // Initialisation and Management
 //--------------------------------------------------------------------------------
 	Scene::Scene(const std::string& ident)
-		: m_ident(ident), m_updateStep{ 1.0f / 60.0f }
+		: m_ident(ident), m_scriptScheduler{ ScriptEngine::GetState() }, m_updateStep{ 1.0f / 60.0f }
 	{
 		UIRenderCommand::Init();
 	}
 
 	Scene::~Scene()
 	{
-		// clear the registry
+		// clear the registry, returning every identifier for reuse
 		PurgeEntitiesStagedForRemoval();
+		auto tagView = m_Registry.view<TagComponent>();
+		for (auto [entity, tag] : tagView.each())
+		{
+			Identifier::Release(tag.ident);
+		}
 		m_Registry.clear();
+		m_entityIndex.Clear();
 
 		// clear the physics world
 		m_physicsWorld.reset();
@@ -74,10 +91,17 @@ namespace AEngine
 // Entity Management
 //--------------------------------------------------------------------------------
 	Entity Scene::CreateEntity(const std::string& name)
+	{
+		return CreateEntity(name, Identifier::Null);
+	}
+
+	Entity Scene::CreateEntity(const std::string& name, Uint64 ident)
 	{
 		// add a transform component and tag component to the entity
-		Entity entity(m_Registry.create(), this);
+		entt::entity handle = m_Registry.create();
+		Entity entity(handle, this);
 		entity.AddComponent<TransformComponent>();
+		entity.AddComponent<WorldTransformComponent>();
 		TagComponent* tag = entity.AddComponent<TagComponent>();
 
 		if (name.empty())
@@ -89,51 +113,58 @@ namespace AEngine
 			tag->tag = name;
 		}
 
-		tag->ident = Identifier::Generate();
+		if (ident != Identifier::Null && Identifier::Acquire(ident))
+		{
+			tag->ident = ident;
+		}
+		else
+		{
+			if (ident != Identifier::Null)
+			{
+				AE_LOG_WARN("Scene::CreateEntity::Identifier -> '{}' is in use or invalid, '{}' was given a new identifier", ident, tag->tag);
+			}
+
+			tag->ident = Identifier::Generate();
+		}
+
+		m_entityIndex.Insert(handle, tag->ident, tag->tag);
 		return entity;
 	}
 
 	Entity Scene::GetEntity(const std::string& tag)
 	{
-		auto entityView = m_Registry.view<TagComponent>();
-		for (auto [entity, TagComponent] : entityView.each())
-		{
-			if (TagComponent.tag == tag)
-			{
-				return Entity(entity, this);
-			}
-		}
+		return Entity(m_entityIndex.Find(tag), this);
+	}
 
-		return Entity(entt::null, this);
+	Entity Scene::GetEntity(Uint64 ident)
+	{
+		return Entity(m_entityIndex.Find(ident), this);
 	}
 
-	Entity Scene::GetEntity(Uint16 ident)
+	std::string Scene::GetEntityName(Uint64 ident)
 	{
-		auto entityView = m_Registry.view<TagComponent>();
-		for (auto [entity, TagComponent] : entityView.each())
+		entt::entity entity = m_entityIndex.Find(ident);
+		if (entity == entt::null)
 		{
-			if (TagComponent.ident == ident)
-			{
-				return Entity(entity, this);
-			}
+			// return empty string if no entity with the given ident was found
+			return std::string();
 		}
 
-		return Entity(entt::null, this);
+		return m_Registry.get<TagComponent>(entity).tag;
 	}
 
-	std::string Scene::GetEntityName(Uint16 ident)
+	bool Scene::RenameEntity(Uint64 ident, const std::string& tag)
 	{
-		auto entityView = m_Registry.view<TagComponent>();
-		for (auto [entity, TagComponent] : entityView.each())
+		entt::entity entity = m_entityIndex.Find(ident);
+		if (entity == entt::null)
 		{
-			if (TagComponent.ident == ident)
-			{
-				return TagComponent.tag;
-			}
+			return false;
 		}
 
-		// return empty string if no entity with the given ident was found
-		return std::string();
+		TagComponent& tagComp = m_Registry.get<TagComponent>(entity);
+		m_entityIndex.Rename(entity, tagComp.tag, tag);
+		tagComp.tag = tag;
+		return true;
 	}
 
 	void Scene::RemoveEntity(const std::string &tag)
@@ -145,7 +176,7 @@ namespace AEngine
 		}
 	}
 
-	void Scene::RemoveEntity(Uint16 ident)
+	void Scene::RemoveEntity(Uint64 ident)
 	{
 		Entity entt = GetEntity(ident);
 		if (entt.IsValid())
@@ -154,7 +185,7 @@ namespace AEngine
 		}
 	}
 
-	void Scene::GetEntityIds(std::vector<Uint16> &entityids)
+	void Scene::GetEntityIds(std::vector<Uint64> &entityids)
 	{
 		auto entityView = m_Registry.view<TagComponent>();
 		for(auto [entity, tc] : entityView.each())
@@ -171,6 +202,23 @@ namespace AEngine
 			// ensure that the entity is still valid, if not, don't need to destroy it
 			if (m_Registry.valid(*it))
 			{
+				if (const TagComponent* tag = m_Registry.try_get<TagComponent>(*it))
+				{
+					m_entityIndex.Erase(*it, tag->ident, tag->tag);
+					Identifier::Release(tag->ident);
+				}
+
+				// unlink from the scene graph, any children become roots
+				if (const HierarchyComponent* hierarchy = m_Registry.try_get<HierarchyComponent>(*it))
+				{
+					while (hierarchy->firstChild != entt::null)
+					{
+						DetachFromParent(hierarchy->firstChild);
+					}
+
+					DetachFromParent(*it);
+				}
+
 				m_Registry.destroy(*it);
 			}
 			// remove the entity from the list of entities staged for removal
@@ -197,14 +245,22 @@ namespace AEngine
 		// update simulation
 		MessageService::DispatchMessages();
 
+		Script::BeginFrame();
 		ScriptOnUpdate(adjustedDt);
 		ScriptOnFixedUpdate(adjustedDt);
+		TransformOnUpdate();
 		PhysicsOnUpdate(adjustedDt);
 		ScriptOnLateUpdate(adjustedDt);
 
 		// purge entities that have been marked for deletion
 		PurgeEntitiesStagedForRemoval();
 
+		// collect the frame's script garbage, including the environments of purged entities
+		ScriptEngine::GetState().StepGC();
+
+		// pick up physics and late script changes before rendering
+		TransformOnUpdate();
+
 		// update the active camera
 		CameraOnUpdate();
 
@@ -215,11 +271,26 @@ namespace AEngine
 			m_activeCamera = &s_debugCamera;
 		}
 
+		// gather the frame state and upload the camera once for every pass
+		BuildFrameContext(m_activeCamera);
+		if (m_activeCamera)
+		{
+			RenderPipeline::Instance().BindFrameUniforms(m_frameContext);
+		}
+
+		// culling, render submission and animation only touch the registry, never the render context
+		if (m_frameJobs.IsEmpty())
+		{
+			BuildFrameJobs();
+		}
+
+		m_frameStep = adjustedDt;
+		m_frameJobs.Run();
 
 		RenderPipeline::Instance().ClearBuffers();
 		RenderPipeline::Instance().BindGeometryPass();
-		RenderOpaqueOnUpdate(m_activeCamera);
-		AnimateOnUpdate(m_activeCamera, adjustedDt);
+		RenderOpaqueOnUpdate();
+		RenderSkinnedOnUpdate();
 		RenderPipeline::Instance().Unbind();
 		RenderPipeline::Instance().BindForwardPass();
 		RenderPipeline::Instance().LightingPass();
@@ -317,11 +388,56 @@ namespace AEngine
 		return m_activeCamera;
 	}
 
+	void Scene::SetLight(const Math::vec3& position, const Math::vec3& color)
+	{
+		m_lightPosition = position;
+		m_lightColor = color;
+	}
+
 	PhysicsWorld *Scene::GetPhysicsWorld() const
 	{
 		return m_physicsWorld.get();
 	}
 
+	RenderQueue::Stats Scene::GetRenderStats() const
+	{
+		const RenderQueue::Stats& opaque = m_opaqueQueue.GetStats();
+		const RenderQueue::Stats& transparent = m_transparentQueue.GetStats();
+
+		RenderQueue::Stats stats;
+		stats.submissions = opaque.submissions + transparent.submissions;
+		stats.drawCalls = opaque.drawCalls + transparent.drawCalls;
+		stats.shaderBinds = opaque.shaderBinds + transparent.shaderBinds;
+		stats.materialBinds = opaque.materialBinds + transparent.materialBinds;
+		stats.vertexArrayBinds = opaque.vertexArrayBinds + transparent.vertexArrayBinds;
+		return stats;
+	}
+
+	const Scene::CullingStats& Scene::GetCullingStats() const
+	{
+		return m_cullingStats;
+	}
+
+	const Scene::PhysicsSyncStats& Scene::GetPhysicsSyncStats() const
+	{
+		return m_physicsSyncStats;
+	}
+
+	AnimationScheduler::Settings& Scene::GetAnimationSettings()
+	{
+		return m_animationScheduler.GetSettings();
+	}
+
+	const AnimationScheduler::Stats& Scene::GetAnimationStats() const
+	{
+		return m_animationScheduler.GetStats();
+	}
+
+	std::vector<JobGraph::Timing> Scene::GetFrameJobTimings() const
+	{
+		return m_frameJobs.GetTimings();
+	}
+
 
 //--------------------------------------------------------------------------------
 // Active Camera Management
@@ -352,25 +468,84 @@ namespace AEngine
 //--------------------------------------------------------------------------------
 	void Scene::PhysicsOnUpdate(TimeStep dt)
 	{
+		m_physicsSyncStats = PhysicsSyncStats{};
+		m_syncEntities.clear();
+
 		// if not in edit mode, update physics
 		if (m_state != State::Edit)
 		{
 			// update physics world
 			m_physicsWorld->OnUpdate(dt);
+			const auto syncStart = std::chrono::steady_clock::now();
 
-			// get transforms for physics handles
+			// gather the bodies, then read back only those the simulation moved
+			m_syncRigidBodies.clear();
 			auto physicsView = m_Registry.view<RigidBodyComponent, TransformComponent>();
 			for (auto [entity, rb, tc] : physicsView.each())
 			{
 				if (rb.ptr)
 				{
-					if (rb.ptr.get())
-					{
-						rb.ptr->GetTransform(tc.translation, tc.orientation);
-					}
+					m_syncEntities.push_back(entity);
+					m_syncRigidBodies.push_back(rb.ptr.get());
+				}
+			}
+
+			const Size_t count = m_syncRigidBodies.size();
+			m_syncMoved.resize(count);
+			m_syncPositions.resize(count);
+			m_syncOrientations.resize(count);
+			const Size_t moved = m_physicsWorld->ReadTransforms(m_syncRigidBodies.data(), count, m_syncMoved.data(), m_syncPositions.data(), m_syncOrientations.data());
+			m_syncChildren.clear();
+			for (Size_t i = 0; i < moved; ++i)
+			{
+				const entt::entity entity = m_syncEntities[m_syncMoved[i]];
+				if (GetParent(entity) != entt::null)
+				{
+					m_syncChildren.push_back(static_cast<Uint32>(i));
+					continue;
+				}
+
+				TransformComponent& tc = physicsView.get<TransformComponent>(entity);
+				tc.translation = m_syncPositions[i];
+				tc.orientation = m_syncOrientations[i];
+			}
+
+			// bodies are simulated in world space, but a child's transform is relative to its parent
+			// a parent may have been moved by this step as well, so the world transforms are rebuilt before each depth
+			std::sort(m_syncChildren.begin(), m_syncChildren.end(), [this](Uint32 lhs, Uint32 rhs) {
+				return m_Registry.get<HierarchyComponent>(m_syncEntities[m_syncMoved[lhs]]).depth
+					< m_Registry.get<HierarchyComponent>(m_syncEntities[m_syncMoved[rhs]]).depth;
+			});
+
+			Uint32 depth = 0;
+			for (Uint32 i : m_syncChildren)
+			{
+				const entt::entity entity = m_syncEntities[m_syncMoved[i]];
+				// copied out, the transform pass may sort the hierarchy storage
+				const HierarchyComponent hierarchyComp = m_Registry.get<HierarchyComponent>(entity);
+				if (hierarchyComp.depth != depth)
+				{
+					TransformOnUpdate();
+					depth = hierarchyComp.depth;
+				}
+
+				TransformComponent& tc = physicsView.get<TransformComponent>(entity);
+				const WorldTransformComponent* parentWorld = m_Registry.try_get<WorldTransformComponent>(hierarchyComp.parent);
+				if (parentWorld)
+				{
+					parentWorld->ToLocal(m_syncPositions[i], m_syncOrientations[i], tc);
+				}
+				else
+				{
+					tc.translation = m_syncPositions[i];
+					tc.orientation = m_syncOrientations[i];
 				}
 			}
 
+			m_physicsSyncStats.bodies = static_cast<Uint32>(count);
+			m_physicsSyncStats.synced = static_cast<Uint32>(moved);
+			m_physicsSyncStats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - syncStart).count();
+
 			// get transforms for player controllers
 			auto playerControllerView = m_Registry.view<PlayerControllerComponent, TransformComponent>();
 			for (auto [entity, pcc, tc] : playerControllerView.each())
@@ -385,44 +560,216 @@ namespace AEngine
 			return;
 		}
 
-		// if in edit mode, use the transform component to update the physics bodies
-		auto physicsView = m_Registry.view<CollisionBodyComponent, TransformComponent>();
-		for (auto [entity, cb, tc] : physicsView.each())
+		// if in edit mode, push the world transforms that were rebuilt since the last sync
+		const auto syncStart = std::chrono::steady_clock::now();
+		m_syncBodies.clear();
+		m_syncPositions.clear();
+		m_syncOrientations.clear();
+
+		auto physicsView = m_Registry.view<CollisionBodyComponent, WorldTransformComponent>();
+		for (auto [entity, cb, wtc] : physicsView.each())
+		{
+			++m_physicsSyncStats.bodies;
+			if (cb.ptr && cb.syncedVersion != wtc.version)
+			{
+				m_syncBodies.push_back(cb.ptr.get());
+				m_syncPositions.push_back(wtc.GetTranslation());
+				m_syncOrientations.push_back(wtc.GetOrientation());
+				cb.syncedVersion = wtc.version;
+			}
+		}
+
+		auto rigidBodyView = m_Registry.view<RigidBodyComponent, WorldTransformComponent>();
+		for (auto [entity, rb, wtc] : rigidBodyView.each())
 		{
-			if (cb.ptr)
+			++m_physicsSyncStats.bodies;
+			if (rb.ptr && rb.syncedVersion != wtc.version)
 			{
-				cb.ptr->SetTransform(tc.translation, tc.orientation);
+				m_syncBodies.push_back(rb.ptr.get());
+				m_syncPositions.push_back(wtc.GetTranslation());
+				m_syncOrientations.push_back(wtc.GetOrientation());
+				rb.syncedVersion = wtc.version;
 			}
 		}
 
-		auto rigidBodyView = m_Registry.view<RigidBodyComponent, TransformComponent>();
-		for (auto [entity, rb, tc] : rigidBodyView.each())
+		m_physicsWorld->WriteTransforms(m_syncBodies.data(), m_syncPositions.data(), m_syncOrientations.data(), m_syncBodies.size());
+		Size_t synced = m_syncBodies.size();
+
+		auto playerControllerView = m_Registry.view<PlayerControllerComponent, WorldTransformComponent>();
+		for (auto [entity, pc, wtc] : playerControllerView.each())
 		{
-			if (rb.ptr)
+			++m_physicsSyncStats.bodies;
+			if (pc.ptr && pc.syncedVersion != wtc.version)
 			{
-				rb.ptr->SetTransform(tc.translation, tc.orientation);
+				pc.ptr->SetTransform(wtc.GetTranslation(), wtc.GetOrientation());
+				pc.syncedVersion = wtc.version;
+				++synced;
 			}
 		}
 
-		auto playerControllerView = m_Registry.view<PlayerControllerComponent, TransformComponent>();
-		for (auto [entity, pc, tc] : playerControllerView.each())
+		m_physicsSyncStats.synced = static_cast<Uint32>(synced);
+		m_physicsSyncStats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - syncStart).count();
+
+		// refresh physics world debug rendering, while it is shown colliders may also have been edited in place
+		if (synced > 0 || m_physicsWorld->IsRenderingEnabled())
+		{
+			m_physicsWorld->ForceRenderingRefresh();
+		}
+	}
+
+	bool Scene::SetParent(entt::entity child, entt::entity parent)
+	{
+		if (!m_Registry.valid(child) || (parent != entt::null && !m_Registry.valid(parent)))
+		{
+			return false;
+		}
+
+		// an entity can not be attached below itself
+		for (entt::entity ancestor = parent; ancestor != entt::null; ancestor = GetParent(ancestor))
 		{
-			if (pc.ptr)
+			if (ancestor == child)
 			{
-				pc.ptr->SetTransform(tc.translation, tc.orientation);
+				AE_LOG_ERROR("Scene::SetParent::Error -> Parent is a descendant of the child");
+				return false;
 			}
 		}
 
-		// refresh physics world debug rendering
-		m_physicsWorld->ForceRenderingRefresh();
+		DetachFromParent(child);
+		if (parent == entt::null)
+		{
+			return true;
+		}
+
+		// emplace both before taking references, an emplace can move the other component
+		m_Registry.get_or_emplace<HierarchyComponent>(child);
+		m_Registry.get_or_emplace<HierarchyComponent>(parent);
+		HierarchyComponent& childComp = m_Registry.get<HierarchyComponent>(child);
+		HierarchyComponent& parentComp = m_Registry.get<HierarchyComponent>(parent);
+
+		// push the child onto the front of the parent's children
+		childComp.parent = parent;
+		childComp.prevSibling = entt::null;
+		childComp.nextSibling = parentComp.firstChild;
+		if (parentComp.firstChild != entt::null)
+		{
+			m_Registry.get<HierarchyComponent>(parentComp.firstChild).prevSibling = child;
+		}
+		parentComp.firstChild = child;
+
+		SetHierarchyDepth(child, parentComp.depth + 1);
+		if (WorldTransformComponent* worldComp = m_Registry.try_get<WorldTransformComponent>(child))
+		{
+			worldComp->dirty = true;
+		}
+
+		return true;
+	}
+
+	entt::entity Scene::GetParent(entt::entity entity) const
+	{
+		const HierarchyComponent* hierarchyComp = m_Registry.try_get<HierarchyComponent>(entity);
+		return hierarchyComp ? hierarchyComp->parent : entt::null;
+	}
+
+	void Scene::DetachFromParent(entt::entity child)
+	{
+		HierarchyComponent* childComp = m_Registry.try_get<HierarchyComponent>(child);
+		if (!childComp || childComp->parent == entt::null)
+		{
+			return;
+		}
+
+		// unlink from the parent's children
+		if (childComp->prevSibling != entt::null)
+		{
+			m_Registry.get<HierarchyComponent>(childComp->prevSibling).nextSibling = childComp->nextSibling;
+		}
+		else
+		{
+			m_Registry.get<HierarchyComponent>(childComp->parent).firstChild = childComp->nextSibling;
+		}
+
+		if (childComp->nextSibling != entt::null)
+		{
+			m_Registry.get<HierarchyComponent>(childComp->nextSibling).prevSibling = childComp->prevSibling;
+		}
+
+		childComp->parent = entt::null;
+		childComp->prevSibling = entt::null;
+		childComp->nextSibling = entt::null;
+		SetHierarchyDepth(child, 0);
+
+		if (WorldTransformComponent* worldComp = m_Registry.try_get<WorldTransformComponent>(child))
+		{
+			worldComp->dirty = true;
+		}
+	}
+
+	void Scene::SetHierarchyDepth(entt::entity entity, Uint32 depth)
+	{
+		HierarchyComponent& hierarchyComp = m_Registry.get<HierarchyComponent>(entity);
+		hierarchyComp.depth = depth;
+		for (entt::entity child = hierarchyComp.firstChild; child != entt::null; child = m_Registry.get<HierarchyComponent>(child).nextSibling)
+		{
+			SetHierarchyDepth(child, depth + 1);
+		}
+
+		m_hierarchyChanged = true;
+	}
+
+	void Scene::TransformOnUpdate()
+	{
+		// entities outside the scene graph only depend on their own transform
+		// ui entities are placed by their rect transform
+		auto transformView = m_Registry.view<TransformComponent, WorldTransformComponent>(entt::exclude<HierarchyComponent, RectTransformComponent>);
+		for (auto [entity, transformComp, worldComp] : transformView.each())
+		{
+			worldComp.Update(transformComp, nullptr);
+		}
+
+		auto rectTransformView = m_Registry.view<RectTransformComponent, WorldTransformComponent>(entt::exclude<HierarchyComponent>);
+		for (auto [entity, rectTransformComp, worldComp] : rectTransformView.each())
+		{
+			worldComp.Update(rectTransformComp, nullptr);
+		}
+
+		// sort the graph by depth so every parent is visited before its children
+		if (m_hierarchyChanged)
+		{
+			m_Registry.sort<HierarchyComponent>([](const HierarchyComponent& lhs, const HierarchyComponent& rhs) {
+				return lhs.depth < rhs.depth;
+			});
+			m_hierarchyChanged = false;
+		}
+
+		// a rebuilt parent bumps its version, which marks its children on the way down
+		auto hierarchyView = m_Registry.view<HierarchyComponent>();
+		for (entt::entity entity : hierarchyView)
+		{
+			WorldTransformComponent* worldComp = m_Registry.try_get<WorldTransformComponent>(entity);
+			if (!worldComp)
+			{
+				continue;
+			}
+
+			const TransformComponent* local = m_Registry.try_get<RectTransformComponent>(entity);
+			if (!local)
+			{
+				local = m_Registry.try_get<TransformComponent>(entity);
+			}
+
+			const entt::entity parent = hierarchyView.get<HierarchyComponent>(entity).parent;
+			const WorldTransformComponent* parentWorld = (parent != entt::null) ? m_Registry.try_get<WorldTransformComponent>(parent) : nullptr;
+			worldComp->Update(local ? *local : TransformComponent(), parentWorld);
+		}
 	}
 
 	void Scene::CameraOnUpdate()
 	{
-		auto cameraView = m_Registry.view<CameraComponent, TransformComponent>();
-		for (auto [entity, cameraComp, transformComp] : cameraView.each())
+		auto cameraView = m_Registry.view<CameraComponent, WorldTransformComponent>();
+		for (auto [entity, cameraComp, worldComp] : cameraView.each())
 		{
-			cameraComp.camera.SetViewMatrix(Math::inverse(transformComp.ToMat4()));
+			cameraComp.camera.SetViewMatrix(Math::inverse(worldComp.matrix));
 
 			// set the default camera
 			if (cameraComp.defaultCamera)
@@ -434,11 +781,8 @@ namespace AEngine
 
 	void Scene::ScriptOnUpdate(TimeStep dt)
 	{
-		auto scriptView = m_Registry.view<ScriptableComponent>();
-		for (auto [entity, script] : scriptView.each())
-		{
-			script.script->OnUpdate(dt);
-		}
+		SubmitScripts();
+		m_scriptScheduler.Run(EntityScript::Update, dt);
 	}
 
 	void Scene::ScriptOnFixedUpdate(TimeStep dt)
@@ -447,86 +791,206 @@ namespace AEngine
 		accumulator += dt;
 
 		// update scripts if enough time has passed
-		auto scriptView = m_Registry.view<ScriptableComponent>();
+		if (accumulator < m_updateStep)
+		{
+			return;
+		}
+
+		SubmitScripts();
 		while (accumulator >= m_updateStep)
 		{
 			accumulator -= m_updateStep;
-			for (auto [entity, script] : scriptView.each())
-			{
-				script.script->OnFixedUpdate(m_updateStep);
-			}
+			m_scriptScheduler.Run(EntityScript::FixedUpdate, m_updateStep);
 		}
 	}
 
 	void Scene::ScriptOnLateUpdate(TimeStep dt)
 	{
+		SubmitScripts();
+		m_scriptScheduler.Run(EntityScript::LateUpdate, dt);
+	}
+
+	void Scene::SubmitScripts()
+	{
+		// scripts may be added or removed by the previous phase, so each phase submits them again
+		m_scriptScheduler.Clear();
 		auto scriptView = m_Registry.view<ScriptableComponent>();
 		for (auto [entity, script] : scriptView.each())
 		{
-			script.script->OnLateUpdate(dt);
+			m_scriptScheduler.Submit(*script.script);
+		}
+	}
+
+	void Scene::BuildFrameContext(const PerspectiveCamera* camera)
+	{
+		m_frameContext = FrameContext{};
+		m_frameContext.camera = camera;
+		m_frameContext.lightPosition = m_lightPosition;
+		m_frameContext.lightColor = m_lightColor;
+		if (camera)
+		{
+			// the camera position is the translation of the inverse view
+			m_frameContext.cameraPosition = Math::vec3(Math::inverse(camera->GetViewMatrix())[3]);
+		}
+
+		// the first active skybox provides the environment map
+		auto skyboxView = m_Registry.view<SkyboxComponent>();
+		for (auto [entity, skyboxComp] : skyboxView.each())
+		{
+			if (skyboxComp.active && skyboxComp.skybox)
+			{
+				m_frameContext.environment = skyboxComp.skybox->GetCubeMap().get();
+				break;
+			}
+		}
+	}
+
+	void Scene::CullOnUpdate(const PerspectiveCamera* camera)
+	{
+		m_cullingStats = CullingStats{};
+		if (camera == nullptr)
+		{
+			return;
+		}
+
+		// bounds are added up front, the parallel pass must not change the registry's structure
+		auto renderView = m_Registry.view<RenderableComponent, WorldTransformComponent>();
+		for (entt::entity entity : renderView)
+		{
+			m_Registry.get_or_emplace<BoundsComponent>(entity);
 		}
+
+		auto skinnedView = m_Registry.view<SkinnedRenderableComponent, WorldTransformComponent>();
+		for (entt::entity entity : skinnedView)
+		{
+			m_Registry.get_or_emplace<BoundsComponent>(entity);
+		}
+
+		const Math::Frustum frustum = camera->GetFrustum();
+		std::atomic<Uint32> visible{ 0 };
+		std::atomic<Uint32> culled{ 0 };
+		auto cull = [&frustum, &visible, &culled](BoundsComponent& boundsComp, const Model& model, const WorldTransformComponent& worldComp) {
+			boundsComp.Update(model, worldComp);
+
+			// models without geometry have no bounds, never cull them
+			boundsComp.visible = !boundsComp.world.IsValid() || frustum.Intersects(boundsComp.world);
+			boundsComp.visible ? visible.fetch_add(1, std::memory_order_relaxed) : culled.fetch_add(1, std::memory_order_relaxed);
+		};
+
+		auto renderBoundsView = m_Registry.view<RenderableComponent, WorldTransformComponent, BoundsComponent>();
+		JobSystem::Instance().ParallelForEach(renderBoundsView, g_aeCullGrain, [&renderBoundsView, &cull](entt::entity entity) {
+			auto [renderComp, worldComp, boundsComp] = renderBoundsView.get(entity);
+			if (renderComp.active && renderComp.model)
+			{
+				cull(boundsComp, *renderComp.model, worldComp);
+			}
+		});
+
+		auto skinnedBoundsView = m_Registry.view<SkinnedRenderableComponent, WorldTransformComponent, BoundsComponent>();
+		JobSystem::Instance().ParallelForEach(skinnedBoundsView, g_aeCullGrain, [&skinnedBoundsView, &cull](entt::entity entity) {
+			auto [renderComp, worldComp, boundsComp] = skinnedBoundsView.get(entity);
+			if (renderComp.active && renderComp.model)
+			{
+				cull(boundsComp, *renderComp.model, worldComp);
+			}
+		});
+
+		m_cullingStats.visible = visible;
+		m_cullingStats.culled = culled;
+	}
+
+	void Scene::BuildFrameJobs()
+	{
+		const JobGraph::Stage cull = m_frameJobs.Add("Cull", [this]() { CullOnUpdate(m_activeCamera); });
+		const JobGraph::Stage opaque = m_frameJobs.Add("Submit Opaque", [this]() { SubmitOpaqueOnUpdate(m_activeCamera); });
+		const JobGraph::Stage animate = m_frameJobs.Add("Animate", [this]() { AnimateOnUpdate(m_activeCamera, m_frameStep); });
+		m_frameJobs.Precede(cull, opaque);
+		m_frameJobs.Precede(cull, animate);
 	}
 
-	void Scene::RenderOpaqueOnUpdate(const PerspectiveCamera* activeCam)
+	void Scene::SubmitOpaqueOnUpdate(const PerspectiveCamera* activeCam)
 	{
+		m_opaqueQueue.Clear();
 		if (activeCam == nullptr)
 		{
 			return;
 		}
 
-		auto renderView = m_Registry.view<RenderableComponent, TransformComponent>();
-		for (auto [entity, renderComp, transformComp] : renderView.each())
+		// gather all opaque meshes, the queue will sort and instance them
+		auto renderView = m_Registry.view<RenderableComponent, WorldTransformComponent, BoundsComponent>();
+		for (auto [entity, renderComp, worldComp, boundsComp] : renderView.each())
 		{
 			// ensure that all needed fields are valid
-			if (renderComp.active && renderComp.model && renderComp.shader)
+			if (renderComp.active && boundsComp.visible && renderComp.model && renderComp.shader)
 			{
-				renderComp.model->RenderOpaque(
-					transformComp.ToMat4(), *renderComp.shader, activeCam->GetProjectionViewMatrix()
-				);
+				m_opaqueQueue.Submit(*renderComp.model, *renderComp.shader, worldComp.matrix);
 			}
 		}
 	}
 
+	void Scene::RenderOpaqueOnUpdate()
+	{
+		m_opaqueQueue.Flush(m_frameContext);
+	}
+
 	void Scene::RenderTransparentOnUpdate(const PerspectiveCamera* activeCam)
 	{
+		m_transparentQueue.Clear();
 		if (activeCam == nullptr)
 		{
 			return;
 		}
 
-		auto renderView = m_Registry.view<RenderableComponent, TransformComponent>();
-		for (auto [entity, renderComp, transformComp] : renderView.each())
+		const Shader& transparentShader = *RenderPipeline::Instance().GetTransparentShader();
+		auto renderView = m_Registry.view<RenderableComponent, WorldTransformComponent, BoundsComponent>();
+		for (auto [entity, renderComp, worldComp, boundsComp] : renderView.each())
 		{
-			if (renderComp.active)
+			if (renderComp.active && boundsComp.visible && renderComp.model)
 			{
-				renderComp.model->RenderTransparent(
-					transformComp.ToMat4(), *RenderPipeline::Instance().GetTransparentShader(), activeCam->GetProjectionViewMatrix()
-				);
+				m_transparentQueue.Submit(*renderComp.model, transparentShader, worldComp.matrix);
 			}
 		}
+
+		m_transparentQueue.Flush(m_frameContext);
 	}
 
 	void Scene::AnimateOnUpdate(const PerspectiveCamera* activeCam, const TimeStep dt)
 	{
+		m_animationScheduler.Clear();
+		m_skinnedDraws.clear();
 		if (activeCam == nullptr)
 		{
 			return;
 		}
 
-		auto renderView = m_Registry.view<SkinnedRenderableComponent, TransformComponent>();
-		for (auto [entity, renderComp, transformComp] : renderView.each())
+		// off screen animations are kept in step so they do not jump when they become visible
+		auto renderView = m_Registry.view<SkinnedRenderableComponent, WorldTransformComponent, BoundsComponent>();
+		for (auto [entity, renderComp, worldComp, boundsComp] : renderView.each())
 		{
 			if (renderComp.active)
 			{
-				renderComp.model->Render(
-					transformComp.ToMat4(),
-					*renderComp.shader,
-					activeCam->GetProjectionViewMatrix(),
-					renderComp.animator,
-					dt
-				);
+				const float distance = Math::distance(Math::vec3(worldComp.matrix[3]), m_frameContext.cameraPosition);
+				const Uint32 slot = m_animationScheduler.Submit(renderComp.animator, distance, boundsComp.visible, static_cast<Uint32>(entity));
+				if (slot != AnimationScheduler::InvalidSlot)
+				{
+					m_skinnedDraws.push_back({ renderComp.model.get(), renderComp.shader.get(), &worldComp.matrix, slot });
+				}
 			}
 		}
+
+		// poses are evaluated across the job system
+		m_animationScheduler.Update(dt);
+	}
+
+	void Scene::RenderSkinnedOnUpdate()
+	{
+		// every palette is uploaded at once, then each draw binds its own range
+		m_animationScheduler.UploadPalette();
+		for (const SkinnedDraw& draw : m_skinnedDraws)
+		{
+			m_animationScheduler.BindPalette(draw.slot);
+			draw.model->Render(*draw.transform, *draw.shader, m_frameContext);
+		}
 	}
 
 	void Scene::SkyboxOnUpdate(const PerspectiveCamera* camera)
@@ -541,7 +1005,7 @@ namespace AEngine
 		{
 			if (skyboxComp.active)
 			{
-				skyboxComp.skybox->Render(*(skyboxComp.shader), camera->GetProjectionMatrix(), camera->GetViewMatrix());
+				skyboxComp.skybox->Render(*(skyboxComp.shader));
 			}
 		}
 	}
@@ -553,7 +1017,7 @@ namespace AEngine
 		{
 			if (navGridComp.debug)
 			{
-				navGridComp.grid->DebugRender(camera);
+				navGridComp.grid->DebugRender();
 			}
 		}
 	}
@@ -565,21 +1029,21 @@ namespace AEngine
 			return;
 		}
 
-		auto panelView = m_Registry.view<RectTransformComponent, CanvasRendererComponent, PanelComponent>();
-		for (auto [entity, rectTransformComp, canvasComp, imgComp] : panelView.each())
+		auto panelView = m_Registry.view<WorldTransformComponent, CanvasRendererComponent, PanelComponent>();
+		for (auto [entity, worldComp, canvasComp, imgComp] : panelView.each())
 		{
 			if (canvasComp.active && !canvasComp.screenSpace)
 			{
-				UIRenderCommand::Render(canvasComp.billboard, false, camera, rectTransformComp.ToMat4(), imgComp.texture, imgComp.color);
+				UIRenderCommand::Render(canvasComp.billboard, false, camera, worldComp.matrix, imgComp.texture, imgComp.color);
 			}
 		}
 
-		auto textView = m_Registry.view<RectTransformComponent, CanvasRendererComponent, TextComponent>();
-		for (auto [entity, rectTransformComp, canvasComp, textComp] : textView.each())
+		auto textView = m_Registry.view<WorldTransformComponent, CanvasRendererComponent, TextComponent>();
+		for (auto [entity, worldComp, canvasComp, textComp] : textView.each())
 		{
 			if (canvasComp.active && !canvasComp.screenSpace)
 			{
-				textComp.font->Render(canvasComp.billboard, false, camera, textComp.text, rectTransformComp.ToMat4(), textComp.color);
+				textComp.font->Render(canvasComp.billboard, false, camera, textComp.text, worldComp.matrix, textComp.color);
 			}
 		}
 	}
@@ -591,21 +1055,21 @@ namespace AEngine
 			return;
 		}
 
-		auto panelView = m_Registry.view<RectTransformComponent, CanvasRendererComponent, PanelComponent>();
-		for (auto [entity, rectTransformComp, canvasComp, imgComp] : panelView.each())
+		auto panelView = m_Registry.view<WorldTransformComponent, CanvasRendererComponent, PanelComponent>();
+		for (auto [entity, worldComp, canvasComp, imgComp] : panelView.each())
 		{
 			if (canvasComp.active && canvasComp.screenSpace)
 			{
-				UIRenderCommand::Render(canvasComp.billboard, true, camera, rectTransformComp.ToMat4(), imgComp.texture, imgComp.color);
+				UIRenderCommand::Render(canvasComp.billboard, true, camera, worldComp.matrix, imgComp.texture, imgComp.color);
 			}
 		}
 
-		auto textView = m_Registry.view<RectTransformComponent, CanvasRendererComponent, TextComponent>();
-		for (auto [entity, rectTransformComp, canvasComp, textComp] : textView.each())
+		auto textView = m_Registry.view<WorldTransformComponent, CanvasRendererComponent, TextComponent>();
+		for (auto [entity, worldComp, canvasComp, textComp] : textView.each())
 		{
 			if (canvasComp.active && canvasComp.screenSpace)
 			{
-				textComp.font->Render(canvasComp.billboard, true, camera, textComp.text, rectTransformComp.ToMat4(), textComp.color);
+				textComp.font->Render(canvasComp.billboard, true, camera, textComp.text, worldComp.matrix, textComp.color);
 			}
 		}
 	}
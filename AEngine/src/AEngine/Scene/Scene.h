@@ -1,10 +1,16 @@
 #pragma once
+#include "AEngine/Core/JobGraph.h"
 #include "AEngine/Core/TimeStep.h"
 #include "AEngine/Core/Types.h"
 #include "AEngine/Physics/Physics.h"
 #include "AEngine/Physics/Renderer.h"
+#include "AEngine/Render/AnimationScheduler.h"
+#include "AEngine/Render/FrameContext.h"
+#include "AEngine/Render/RenderQueue.h"
+#include "AEngine/Script/ScriptScheduler.h"
 #include "Components.h"
 #include "DebugCamera.h"
+#include "EntityIndex.h"
 #include <EnTT/entt.hpp>
 #include <stack>
 #include <string>
@@ -48,6 +54,14 @@ namespace AEngine
 			 * \return Entity
 			**/
 		Entity CreateEntity(const std::string& name = std::string());
+			/**
+			 * \brief Method to create Entities with a known identifier
+			 * \param[in] name of entity
+			 * \param[in] ident to restore, a new identifier is generated if it is in use
+			 * \return Entity
+			 * \note Used when loading serialised scenes so identifiers stay stable
+			*/
+		Entity CreateEntity(const std::string& name, Uint64 ident);
 			/**
 			 * \brief Method to retrieve an Entity from the Scene
 			 * \param[in] tag of entity
@@ -61,15 +75,23 @@ namespace AEngine
 			 * \return Entity
 			 * \note Check the Entity::IsValid() method before using the Entity
 			*/
-		Entity GetEntity(Uint16 ident);
+		Entity GetEntity(Uint64 ident);
 
-		std::string GetEntityName(Uint16 ident);
+		std::string GetEntityName(Uint64 ident);
+			/**
+			 * \brief Changes the tag of an entity
+			 * \param[in] ident of entity
+			 * \param[in] tag to apply
+			 * \return True if the entity exists
+			 * \note Tags must be changed through the scene to keep lookups by tag valid
+			*/
+		bool RenameEntity(Uint64 ident, const std::string& tag);
 
 		void RemoveEntity(const std::string& tag);
-		void RemoveEntity(Uint16 ident);
+		void RemoveEntity(Uint64 ident);
 
 		/// \todo Get all entities method
-		void GetEntityIds(std::vector<Uint16>& entityids);
+		void GetEntityIds(std::vector<Uint64>& entityids);
 
 //--------------------------------------------------------------------------------
 // Events
@@ -116,8 +138,64 @@ namespace AEngine
 			 * \return PerspectiveCamera*
 			**/
 		PerspectiveCamera* GetActiveCamera() const;
+			/**
+			 * \brief Sets the light used by the lighting pass
+			 * \param[in] position of the light in world space
+			 * \param[in] color of the light
+			 * \note Takes effect from the next frame
+			**/
+		void SetLight(const Math::vec3& position, const Math::vec3& color);
 
 		PhysicsWorld* GetPhysicsWorld() const;
+			/**
+			 * \brief Returns the render queue stats of the last frame
+			 * \return Combined stats of the opaque and transparent queues
+			*/
+		RenderQueue::Stats GetRenderStats() const;
+			/**
+			 * \struct CullingStats
+			 * \brief Results of the last culling pass
+			*/
+		struct CullingStats
+		{
+			Uint32 visible{ 0 };   ///< Number of renderables inside the camera frustum
+			Uint32 culled{ 0 };    ///< Number of renderables skipped
+		};
+			/**
+			 * \brief Returns the culling stats of the last frame
+			 * \return Visible and culled renderable counts
+			*/
+		const CullingStats& GetCullingStats() const;
+			/**
+			 * \struct PhysicsSyncStats
+			 * \brief Results of the last transform sync with the physics world
+			*/
+		struct PhysicsSyncStats
+		{
+			Uint32 bodies{ 0 };      ///< Number of bodies checked
+			Uint32 synced{ 0 };      ///< Number of transforms copied to or from the physics world
+			double seconds{ 0.0 };   ///< Time spent syncing, excluding the simulation step
+		};
+			/**
+			 * \brief Returns the physics sync stats of the last frame
+			 * \return Bodies checked and synced, and the time taken
+			*/
+		const PhysicsSyncStats& GetPhysicsSyncStats() const;
+			/**
+			 * \brief Returns the animation level of detail settings
+			 * \return Settings that may be changed between frames
+			*/
+		AnimationScheduler::Settings& GetAnimationSettings();
+			/**
+			 * \brief Returns the animation stats of the last frame
+			 * \return Animators advanced, and poses evaluated, shared and deferred
+			*/
+		const AnimationScheduler::Stats& GetAnimationStats() const;
+			/**
+			 * \brief Returns how long each stage of the frame's job graph took
+			 * \return Timings of culling, render submission and animation
+			*/
+		std::vector<JobGraph::Timing> GetFrameJobTimings() const;
 
 //--------------------------------------------------------------------------------
 // Debug Camera
@@ -157,6 +235,44 @@ namespace AEngine
 		entt::registry m_Registry;
 		UniquePtr<PhysicsWorld> m_physicsWorld;
 		std::vector<entt::entity> m_entitiesStagedForRemoval;
+		EntityIndex m_entityIndex;
+
+		// render submission
+		RenderQueue m_opaqueQueue{ RenderQueue::Pass::Opaque };
+		RenderQueue m_transparentQueue{ RenderQueue::Pass::Transparent };
+		CullingStats m_cullingStats;
+		FrameContext m_frameContext;
+		Math::vec3 m_lightPosition{ 10.0f, 10.0f, 10.0f };
+		Math::vec3 m_lightColor{ 1.0f, 1.0f, 1.0f };
+		AnimationScheduler m_animationScheduler;
+		ScriptScheduler m_scriptScheduler;
+
+		// skinned models drawn this frame, each with its slot of the bone palette
+		struct SkinnedDraw
+		{
+			Model* model;
+			const Shader* shader;
+			const Math::mat4* transform;
+			Uint32 slot;
+		};
+		std::vector<SkinnedDraw> m_skinnedDraws;
+
+		// transforms passed to and from the physics world, kept between frames to avoid reallocating
+		PhysicsSyncStats m_physicsSyncStats;
+		std::vector<entt::entity> m_syncEntities;
+		std::vector<CollisionBody*> m_syncBodies;
+		std::vector<RigidBody*> m_syncRigidBodies;
+		std::vector<Uint32> m_syncMoved;
+		std::vector<Uint32> m_syncChildren;   // moved bodies with a parent, as indices into m_syncMoved
+		std::vector<Math::vec3> m_syncPositions;
+		std::vector<Math::quat> m_syncOrientations;
+
+		// systems run on the job system each frame
+		JobGraph m_frameJobs;
+		TimeStep m_frameStep;
+
+		// scene graph
+		bool m_hierarchyChanged{ false };
 
 		// update systems
 		unsigned int m_refreshRate{ 60 };
@@ -188,6 +304,40 @@ namespace AEngine
 			 * \brief Removes entities from registry that have been staged for removal
 			*/
 		void PurgeEntitiesStagedForRemoval();
+			/**
+			 * \brief Attaches an entity to a parent
+			 * \param[in] child entity to attach
+			 * \param[in] parent to attach to, entt::null detaches the child
+			 * \retval true if the child was attached or detached
+			 * \retval false if either entity is invalid or the parent is a descendant of the child
+			 * \note The child's transform component is kept, and is now relative to the parent
+			*/
+		bool SetParent(entt::entity child, entt::entity parent);
+			/**
+			 * \brief Returns the parent of an entity
+			 * \param[in] entity to query
+			 * \return The parent, or entt::null if the entity is a root
+			*/
+		entt::entity GetParent(entt::entity entity) const;
+			/**
+			 * \brief Unlinks an entity from its parent, making it a root
+			 * \param[in] child entity to unlink
+			*/
+		void DetachFromParent(entt::entity child);
+			/**
+			 * \brief Sets the depth of an entity and all of its descendants
+			 * \param[in] entity to update
+			 * \param[in] depth of the entity
+			*/
+		void SetHierarchyDepth(entt::entity entity, Uint32 depth);
+			/**
+			 * \brief Rebuilds the world transforms that have changed since the last pass
+			 * \details
+			 * Parents are visited before their children, so a change to a transform is carried to
+			 * every descendant in a single pass. Entities whose transform and ancestors are unchanged
+			 * are skipped.
+			*/
+		void TransformOnUpdate();
 			/**
 			 * \brief Updates the cameras in the scene
 			 * \todo Refactor this to only update the active camera
@@ -195,17 +345,48 @@ namespace AEngine
 			*/
 		void CameraOnUpdate();
 			/**
-			 * \brief Calls modern render system with the given camera
+			 * \brief Queues the visible opaque meshes
 			 * \param[in] camera to render scene from
+			 * \note Does not touch the render context, so it runs on the frame's job graph
 			**/
-		void RenderOpaqueOnUpdate(const PerspectiveCamera* activeCam);
+		void SubmitOpaqueOnUpdate(const PerspectiveCamera* activeCam);
+			/**
+			 * \brief Draws the opaque meshes queued by SubmitOpaqueOnUpdate()
+			**/
+		void RenderOpaqueOnUpdate();
+			/**
+			 * \brief Updates the bounds of every renderable and tests them against the camera frustum
+			 * \param[in] camera to cull against
+			 * \note Must run before the render systems, which skip entities that are not visible
+			*/
+		void CullOnUpdate(const PerspectiveCamera* camera);
+			/**
+			 * \brief Builds the job graph of the systems that run between the camera update and rendering
+			 * \details Culling runs first, then opaque submission and animation run alongside each other
+			*/
+		void BuildFrameJobs();
+			/**
+			 * \brief Gathers the state shared by every draw of the frame
+			 * \param[in] camera the frame is rendered from
+			*/
+		void BuildFrameContext(const PerspectiveCamera* camera);
 		void RenderTransparentOnUpdate(const PerspectiveCamera* activeCam);
 		void RenderWorldSpaceUI(const PerspectiveCamera* camera);
 		void RenderScreenSpaceUI(const PerspectiveCamera* camera);
 
 		void RenderDebugGrid(const PerspectiveCamera* camera);
 
+			/**
+			 * \brief Updates skinned animations and gathers the visible skinned models
+			 * \param[in] camera to render scene from
+			 * \param[in] dt timestep
+			 * \note Distant animations are evaluated less often, see AnimationScheduler
+			*/
 		void AnimateOnUpdate(const PerspectiveCamera* activeCam, const TimeStep dt);
+			/**
+			 * \brief Uploads the bone palette and draws the skinned models gathered by AnimateOnUpdate()
+			*/
+		void RenderSkinnedOnUpdate();
 			/**
 			 * \brief Calls modern skybox system with the given camera
 			 * \param[in] camera to render scene from
@@ -223,5 +404,9 @@ namespace AEngine
 		void ScriptOnUpdate(TimeStep dt);
 		void ScriptOnFixedUpdate(TimeStep dt);
 		void ScriptOnLateUpdate(TimeStep dt);
+			/**
+			 * \brief Submits the scripts of the scene to the script scheduler
+			*/
+		void SubmitScripts();
 	};
 }
@@ -1,4 +1,7 @@
 #include <fstream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 #include <yaml-cpp/yaml.h>
 #include "AEngine/Core/Identifier.h"
 #include "AEngine/Core/Logger.h"
@@ -11,6 +14,7 @@
 
 /// @todo Remove managers
 #include "AEngine/Resource/AssetManager.h"
+#include "AEngine/Resource/AssetLoader.h"
 
 //--------------------------------------------------------------------------------
 // Custom Nodes
@@ -337,9 +341,19 @@ namespace AEngine
 				TagComponent& tag = scene->m_Registry.get<TagComponent>(entity);
 				YAML::Node tagNode;
 				tagNode["tag"] = tag.tag;
+				tagNode["ident"] = tag.ident;
 				entityNode["TagComponent"] = tagNode;
 			}
 
+			// Hierarchy Component
+			entt::entity parent = scene->GetParent(entity);
+			if (parent != entt::null)
+			{
+				YAML::Node hierarchyNode;
+				hierarchyNode["parent"] = scene->m_Registry.get<TagComponent>(parent).ident;
+				entityNode["HierarchyComponent"] = hierarchyNode;
+			}
+
 				// RectTransform Component
 			if (scene->m_Registry.all_of<RectTransformComponent>(entity))
 			{
@@ -588,7 +602,7 @@ namespace AEngine
 
 	void SceneSerialiser::DeserialiseNode(Scene* scene, YAML::Node data)
 	{
-		// assets
+		// assets, decoded together on the loader's workers
 		YAML::Node assets = data["assets"];
 		if (assets)
 		{
@@ -598,19 +612,38 @@ namespace AEngine
 			}
 		}
 
+		// components look their assets up directly, so every asset must be created first
+		AssetLoader::Instance().Flush();
+
 		// entities
 		YAML::Node entities = data["entities"];
 		if (entities)
 		{
+			// parents may be saved after their children, so link them once every entity exists
+			std::unordered_map<Uint64, Entity> loaded;
+			std::vector<std::pair<Entity, Uint64>> parents;
+
 			for (YAML::Node entityNode : entities)
 			{
 				// generate tag for entity
 				const std::string name = SceneSerialiser::DeserialiseTag(entityNode);
+				const Uint64 savedIdent = SceneSerialiser::DeserialiseIdent(entityNode);
 				Entity entity = scene->GetEntity(name);
 				if (!entity)
 				{
-					// generte entity if doesn't exist
-					entity = scene->CreateEntity(name);
+					// generate entity if doesn't exist, keeping the saved identifier when possible
+					entity = scene->CreateEntity(name, savedIdent);
+				}
+
+				if (savedIdent != Identifier::Null)
+				{
+					loaded[savedIdent] = entity;
+				}
+
+				YAML::Node hierarchyNode = entityNode["HierarchyComponent"];
+				if (hierarchyNode)
+				{
+					parents.emplace_back(entity, hierarchyNode["parent"].as<Uint64>());
 				}
 
 				SceneSerialiser::DeserialiseTransform(entityNode, entity);
@@ -636,6 +669,18 @@ namespace AEngine
 				// this must be last!!!
 				SceneSerialiser::DeserialiseScript(entityNode, entity);
 			}
+
+			for (auto& [child, parentIdent] : parents)
+			{
+				auto it = loaded.find(parentIdent);
+				if (it == loaded.end())
+				{
+					AE_LOG_WARN("Serialisation::Load::Hierarchy::Warning -> Parent '{}' was not found", parentIdent);
+					continue;
+				}
+
+				child.SetParent(it->second);
+			}
 		}
 	}
 
@@ -649,35 +694,35 @@ namespace AEngine
 
 		if (type == "model")
 		{
-			AssetManager<Model>::Instance().Load(path);
+			AssetManager<Model>::Instance().LoadAsync(path);
 		}
 		else if (type == "map")
 		{
-			AssetManager<HeightMap>::Instance().Load(path);
+			AssetManager<HeightMap>::Instance().LoadAsync(path);
 		}
 		else if (type == "shader")
 		{
-			AssetManager<Shader>::Instance().Load(path);
+			AssetManager<Shader>::Instance().LoadAsync(path);
 		}
 		else if (type == "texture")
 		{
-			AssetManager<Texture>::Instance().Load(path);
+			AssetManager<Texture>::Instance().LoadAsync(path);
 		}
 		else if (type == "script")
 		{
-			AssetManager<Script>::Instance().Load(path);
+			AssetManager<Script>::Instance().LoadAsync(path);
 		}
 		else if (type == "model")
 		{
-			AssetManager<Model>::Instance().Load(path);
+			AssetManager<Model>::Instance().LoadAsync(path);
 		}
 		else if (type == "font")
 		{
-			AssetManager<Font>::Instance().Load(path);
+			AssetManager<Font>::Instance().LoadAsync(path);
 		}
 		else if (type == "grid")
 		{
-			AssetManager<Grid>::Instance().Load(path);
+			AssetManager<Grid>::Instance().LoadAsync(path);
 		}
 		else
 		{
@@ -697,6 +742,18 @@ namespace AEngine
 		return name;
 	}
 
+	inline Uint64 SceneSerialiser::DeserialiseIdent(YAML::Node& root)
+	{
+		// scenes saved before identifiers were serialised have no ident
+		YAML::Node tagNode = root["TagComponent"];
+		if (tagNode && tagNode["ident"])
+		{
+			return tagNode["ident"].as<Uint64>();
+		}
+
+		return Identifier::Null;
+	}
+
 	inline void SceneSerialiser::DeserialiseTransform(YAML::Node& root, Entity& entity)
 	{
 		YAML::Node transformNode = root["TransformComponent"];
@@ -24,6 +24,7 @@ namespace AEngine
 		static YAML::Node SerialiseColliders(CollisionBody* body);
 
 		static std::string DeserialiseTag(YAML::Node& root);
+		static Uint64 DeserialiseIdent(YAML::Node& root);
 		static void DeserialiseAsset(YAML::Node& root);
 		static void DeserialiseTransform(YAML::Node& root, Entity& entity);
 		static void DeserialiseRenderable(YAML::Node& root, Entity& entity);
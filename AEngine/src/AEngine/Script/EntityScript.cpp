@@ -4,13 +4,19 @@
 #include "AEngine/Scene/Scene.h"
 #include "AEngine/Scene/Entity.h"
 
+namespace
+{
+	AEngine::Uint64 g_aeNextSerial = 0;
+}
+
 namespace AEngine
 {
 	EntityScript::EntityScript(Entity& entity, ScriptState& state, const Script* script)
-		: m_env(state), m_script(script)
+		: m_env(state), m_script(script), m_callbacks(0), m_serial(++g_aeNextSerial)
 	{
-		m_env.LoadScript(m_script->GetData());
+		m_env.LoadScript(*m_script);
 		SetLocal("entity", entity);
+		ResolveCallbacks();
 	}
 
 	EntityScript::~EntityScript()
@@ -20,27 +26,85 @@ namespace AEngine
 
 	void EntityScript::OnStart()
 	{
-		m_env.CallFunction("OnStart");
+		if (HasCallback(Start))
+		{
+			Call(m_onStart);
+		}
+
+		// OnStart may define the other callbacks
+		ResolveCallbacks();
 	}
 
 	void EntityScript::OnUpdate(float deltaTime)
 	{
-		m_env.CallFunction("OnUpdate", deltaTime);
+		if (HasCallback(Update))
+		{
+			Call(m_onUpdate, deltaTime);
+		}
 	}
 
 	void EntityScript::OnFixedUpdate(float deltaTime)
 	{
-		m_env.CallFunction("OnFixedUpdate", deltaTime);
+		if (HasCallback(FixedUpdate))
+		{
+			Call(m_onFixedUpdate, deltaTime);
+		}
 	}
 
 	void EntityScript::OnLateUpdate(float deltaTime)
 	{
-		m_env.CallFunction("OnLateUpdate", deltaTime);
+		if (HasCallback(LateUpdate))
+		{
+			Call(m_onLateUpdate, deltaTime);
+		}
 	}
 
 	void EntityScript::OnDestroy()
 	{
-		m_env.CallFunction("OnDestroy");
+		if (HasCallback(Destroy))
+		{
+			Call(m_onDestroy);
+		}
+	}
+
+	Uint8 EntityScript::GetCallbacks() const
+	{
+		return m_callbacks;
+	}
+
+	void EntityScript::ResolveCallbacks()
+	{
+		m_onStart = m_env.GetFunction("OnStart");
+		m_onUpdate = m_env.GetFunction("OnUpdate");
+		m_onFixedUpdate = m_env.GetFunction("OnFixedUpdate");
+		m_onLateUpdate = m_env.GetFunction("OnLateUpdate");
+		m_onDestroy = m_env.GetFunction("OnDestroy");
+
+		m_callbacks = static_cast<Uint8>(
+			(m_onStart.valid() ? Start : 0)
+			| (m_onUpdate.valid() ? Update : 0)
+			| (m_onFixedUpdate.valid() ? FixedUpdate : 0)
+			| (m_onLateUpdate.valid() ? LateUpdate : 0)
+			| (m_onDestroy.valid() ? Destroy : 0)
+			| (m_env.GetFunction("OnUpdateSystem").valid() ? UpdateSystem : 0)
+			| (m_env.GetFunction("OnFixedUpdateSystem").valid() ? FixedUpdateSystem : 0)
+			| (m_env.GetFunction("OnLateUpdateSystem").valid() ? LateUpdateSystem : 0)
+		);
+	}
+
+	const Script* EntityScript::GetScript() const
+	{
+		return m_script;
+	}
+
+	const ScriptEnvironment& EntityScript::GetEnvironment() const
+	{
+		return m_env;
+	}
+
+	Uint64 EntityScript::GetSerial() const
+	{
+		return m_serial;
 	}
 
 	const std::string& EntityScript::GetIdent() const
@@ -2,6 +2,7 @@
 #include "AEngine/Core/Types.h"
 #include "Script.h"
 #include "ScriptEnvironment.h"
+#include <chrono>
 
 namespace AEngine
 {
@@ -14,6 +15,22 @@ namespace AEngine
 	class EntityScript
 	{
 	public:
+			/**
+			 * @brief Callbacks a script may define, as bits of GetCallbacks()
+			 * @note The system callbacks are run by the ScriptScheduler instead of each instance
+			 **/
+		enum Callback : Uint8
+		{
+			Start = 1 << 0,
+			Update = 1 << 1,
+			FixedUpdate = 1 << 2,
+			LateUpdate = 1 << 3,
+			Destroy = 1 << 4,
+			UpdateSystem = 1 << 5,
+			FixedUpdateSystem = 1 << 6,
+			LateUpdateSystem = 1 << 7
+		};
+
 		/**
 		 * @brief Script Constructor for the Script
 		 * @param std::string, std::string
@@ -40,11 +57,54 @@ namespace AEngine
 		const std::string& GetIdent() const;
 		const std::string& GetPath() const;
 
+			/**
+			 * @brief Returns the callbacks the script defines
+			 * @return Bitmask of Callback
+			 **/
+		Uint8 GetCallbacks() const;
+			/**
+			 * @brief Checks if the script defines a callback
+			 * @param[in] callback to check
+			 **/
+		bool HasCallback(Callback callback) const;
+			/**
+			 * @brief Returns the script the instance runs
+			 **/
+		const Script* GetScript() const;
+			/**
+			 * @brief Returns the environment holding the instance's globals
+			 **/
+		const ScriptEnvironment& GetEnvironment() const;
+			/**
+			 * @brief Returns a number unique to the instance, never reused
+			 **/
+		Uint64 GetSerial() const;
+
 
 	private:
 		ScriptEnvironment m_env;
 		const Script* m_script;
 
+		// callbacks looked up once, rather than by name on every call
+		sol::protected_function m_onStart;
+		sol::protected_function m_onUpdate;
+		sol::protected_function m_onFixedUpdate;
+		sol::protected_function m_onLateUpdate;
+		sol::protected_function m_onDestroy;
+		Uint8 m_callbacks;
+		Uint64 m_serial;
+
+		/**
+		 * @brief Looks up the callbacks the script defines
+		 **/
+		void ResolveCallbacks();
+
+		/**
+		 * @brief Runs a callback and records the time taken against the script
+		 **/
+		template <typename... Args>
+		void Call(const sol::protected_function& function, Args&&... args);
+
 		/**
 		 * @brief OnDestroy Method called from within lua scripts
 		 **/
@@ -56,4 +116,18 @@ namespace AEngine
 	{
 		m_env.SetLocal(name, value);
 	}
+
+	inline bool EntityScript::HasCallback(Callback callback) const
+	{
+		return (m_callbacks & callback) != 0;
+	}
+
+	template <typename... Args>
+	void EntityScript::Call(const sol::protected_function& function, Args&&... args)
+	{
+		using Clock = std::chrono::steady_clock;
+		const Clock::time_point start = Clock::now();
+		function(std::forward<Args>(args)...);
+		m_script->RecordCall(std::chrono::duration<double>(Clock::now() - start).count());
+	}
 }
@@ -1,12 +1,52 @@
 #include "Script.h"
+#include "AEngine/Core/Logger.h"
+#include "ScriptEngine.h"
+#include "ScriptState.h"
+#include <cstring>
+#include <filesystem>
 #include <fstream>
 #include <sstream>
 #include <stdexcept>
+#include <system_error>
+
+namespace
+{
+	using namespace AEngine;
+
+	constexpr char CacheMagic[4] = { 'A', 'E', 'S', 'C' };
+		// bump whenever the layout below changes, older files are then compiled again
+	constexpr Uint32 CacheVersion = 1;
+
+	struct CacheHeader
+	{
+		char magic[4];
+		Uint32 version;
+		Uint32 luaVersion;       // bytecode only loads in the Lua release that wrote it
+		Uint32 bytecodeSize;
+		Uint64 sourceHash;
+	};
+
+	Uint64 HashSource(const std::string& source)
+	{
+		// FNV-1a
+		Uint64 hash = 14695981039346656037ull;
+		for (const char c : source)
+		{
+			hash ^= static_cast<unsigned char>(c);
+			hash *= 1099511628211ull;
+		}
+
+		return hash;
+	}
+}
 
 namespace AEngine
 {
+	bool Script::s_cacheEnabled = true;
+	Uint64 Script::s_frame = 0;
+
 	Script::Script(const std::string& ident, const std::string& fname)
-		: Asset(ident, fname), m_data()
+		: Asset(ident, fname), m_data(), m_bytecode(), m_compiled(false), m_timing(), m_lastTiming(), m_timingFrame(0)
 	{
 		std::ifstream file(fname);
 		if (file.is_open())
@@ -26,8 +66,147 @@ namespace AEngine
 		return m_data;
 	}
 
+	const std::string& Script::GetBytecode() const
+	{
+		if (m_compiled)
+		{
+			return m_bytecode;
+		}
+
+		m_compiled = true;
+		const Uint64 sourceHash = HashSource(m_data);
+		if (s_cacheEnabled && ReadCache(sourceHash))
+		{
+			return m_bytecode;
+		}
+
+		// any state can compile, the bytecode does not depend on it
+		sol::state& lua = ScriptEngine::GetState().GetNative();
+		sol::load_result chunk = lua.load(m_data, "@" + GetPath(), sol::load_mode::text);
+		if (!chunk.valid())
+		{
+			sol::error error = chunk;
+			AE_LOG_LUA_ERROR("Script::Compile::Failed -> {}", error.what());
+			return m_bytecode;
+		}
+
+		sol::protected_function function = chunk;
+		sol::bytecode bytecode = function.dump();
+		m_bytecode.assign(bytecode.as_string_view());
+
+		if (s_cacheEnabled)
+		{
+			WriteCache(sourceHash);
+		}
+
+		return m_bytecode;
+	}
+
 	SharedPtr<Script> Script::Create(const std::string& ident, const std::string& fname)
 	{
 		return SharedPtr<Script>(new Script(ident, fname));
 	}
+
+	void Script::SetCacheEnabled(bool enable)
+	{
+		s_cacheEnabled = enable;
+	}
+
+	std::string Script::GetCachePath(const std::string& path)
+	{
+		return path + ".aecache";
+	}
+
+	void Script::RecordCall(double seconds) const
+	{
+		// the first call of a frame rolls the previous frame over, frames without calls count as empty
+		if (m_timingFrame != s_frame)
+		{
+			m_lastTiming = (m_timingFrame + 1 == s_frame) ? m_timing : Timing{};
+			m_timing = Timing{};
+			m_timingFrame = s_frame;
+		}
+
+		++m_timing.calls;
+		m_timing.seconds += seconds;
+	}
+
+	Script::Timing Script::GetFrameTiming() const
+	{
+		if (m_timingFrame + 1 == s_frame)
+		{
+			return m_timing;
+		}
+
+		if (m_timingFrame == s_frame)
+		{
+			return m_lastTiming;
+		}
+
+		return Timing{};
+	}
+
+	void Script::BeginFrame()
+	{
+		++s_frame;
+	}
+
+	bool Script::ReadCache(Uint64 sourceHash) const
+	{
+		CacheHeader header;
+		std::ifstream cache(GetCachePath(GetPath()), std::ios::binary);
+		if (!cache.read(reinterpret_cast<char*>(&header), sizeof(header)))
+		{
+			return false;
+		}
+
+		// the hash of the source catches every edit, however the file was touched
+		if (std::memcmp(header.magic, CacheMagic, sizeof(CacheMagic)) != 0
+			|| header.version != CacheVersion
+			|| header.luaVersion != LUA_VERSION_NUM
+			|| header.sourceHash != sourceHash)
+		{
+			return false;
+		}
+
+		m_bytecode.resize(header.bytecodeSize);
+		if (!cache.read(m_bytecode.data(), static_cast<std::streamsize>(header.bytecodeSize)))
+		{
+			m_bytecode.clear();
+			return false;
+		}
+
+		return true;
+	}
+
+	void Script::WriteCache(Uint64 sourceHash) const
+	{
+		CacheHeader header;
+		std::memcpy(header.magic, CacheMagic, sizeof(CacheMagic));
+		header.version = CacheVersion;
+		header.luaVersion = LUA_VERSION_NUM;
+		header.bytecodeSize = static_cast<Uint32>(m_bytecode.size());
+		header.sourceHash = sourceHash;
+
+		// written beside the cache and renamed over it, so a reader never sees half a file
+		const std::string cachePath = GetCachePath(GetPath());
+		const std::string tempPath = cachePath + ".tmp";
+		{
+			std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+			if (!file.write(reinterpret_cast<const char*>(&header), sizeof(header))
+				|| !file.write(m_bytecode.data(), static_cast<std::streamsize>(m_bytecode.size())))
+			{
+				AE_LOG_WARN("Script::WriteCache::Warning -> Could not write {}", cachePath);
+				return;
+			}
+		}
+
+		std::error_code error;
+		std::filesystem::rename(tempPath, cachePath, error);
+		if (error)
+		{
+			AE_LOG_WARN("Script::WriteCache::Warning -> Could not write {}", cachePath);
+			std::filesystem::remove(tempPath, error);
+		}
+	}
 }
\ No newline at end of file
@@ -6,12 +6,69 @@ namespace AEngine
 {
 	class Script : public Asset
 	{
+	public:
+			/**
+			 * \struct Timing
+			 * \brief Time spent in the callbacks of every instance of a script
+			*/
+		struct Timing
+		{
+			Uint32 calls{ 0 };       ///< Number of callbacks run
+			double seconds{ 0.0 };   ///< Time spent running them
+		};
+
 	public:
 		Script(const std::string& ident, const std::string& fname);
 		const std::string& GetData() const;
+			/**
+			 * \brief Gets the compiled chunk of the script
+			 * \return Lua bytecode, empty if the script does not compile
+			 * \details
+			 * The source is compiled the first time it is needed and shared by every instance of the
+			 * script, which only has to load the bytecode. When the cache is enabled the bytecode is
+			 * also written beside the source, so later runs skip parsing entirely.
+			*/
+		const std::string& GetBytecode() const;
 		static SharedPtr<Script> Create(const std::string& ident, const std::string& fname);
 
+			/**
+			 * \brief Enables the on disk bytecode cache
+			 * \param[in] enable whether compiled scripts are read from and written to the cache
+			*/
+		static void SetCacheEnabled(bool enable);
+			/**
+			 * \brief Gets the path of the cached bytecode of a script
+			 * \param[in] path of the script source
+			*/
+		static std::string GetCachePath(const std::string& path);
+
+			/**
+			 * \brief Adds a callback of an instance to the timing of the current frame
+			 * \param[in] seconds spent in the callback
+			*/
+		void RecordCall(double seconds) const;
+			/**
+			 * \brief Gets the timing of the last finished frame
+			*/
+		Timing GetFrameTiming() const;
+			/**
+			 * \brief Starts a new frame of script timings
+			 * \note Called by the scene before its scripts update
+			*/
+		static void BeginFrame();
+
 	private:
 		std::string m_data;
+		mutable std::string m_bytecode;
+		mutable bool m_compiled;
+		mutable Timing m_timing;          // frame m_timingFrame, which may still be running
+		mutable Timing m_lastTiming;      // the frame before m_timingFrame
+		mutable Uint64 m_timingFrame;
+
+		bool ReadCache(Uint64 sourceHash) const;
+		void WriteCache(Uint64 sourceHash) const;
+
+		static bool s_cacheEnabled;
+		static Uint64 s_frame;
 	};
 }
\ No newline at end of file
@@ -778,7 +778,7 @@ namespace AEngine
 				return scene.GetEntity(name);
 			},
 
-			[](Scene& scene, Uint16 id) -> Entity {
+			[](Scene& scene, Uint64 id) -> Entity {
 				return scene.GetEntity(id);
 			}
 		);
@@ -792,6 +792,7 @@ namespace AEngine
 			"CreateEntity", &Scene::CreateEntity,
 			"GetEntity", getEntity_overload,
 			"GetEntityName", &Scene::GetEntityName,
+			"RenameEntity", &Scene::RenameEntity,
 
 			// events -> Maybe don't expose these??
 			"OnUpdate", &Scene::OnUpdate,
@@ -898,6 +899,7 @@ namespace AEngine
 			"GetRectTransformComponent", &Entity::GetComponent<RectTransformComponent>,
 			"GetPanelComponent", &Entity::GetComponent<PanelComponent>,
 			"GetTagComponent", &Entity::GetComponent<TagComponent>,
+			"GetWorldTransformComponent", &Entity::GetComponent<WorldTransformComponent>,
 			"AddTransformComponent", &Entity::AddComponent<TransformComponent>,
 			"AddRenderableComponent", &Entity::AddComponent<RenderableComponent>,
 			"GetPlayerControllerComponent", &Entity::GetComponent<PlayerControllerComponent>,
@@ -909,6 +911,9 @@ namespace AEngine
 			"TranslateLocal", translateLocal,
 			"RotateLocal", rotateLocal,
 			"Destroy", &Entity::Destroy,
+			"SetParent", &Entity::SetParent,
+			"GetParent", &Entity::GetParent,
+			"IsValid", &Entity::IsValid,
 			"GetScene", &Entity::GetScene
 		);
 	}
@@ -969,6 +974,10 @@ namespace AEngine
 			anim->animator.Load(*AssetManager<Animation>::Instance().Get(name));
 		};
 
+		auto cross_fade = [](SkinnedRenderableComponent* anim, const std::string& name, float duration) {
+			anim->animator.CrossFade(*AssetManager<Animation>::Instance().Get(name), duration);
+		};
+
 		auto get_duration = [](SkinnedRenderableComponent* anim) -> float {
 			return anim->animator.GetDuration();
 		};
@@ -997,6 +1006,7 @@ namespace AEngine
 			"AnimationComponent",
 			sol::no_constructor,
 			"SetAnimation", set_animation,
+			"CrossFade", cross_fade,
 			"GetDuration", get_duration,
 			"GetMaterialString", get_material_string,
 			"GetMeshMaterialCount", get_mesh_material_count,
@@ -1012,10 +1022,11 @@ namespace AEngine
 			"TagComponent",
 			sol::constructors<
 				TagComponent(),
-				TagComponent(const std::string&, Uint16)
+				TagComponent(const std::string&, Uint64)
 			>(),
-			"tag", &TagComponent::tag,
-			"ident", &TagComponent::ident
+			// read only, tags are changed through Scene:RenameEntity to keep lookups valid
+			"tag", sol::readonly(&TagComponent::tag),
+			"ident", sol::readonly(&TagComponent::ident)
 		);
 	}
 
@@ -1112,6 +1123,16 @@ namespace AEngine
 		);
 	}
 
+	void RegisterWorldTransformComponent(sol::state& state)
+	{
+		state.new_usertype<WorldTransformComponent>(
+			"WorldTransformComponent",
+			sol::no_constructor,
+			"GetTranslation", &WorldTransformComponent::GetTranslation,
+			"GetOrientation", &WorldTransformComponent::GetOrientation
+		);
+	}
+
 	void RegisterRectTransformComponent(sol::state& state)
 	{
 		state.new_usertype<RectTransformComponent>(
@@ -1233,6 +1254,7 @@ namespace AEngine
 		RegisterEntity(state);
 		RegisterTagComponent(state);
 		RegisterTransformComponent(state);
+		RegisterWorldTransformComponent(state);
 		RegisterCanvasComponent(state);
 		RegisterNavigationGridComponent(state);
 		RegisterPanelComponent(state);
@@ -1327,7 +1349,8 @@ namespace AEngine
 			"sender", &Message::sender,
 			"receiver", &Message::receiver,
 			"type", &Message::type,
-			"payload", &Message::payload
+			// native payloads are only visible to C++, scripts see nil
+			"payload", sol::readonly_property([](const Message& message) { return message.payload.GetTable(); })
 		);
 	}
 
@@ -1353,14 +1376,25 @@ namespace AEngine
 			"UnregisterMessageHandler", &MessageAgent::UnregisterMessageHandler,
 
 			// message sending
-			"BroadcastMessage", &MessageAgent::BroadcastMessage,
+			// scripts send Lua tables, which are shared by every receiver
+			"BroadcastMessage", [](MessageAgent& agent, MessageType type, sol::table payload) {
+				agent.BroadcastMessage(type, MessageData(std::move(payload)));
+			},
 			"SendMessageToAgent", sol::overload(
-				static_cast<void (MessageAgent::*)(Agent, MessageType, MessageData)>(&MessageAgent::SendMessageToAgent),
-				static_cast<void (MessageAgent::*)(AgentSet, MessageType, MessageData)>(&MessageAgent::SendMessageToAgent)
+				[](MessageAgent& agent, Agent to, MessageType type, sol::table payload) {
+					agent.SendMessageToAgent(to, type, MessageData(std::move(payload)));
+				},
+				[](MessageAgent& agent, AgentSet to, MessageType type, sol::table payload) {
+					agent.SendMessageToAgent(std::move(to), type, MessageData(std::move(payload)));
+				}
 			),
 			"SendMessageToCategory", sol::overload(
-				static_cast<void (MessageAgent::*)(AgentCategory, MessageType, MessageData)>(&MessageAgent::SendMessageToCategory),
-				static_cast<void (MessageAgent::*)(AgentCategorySet, MessageType, MessageData)>(&MessageAgent::SendMessageToCategory)
+				[](MessageAgent& agent, AgentCategory to, MessageType type, sol::table payload) {
+					agent.SendMessageToCategory(to, type, MessageData(std::move(payload)));
+				},
+				[](MessageAgent& agent, AgentCategorySet to, MessageType type, sol::table payload) {
+					agent.SendMessageToCategory(std::move(to), type, MessageData(std::move(payload)));
+				}
 			),
 
 			// introspection
@@ -1,4 +1,6 @@
 #include "ScriptEnvironment.h"
+#include "AEngine/Core/Logger.h"
+#include "Script.h"
 #include "ScriptState.h"
 
 namespace AEngine
@@ -19,6 +21,44 @@ namespace AEngine
 		m_state.script(script, m_environment);
 	}
 
+	void ScriptEnvironment::LoadScript(const Script& script)
+	{
+		const std::string& bytecode = script.GetBytecode();
+		if (bytecode.empty())
+		{
+			return;
+		}
+
+		// each environment loads its own closure, the functions a chunk defines share its environment
+		sol::load_result chunk = m_state.load(bytecode, "@" + script.GetPath(), sol::load_mode::binary);
+		if (!chunk.valid())
+		{
+			sol::error error = chunk;
+			AE_LOG_LUA_ERROR("ScriptEnvironment::LoadScript::Failed -> {}", error.what());
+			return;
+		}
+
+		sol::protected_function function = chunk;
+		sol::set_environment(m_environment, function);
+		function();
+	}
+
+	sol::protected_function ScriptEnvironment::GetFunction(const std::string& functionName) const
+	{
+		sol::object object = m_environment.get<sol::object>(functionName);
+		if (object.get_type() != sol::type::function)
+		{
+			return sol::protected_function();
+		}
+
+		return object.as<sol::protected_function>();
+	}
+
+	const sol::environment& ScriptEnvironment::GetNative() const
+	{
+		return m_environment;
+	}
+
 	void ScriptEnvironment::CallFunction(const std::string& functionName)
 	{
 		sol::protected_function function = m_environment[functionName];
@@ -3,6 +3,7 @@
 
 namespace AEngine
 {
+	class Script;
 	class ScriptState;
 
 	class ScriptEnvironment
@@ -22,15 +23,34 @@ namespace AEngine
 			*/
 		void LoadScript(const std::string& script);
 
+			/**
+			 * \brief Method to run a script asset in the environment
+			 * \param[in] script The script to run, compiled once and shared by every environment
+			*/
+		void LoadScript(const Script& script);
+
 			/**
 			 * @brief Method to call functions within script
 			 * @param[in] functionName The name of the function to call
 			 **/
 		void CallFunction(const std::string& functionName);
 
+			/**
+			 * \brief Method to look up a function within script
+			 * \param[in] functionName The name of the function
+			 * \return The function, invalid if the script does not define it
+			 */
+		sol::protected_function GetFunction(const std::string& functionName) const;
+
 		template <typename T>
 		void SetLocal(const std::string& name, T value);
 
+			/**
+			 * \brief Method to get the native environment
+			 * \return const sol::environment&
+			 */
+		const sol::environment& GetNative() const;
+
 			/**
 			 * @brief Templated method to call functions within script
 			 * @param std::string, <T> Args
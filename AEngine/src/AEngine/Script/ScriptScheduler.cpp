@@ -0,0 +1,188 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#include "ScriptScheduler.h"
+#include "Script.h"
+#include "ScriptState.h"
+#include <algorithm>
+#include <chrono>
+
+namespace
+{
+	constexpr AEngine::Uint8 g_aeSystemCallbacks =
+		AEngine::EntityScript::UpdateSystem | AEngine::EntityScript::FixedUpdateSystem | AEngine::EntityScript::LateUpdateSystem;
+}
+
+namespace AEngine
+{
+	ScriptScheduler::ScriptScheduler(ScriptState& state)
+		: m_state(state)
+	{
+
+	}
+
+	ScriptScheduler::~ScriptScheduler() = default;
+
+	void ScriptScheduler::Clear()
+	{
+		m_stats = Stats{};
+		m_entityScripts.clear();
+
+		// a system nobody submitted to may belong to a script that no longer exists
+		for (const UniquePtr<System>& system : m_systems)
+		{
+			if (system->members.empty())
+			{
+				m_systemLookup.erase(system->script);
+			}
+		}
+
+		m_systems.erase(std::remove_if(m_systems.begin(), m_systems.end(), [](const UniquePtr<System>& system) {
+			return system->members.empty();
+		}), m_systems.end());
+
+		for (const UniquePtr<System>& system : m_systems)
+		{
+			system->members.clear();
+		}
+	}
+
+	void ScriptScheduler::Submit(EntityScript& script)
+	{
+		if ((script.GetCallbacks() & g_aeSystemCallbacks) == 0)
+		{
+			m_entityScripts.push_back(&script);
+			return;
+		}
+
+		GetSystem(script.GetScript()).members.push_back(&script);
+	}
+
+	void ScriptScheduler::Run(EntityScript::Callback phase, float dt)
+	{
+		for (EntityScript* script : m_entityScripts)
+		{
+			RunEntity(*script, phase, dt);
+		}
+
+		for (const UniquePtr<System>& system : m_systems)
+		{
+			if (system->members.empty())
+			{
+				continue;
+			}
+
+			const sol::protected_function& callback = GetCallback(*system, phase);
+
+			// a system script without this phase's system callback still runs it per entity
+			if (!callback.valid())
+			{
+				for (EntityScript* script : system->members)
+				{
+					RunEntity(*script, phase, dt);
+				}
+
+				continue;
+			}
+
+			BuildInstances(*system);
+
+			using Clock = std::chrono::steady_clock;
+			const Clock::time_point start = Clock::now();
+			callback(system->instances, dt);
+			system->script->RecordCall(std::chrono::duration<double>(Clock::now() - start).count());
+
+			++m_stats.systemCalls;
+			m_stats.batched += static_cast<Uint32>(system->members.size());
+		}
+	}
+
+	const ScriptScheduler::Stats& ScriptScheduler::GetStats() const
+	{
+		return m_stats;
+	}
+
+	ScriptScheduler::System& ScriptScheduler::GetSystem(const Script* script)
+	{
+		auto it = m_systemLookup.find(script);
+		if (it != m_systemLookup.end())
+		{
+			return *it->second;
+		}
+
+		// the system callbacks get an environment of their own, so their globals are not any one instance's
+		UniquePtr<System> system = MakeUnique<System>();
+		system->script = script;
+		system->env = MakeUnique<ScriptEnvironment>(m_state);
+		system->env->LoadScript(*script);
+		system->onUpdate = system->env->GetFunction("OnUpdateSystem");
+		system->onFixedUpdate = system->env->GetFunction("OnFixedUpdateSystem");
+		system->onLateUpdate = system->env->GetFunction("OnLateUpdateSystem");
+
+		System& result = *system;
+		m_systemLookup.emplace(script, system.get());
+		m_systems.push_back(std::move(system));
+		return result;
+	}
+
+	const sol::protected_function& ScriptScheduler::GetCallback(const System& system, EntityScript::Callback phase)
+	{
+		switch (phase)
+		{
+		case EntityScript::Update:
+			return system.onUpdate;
+		case EntityScript::FixedUpdate:
+			return system.onFixedUpdate;
+		default:
+			return system.onLateUpdate;
+		}
+	}
+
+	void ScriptScheduler::RunEntity(EntityScript& script, EntityScript::Callback phase, float dt)
+	{
+		if (!script.HasCallback(phase))
+		{
+			return;
+		}
+
+		switch (phase)
+		{
+		case EntityScript::Update:
+			script.OnUpdate(dt);
+			break;
+		case EntityScript::FixedUpdate:
+			script.OnFixedUpdate(dt);
+			break;
+		default:
+			script.OnLateUpdate(dt);
+			break;
+		}
+
+		++m_stats.entityCalls;
+	}
+
+	void ScriptScheduler::BuildInstances(System& system)
+	{
+		// entities rarely join or leave a system, so the array usually carries over between frames
+		const Size_t count = system.members.size();
+		bool changed = system.builtSerials.size() != count;
+		for (Size_t i = 0; !changed && i < count; ++i)
+		{
+			changed = system.builtSerials[i] != system.members[i]->GetSerial();
+		}
+
+		if (!changed)
+		{
+			return;
+		}
+
+		system.instances = m_state.GetNative().create_table(static_cast<int>(count), 0);
+		system.builtSerials.resize(count);
+		for (Size_t i = 0; i < count; ++i)
+		{
+			system.instances[i + 1] = system.members[i]->GetEnvironment().GetNative();
+			system.builtSerials[i] = system.members[i]->GetSerial();
+		}
+	}
+}
@@ -0,0 +1,115 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+ * \brief Dispatches script callbacks per entity, or once per system script
+*/
+#pragma once
+#include "AEngine/Core/Types.h"
+#include "EntityScript.h"
+#include "ScriptEnvironment.h"
+#include <sol/sol.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace AEngine
+{
+	class Script;
+	class ScriptState;
+
+		/**
+		 * \class ScriptScheduler
+		 * \brief Runs a phase of script callbacks for the entity scripts of a frame
+		 * \details
+		 * Scripts run per entity by default, each instance's callback is called once per phase.
+		 * A script opts in to system mode by defining OnUpdateSystem, OnFixedUpdateSystem or
+		 * OnLateUpdateSystem, which replace the per entity callback of their phase. A system
+		 * callback is called once per phase as `OnUpdateSystem(instances, dt)`, where instances
+		 * is an array of the environment of every instance, holding its `entity` and globals,
+		 * so the loop over entities runs inside Lua.
+		 *
+		 * System callbacks run in an environment of their own, in which the script's top level
+		 * code runs once. Per entity state belongs in the instances.
+		*/
+	class ScriptScheduler
+	{
+	public:
+			/**
+			 * \struct Stats
+			 * \brief Calls from C++ into Lua made since the last Clear()
+			*/
+		struct Stats
+		{
+			Uint32 entityCalls{ 0 };   ///< Callbacks called on a single instance
+			Uint32 systemCalls{ 0 };   ///< System callbacks called
+			Uint32 batched{ 0 };       ///< Instances updated by system callbacks
+		};
+
+	public:
+			/**
+			 * \param[in] state the scripts run in
+			*/
+		explicit ScriptScheduler(ScriptState& state);
+		~ScriptScheduler();
+		ScriptScheduler(const ScriptScheduler&) = delete;
+		void operator=(const ScriptScheduler&) = delete;
+
+			/**
+			 * \brief Removes all submissions and resets the stats
+			 * \note Systems without submissions since the last Clear() are released
+			*/
+		void Clear();
+			/**
+			 * \brief Queues an entity script for the following phases
+			 * \param[in] script to run, must outlive the submission
+			*/
+		void Submit(EntityScript& script);
+			/**
+			 * \brief Runs one phase of every submitted script
+			 * \param[in] phase EntityScript::Update, EntityScript::FixedUpdate or EntityScript::LateUpdate
+			 * \param[in] dt delta time
+			 * \note Per entity scripts run in submission order, then each system in the order it was first submitted
+			*/
+		void Run(EntityScript::Callback phase, float dt);
+			/**
+			 * \brief Returns the stats of the runs since the last Clear()
+			 * \return Stats of the runs since the last Clear()
+			*/
+		const Stats& GetStats() const;
+
+	private:
+		struct System
+		{
+			const Script* script;
+			UniquePtr<ScriptEnvironment> env;
+			sol::protected_function onUpdate;
+			sol::protected_function onFixedUpdate;
+			sol::protected_function onLateUpdate;
+			std::vector<EntityScript*> members;   // submitted since the last Clear()
+			std::vector<Uint64> builtSerials;     // members the instance array holds
+			sol::table instances;
+		};
+
+			/**
+			 * \brief Gets the system of a script, creating it on first use
+			*/
+		System& GetSystem(const Script* script);
+			/**
+			 * \brief Gets the system callback of a phase, invalid if the script does not define it
+			*/
+		static const sol::protected_function& GetCallback(const System& system, EntityScript::Callback phase);
+			/**
+			 * \brief Runs a phase of a single instance, if it defines the callback
+			*/
+		void RunEntity(EntityScript& script, EntityScript::Callback phase, float dt);
+			/**
+			 * \brief Rebuilds the instance array if its members changed
+			*/
+		void BuildInstances(System& system);
+
+		ScriptState& m_state;
+		Stats m_stats;
+		std::vector<EntityScript*> m_entityScripts;
+		std::vector<UniquePtr<System>> m_systems;
+		std::unordered_map<const Script*, System*> m_systemLookup;
+	};
+}
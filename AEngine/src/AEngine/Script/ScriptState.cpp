@@ -1,5 +1,12 @@
 #include "ScriptState.h"
 #include "AEngine/Core/Logger.h"
+#include <chrono>
+
+namespace
+{
+		// Lua's default pause, LUAI_GCPAUSE
+	constexpr AEngine::Size_t g_aeDefaultGCPause = 200;
+}
 
 namespace AEngine
 {
@@ -12,6 +19,7 @@ namespace AEngine
 		sol::protected_function::set_default_handler(sol::make_reference(m_state, [](sol::error error){
 			AE_LOG_LUA_ERROR("{}", error.what());
 		}));
+		SetGCSettings(m_gcSettings);
 	}
 
 	void ScriptState::LoadFile(const std::string& path)
@@ -37,4 +45,99 @@ namespace AEngine
 	{
 		return m_state;
 	}
+
+	void ScriptState::SetGCSettings(const GCSettings& settings)
+	{
+		m_gcSettings = settings;
+		lua_State* L = m_state.lua_state();
+		if (settings.mode == GCMode::Generational)
+		{
+			lua_gc(L, LUA_GCGEN, settings.minorMultiplier, settings.majorMultiplier);
+			lua_gc(L, LUA_GCRESTART);
+			return;
+		}
+
+		lua_gc(L, LUA_GCINC, settings.pause, settings.stepMultiplier, settings.stepSize);
+		if (settings.stepBudget > 0.0f)
+		{
+			// StepGC() runs the collector from now on
+			lua_gc(L, LUA_GCSTOP);
+			m_gcCollecting = false;
+			m_gcThreshold = GetHeapBytes() * GetGCPause() / 100;
+		}
+		else
+		{
+			lua_gc(L, LUA_GCRESTART);
+		}
+	}
+
+	const ScriptState::GCSettings& ScriptState::GetGCSettings() const
+	{
+		return m_gcSettings;
+	}
+
+	void ScriptState::StepGC()
+	{
+		using Clock = std::chrono::steady_clock;
+		lua_State* L = m_state.lua_state();
+		const Clock::time_point start = Clock::now();
+		m_gcStats.steps = 0;
+
+		if (m_gcSettings.stepBudget <= 0.0f)
+		{
+			// Lua collects as it allocates
+		}
+		else if (m_gcSettings.mode == GCMode::Generational)
+		{
+			lua_gc(L, LUA_GCSTEP, 0);
+			m_gcStats.steps = 1;
+		}
+		else
+		{
+			if (!m_gcCollecting && GetHeapBytes() >= m_gcThreshold)
+			{
+				m_gcCollecting = true;
+			}
+
+			const std::chrono::duration<double> budget(m_gcSettings.stepBudget);
+			bool finished = false;
+			while (m_gcCollecting && !finished)
+			{
+				if (Clock::now() - start >= budget && GetHeapBytes() < m_gcThreshold * 2)
+				{
+					break;
+				}
+
+				// a step returns 1 when it completes the cycle
+				finished = lua_gc(L, LUA_GCSTEP, 0) == 1;
+				++m_gcStats.steps;
+			}
+
+			if (finished)
+			{
+				m_gcCollecting = false;
+				m_gcThreshold = GetHeapBytes() * GetGCPause() / 100;
+				++m_gcStats.cycles;
+			}
+		}
+
+		m_gcStats.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+		m_gcStats.heapBytes = GetHeapBytes();
+	}
+
+	const ScriptState::GCStats& ScriptState::GetGCStats() const
+	{
+		return m_gcStats;
+	}
+
+	Size_t ScriptState::GetHeapBytes() const
+	{
+		lua_State* L = m_state.lua_state();
+		return static_cast<Size_t>(lua_gc(L, LUA_GCCOUNT)) * 1024 + static_cast<Size_t>(lua_gc(L, LUA_GCCOUNTB));
+	}
+
+	Size_t ScriptState::GetGCPause() const
+	{
+		return m_gcSettings.pause > 0 ? static_cast<Size_t>(m_gcSettings.pause) : g_aeDefaultGCPause;
+	}
 }
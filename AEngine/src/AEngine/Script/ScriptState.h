@@ -1,4 +1,5 @@
 #pragma once
+#include "AEngine/Core/Types.h"
 #include <sol/sol.hpp>
 
 namespace AEngine
@@ -12,6 +13,45 @@ namespace AEngine
 		**/
 	class ScriptState
 	{
+	public:
+			/**
+			 * @enum GCMode
+			 * @brief Garbage collection modes of the Lua collector
+			 **/
+		enum class GCMode
+		{
+			Incremental,   ///< Collects the whole heap in steps, spread over frames by StepGC()
+			Generational   ///< Collects young objects often and the whole heap rarely, as Lua allocates
+		};
+
+			/**
+			 * @struct GCSettings
+			 * @brief Settings of the Lua garbage collector
+			 * @note The parameters are those of Lua's collectgarbage, zero keeps Lua's default
+			 **/
+		struct GCSettings
+		{
+			GCMode mode{ GCMode::Generational };
+			int pause{ 0 };             ///< Incremental, heap growth in percent before a new cycle starts
+			int stepMultiplier{ 0 };    ///< Incremental, work done per step
+			int stepSize{ 0 };          ///< Incremental, log2 of the kilobytes of work per step
+			int minorMultiplier{ 0 };   ///< Generational, heap growth in percent before a minor collection
+			int majorMultiplier{ 0 };   ///< Generational, heap growth in percent before a major collection
+			float stepBudget{ 0.001f }; ///< Seconds per frame spent on incremental steps, zero leaves collection to Lua in either mode
+		};
+
+			/**
+			 * @struct GCStats
+			 * @brief Lua heap and collector work of the last StepGC()
+			 **/
+		struct GCStats
+		{
+			Size_t heapBytes{ 0 };   ///< Bytes in use by Lua after the step
+			double seconds{ 0.0 };   ///< Time spent collecting
+			Uint32 steps{ 0 };       ///< Collector steps taken
+			Uint32 cycles{ 0 };      ///< Incremental cycles completed since the state was created
+		};
+
 	public:
 			/**
 			 * @brief Default Constructor
@@ -45,8 +85,49 @@ namespace AEngine
 			 */
 		sol::state& GetNative();
 
+			/**
+			 * @brief Sets the mode and parameters of the garbage collector
+			 * @param[in] settings to use
+			 **/
+		void SetGCSettings(const GCSettings& settings);
+
+			/**
+			 * @brief Gets the settings of the garbage collector
+			 * @return GCSettings
+			 **/
+		const GCSettings& GetGCSettings() const;
+
+			/**
+			 * @brief Runs the garbage collector's share of the frame, called once per frame
+			 * @details
+			 * Generational mode runs a minor collection, so the frame's temporaries are freed
+			 * between script calls instead of in a collection triggered inside one.
+			 *
+			 * Incremental mode with a step budget stops Lua from collecting as it allocates, and
+			 * steps a cycle here until the budget is spent, so a cycle is spread over frames instead
+			 * of pausing one. A cycle starts once the heap has grown by the pause since the last one.
+			 * If the heap doubles past that while a cycle runs, the cycle is finished regardless of
+			 * the budget, as the garbage is outpacing it.
+			 *
+			 * With a step budget of zero Lua collects as it allocates, and StepGC() only measures the heap.
+			 **/
+		void StepGC();
+
+			/**
+			 * @brief Gets the heap size and collector work of the last StepGC()
+			 * @return GCStats
+			 **/
+		const GCStats& GetGCStats() const;
+
 	private:
+		Size_t GetHeapBytes() const;
+		Size_t GetGCPause() const;
+
 		sol::state m_state;
+		GCSettings m_gcSettings;
+		GCStats m_gcStats;
+		Size_t m_gcThreshold{ 0 };
+		bool m_gcCollecting{ false };
 	};
 
 		//templated function to call functions within lua
@@ -5,6 +5,7 @@
 */
 #include "CubeMapTexture.h"
 #include "AEngine/Core/Logger.h"
+#include "AEngine/Render/RenderCommand.h"
 #include <glad/glad.h>
 #include <stb/stb_image.h>
 
@@ -13,8 +14,13 @@ namespace AEngine
 	CubeMapTexture::CubeMapTexture(const std::vector<std::string>& texturePaths)
 		: m_texture{ 0 }
 	{
-		glGenTextures(1, &m_texture);
-		Bind();
+		// without a graphics context the faces are still decoded, but never uploaded
+		const bool headless = RenderCommand::GetLibrary() == RenderLibrary::Null;
+		if (!headless)
+		{
+			glGenTextures(1, &m_texture);
+			Bind();
+		}
 
 		stbi_set_flip_vertically_on_load(false);
 
@@ -25,7 +31,10 @@ namespace AEngine
 			unsigned char* data = stbi_load(texturePaths[i].c_str(), &width, &height, &nrChannels, 0);
 			if (data)
 			{
-				glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, data);
+				if (!headless)
+				{
+					glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, data);
+				}
 				stbi_image_free(data);
 			}
 			else
@@ -35,6 +44,11 @@ namespace AEngine
 			}
 		}
 
+		if (headless)
+		{
+			return;
+		}
+
 		// set properties for texture
 		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -47,17 +61,30 @@ namespace AEngine
 
 	CubeMapTexture::~CubeMapTexture()
 	{
-		glDeleteTextures(1, &m_texture);
+		if (m_texture)
+		{
+			glDeleteTextures(1, &m_texture);
+		}
 	}
 
 	void CubeMapTexture::Bind(unsigned int unit) const
 	{
+		if (!m_texture)
+		{
+			return;
+		}
+
 		glActiveTexture(GL_TEXTURE0 + unit);
 		glBindTexture(GL_TEXTURE_CUBE_MAP, m_texture);
 	}
 
 	void CubeMapTexture::Unbind() const
 	{
+		if (!m_texture)
+		{
+			return;
+		}
+
 		glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
 	}
 }
@@ -74,7 +74,7 @@ namespace AEngine
 		return m_texturePaths;
 	}
 
-	void Skybox::Render(Shader& shader, const Math::mat4& projection, const Math::mat4& view)
+	void Skybox::Render(Shader& shader)
 	{
 		RenderCommand::SetDepthTestFunction(DepthTestFunction::LessEqual);
 
@@ -82,8 +82,6 @@ namespace AEngine
 		m_mesh.Bind();
 		m_texture->Bind();
 
-		// cast away translation
-		shader.SetUniformMat4("u_projectionView", projection * Math::mat4(Math::mat3(view)));
 		RenderCommand::DrawArrays(Primitive::Triangles, 0, m_mesh.GetNumIndices());
 
 		m_mesh.Unbind();
@@ -26,10 +26,9 @@ namespace AEngine
 			/**
 			 * \brief Renders the skybox
 			 * \param[in] shader The shader to use
-			 * \param[in] projection The projection matrix
-			 * \param[in] view The view matrix
+			 * \note The camera is read from the per-frame CameraBlock
 			*/
-		void Render(Shader& shader, const Math::mat4& projection, const Math::mat4& view);
+		void Render(Shader& shader);
 
 		std::vector<std::string>& GetTexturePaths();
 
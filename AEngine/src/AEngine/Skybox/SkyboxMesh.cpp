@@ -4,6 +4,7 @@
  * \author Geoff Candy
 */
 #include "SkyboxMesh.h"
+#include "AEngine/Render/RenderCommand.h"
 #include <glad/glad.h>
 
 namespace AEngine
@@ -11,6 +12,12 @@ namespace AEngine
 	AEngine::SkyboxMesh::SkyboxMesh(const float* vertices, Size_t numVerts, Size_t numIndices)
 		: m_vao{ 0 }, m_vbo{ 0 }, m_numIndices{ numIndices }
 	{
+		// nothing to upload without a graphics context
+		if (RenderCommand::GetLibrary() == RenderLibrary::Null)
+		{
+			return;
+		}
+
 		glGenVertexArrays(1, &m_vao);
 
 		Bind();
@@ -24,18 +31,31 @@ namespace AEngine
 
 	SkyboxMesh::~SkyboxMesh()
 	{
-		glDeleteBuffers(1, &m_vbo);
-		glDeleteVertexArrays(1, &m_vao);
+		if (m_vao)
+		{
+			glDeleteBuffers(1, &m_vbo);
+			glDeleteVertexArrays(1, &m_vao);
+		}
 		m_vao = m_vbo = m_numIndices = 0;
 	}
 
 	void SkyboxMesh::Bind() const
 	{
+		if (!m_vao)
+		{
+			return;
+		}
+
 		glBindVertexArray(m_vao);
 	}
 
 	void SkyboxMesh::Unbind() const
 	{
+		if (!m_vao)
+		{
+			return;
+		}
+
 		glBindVertexArray(0);
 	}
 
@@ -31,10 +31,9 @@ namespace AEngine
 		m_vertexArray->AddVertexBuffer(vbo);
 	}
 
-	void Water::Render(const Math::mat4& transform, const Shader& shader, const Math::mat4& projectionView, TimeStep dt) const
+	void Water::Render(const Math::mat4& transform, const Shader& shader, TimeStep dt) const
 	{
 		shader.Bind();
-		shader.SetUniformMat4("u_projectionView", projectionView);
 		shader.SetUniformMat4("u_model", transform);
 		shader.SetUniformFloat("u_tilingFactor", 25.0f);
 
@@ -17,7 +17,7 @@ namespace AEngine
 		Water(SharedPtr<Texture> dudv, SharedPtr<Texture> normal);
 
 			// todo
-		void Render(const Math::mat4& transform, const Shader& shader, const Math::mat4& projectionView, TimeStep dt) const;
+		void Render(const Math::mat4& transform, const Shader& shader, TimeStep dt) const;
 
 		void SetDUDV(SharedPtr<Texture> texture);
 		void SetNormal(SharedPtr<Texture> texture);
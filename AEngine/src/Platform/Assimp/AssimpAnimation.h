@@ -5,13 +5,13 @@
 
 #pragma once
 
-#include <assimp/scene.h>
-
 #include "AEngine/Render/Animation.h"
 #include "AssimpBone.h"
 
 namespace AEngine
 {
+	struct CookedModel;
+
 		/**
 		 * \class AssimpAnimation
 		 * \brief Contains implementation to load animation using Assimp
@@ -21,22 +21,12 @@ namespace AEngine
 	public:
 		virtual ~AssimpAnimation() = default;
 			/**
-			 * \brief Constructor to create a Animation from an Assimp object
+			 * \brief Constructor to create a Animation from a cooked Assimp model
 			 * \param[in] ident Asset ident
 			 * \param[in] parent Asset path
-			 * \param[in] scene Assimp scene to load from
-			 * \param[in] bone_map Bone map created in model
+			 * \param[in] model Cooked model holding the skeleton and keyframes
 			 * \param[in] animationIndex Index of animation to be loaded
 			*/
-		AssimpAnimation(const std::string& ident, const std::string& parent, const aiScene* scene, const std::map<std::string, BoneInfo>& bone_map, int animationIndex);
-
-	private:
-
-			/**
-			 * \brief Load Assimp aiNode structure from root node into SceneNode structure recursively
-			 * \param[in] node SceneNode to load too
-			 * \param[in] src aiNode to load from
-			**/
-		void ProcessNode(SceneNode& node, const aiNode* src);
+		AssimpAnimation(const std::string& ident, const std::string& parent, const CookedModel& model, int animationIndex);
 	};
 }
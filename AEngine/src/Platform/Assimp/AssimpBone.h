@@ -4,12 +4,11 @@
 **/
 
 #pragma once
-#include <assimp/anim.h>
-
 #include "AEngine/Render/Bone.h"
 
 namespace AEngine
 {
+	struct CookedChannel;
 
 		/**
 		 * \class AssimpBone
@@ -20,15 +19,8 @@ namespace AEngine
 	public:
 			/**
 			 * \brief Contructor
-			 * \param[in] animNode Assimp aiNodeAnim to load from
-			**/
-		AssimpBone(const aiNodeAnim* animNode);
-
-	private:
-			/**
-			 * \brief Load bone keyframes
-			 * \param[in] animNode Assimp animNode to load from
+			 * \param[in] channel Cooked keyframes to load from
 			**/
-		void LoadData(const aiNodeAnim* animNode);
+		AssimpBone(const CookedChannel& channel);
 	};
-}
\ No newline at end of file
+}
@@ -6,18 +6,32 @@
 #pragma once
 
 #include "AEngine/Render/Model.h"
+#include "AssimpModelCache.h"
 
-#include <assimp/Importer.hpp>
-#include <assimp/postprocess.h>
-#include <assimp/scene.h>
+#include <string>
+#include <utility>
+#include <vector>
 
 #define MAX_BONE_INFLUENCE 4
 
 namespace AEngine
 {
+	class Image;
+
+		/**
+		 * \struct AssimpModelSource
+		 * \brief A cooked model and the textures its materials use
+		**/
+	struct AssimpModelSource : public ModelSource
+	{
+		UniquePtr<CookedModel> model; // null if the import failed
+		std::vector<std::pair<std::string, SharedPtr<Image>>> textures; // texture path and image
+	};
+
         /**
 		 * \class AssimpModel
 		 * \brief Contains implementation to load Model data using Assimp
+		 * \details Models are imported once and then loaded from the file cooked by AssimpModelCache
 		**/
 	class AssimpModel : public Model
 	{
@@ -28,35 +42,34 @@ namespace AEngine
 			 * \param[in] path Asset path
 			**/
 		AssimpModel(const std::string& ident, const std::string& path);
+			/**
+			 * \brief Constructor creates the model from a cooked model
+			 * \param[in] ident Asset ident
+			 * \param[in] path Asset path
+			 * \param[in] source Model returned by Decode
+			**/
+		AssimpModel(const std::string& ident, const std::string& path, const AssimpModelSource& source);
 		
 		virtual ~AssimpModel();
 
+			/**
+			 * \copydoc Model::Decode
+			**/
+		static SharedPtr<ModelSource> Decode(const std::string& path);
+
 	private:
 			/**
-			 * \brief Recursively processes nodes to load meshes
-			 * \param[in] node Assimp node
-			 * \param[in] scene Assimp scene to load from
+			 * \brief Loads the cooked model
+			 * \param[in] path Asset path
+			 * \param[in] decodeTextures also decode the textures used by the materials
 			**/
-		void ProcessNode(const aiNode* node, const aiScene* scene);
+		static SharedPtr<AssimpModelSource> Import(const std::string& path, bool decodeTextures);
 			/**
 			 * \brief Create a mesh and instantiate a material
-			 * \param[in] scene Assimp scene to load from
-			 * \param[in] mesh Assimp mesh to read from
+			 * \param[in] model Cooked model to load from
+			 * \param[in] mesh Cooked mesh to upload
 			 * \return mesh_material A mesh to material ID pair
 			**/
-		mesh_material CreateMesh(const aiScene* scene, const aiMesh* mesh);
-			/**
-			 * \brief Maps bone names to a int ID
-			 * \param[in] name Bone name
-			 * \param[in] bone Bone to load info from
-			**/
-		int NameToID(std::string& name, const aiBone* bone);
-			/**
-			 * \brief Loads bone vertex weights and ids
-			 * \param[in] mesh Assimp mesh object to load from
-			 * \param[in] boneWeights vector to store boneweights
-			 * \param[in] boneIDs vector to store boneids
-			**/
-		void LoadMeshBones(const aiMesh* mesh, std::vector<float>& BoneWeights, std::vector<int>& BoneIDs);
+		mesh_material CreateMesh(const CookedModel& model, const CookedMesh& mesh);
 	};
-}
\ No newline at end of file
+}
@@ -0,0 +1,782 @@
+#include "AssimpModelCache.h"
+#include "AEngine/Core/Logger.h"
+#include "AEngine/Core/TimeStep.h"
+#include "AEngine/Render/MeshBuilder.h"
+#include "AssimpModel.h"
+
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+
+namespace
+{
+	using namespace AEngine;
+
+	constexpr char CacheMagic[4] = { 'A', 'E', 'M', 'C' };
+		// bump whenever the layout below changes, older files are then cooked again
+	constexpr Uint32 CacheVersion = 2;
+		// arrays start on this boundary so they can be used in place
+	constexpr Size_t CacheAlignment = 16;
+
+	static constexpr aiTextureType ai_TextureList[] = {
+		aiTextureType_NONE, aiTextureType_DIFFUSE, aiTextureType_SPECULAR, aiTextureType_AMBIENT,
+		aiTextureType_EMISSIVE, aiTextureType_HEIGHT, aiTextureType_NORMALS, aiTextureType_SHININESS,
+		aiTextureType_OPACITY, aiTextureType_DISPLACEMENT, aiTextureType_LIGHTMAP, aiTextureType_REFLECTION,
+		aiTextureType_BASE_COLOR, aiTextureType_NORMAL_CAMERA, aiTextureType_EMISSION_COLOR,
+		aiTextureType_METALNESS, aiTextureType_DIFFUSE_ROUGHNESS, aiTextureType_AMBIENT_OCCLUSION
+	};
+
+	struct CacheHeader
+	{
+		char magic[4];
+		Uint32 version;
+		Uint64 sourceSize;
+		Uint64 sourceTime;
+		Uint64 sourceHash;
+	};
+
+//--------------------------------------------------------------------------------
+// Source
+//--------------------------------------------------------------------------------
+	bool GetSourceStamp(const std::string& path, Uint64& size, Uint64& time)
+	{
+		std::error_code error;
+		const auto fileSize = std::filesystem::file_size(path, error);
+		if (error)
+		{
+			return false;
+		}
+
+		const auto fileTime = std::filesystem::last_write_time(path, error);
+		if (error)
+		{
+			return false;
+		}
+
+		size = static_cast<Uint64>(fileSize);
+		time = static_cast<Uint64>(fileTime.time_since_epoch().count());
+		return true;
+	}
+
+	Uint64 HashFile(const std::string& path)
+	{
+		// FNV-1a, only needed when cooking or when the timestamp no longer matches
+		Uint64 hash = 14695981039346656037ull;
+		UniquePtr<MappedFile> file = MappedFile::Open(path);
+		if (!file)
+		{
+			return hash;
+		}
+
+		const unsigned char* data = reinterpret_cast<const unsigned char*>(file->GetData());
+		for (Size_t i = 0; i < file->GetSize(); ++i)
+		{
+			hash ^= data[i];
+			hash *= 1099511628211ull;
+		}
+
+		return hash;
+	}
+
+	bool IsCacheCurrent(const std::string& path, const std::string& cachePath)
+	{
+		CacheHeader header;
+		std::ifstream cache(cachePath, std::ios::binary);
+		if (!cache.read(reinterpret_cast<char*>(&header), sizeof(header)))
+		{
+			return false;
+		}
+		cache.close();
+
+		if (std::memcmp(header.magic, CacheMagic, sizeof(CacheMagic)) != 0 || header.version != CacheVersion)
+		{
+			return false;
+		}
+
+		Uint64 size = 0;
+		Uint64 time = 0;
+		if (!GetSourceStamp(path, size, time) || size != header.sourceSize)
+		{
+			return false;
+		}
+
+		if (time == header.sourceTime)
+		{
+			return true;
+		}
+
+		// touched but maybe not changed, e.g. by a checkout
+		if (HashFile(path) != header.sourceHash)
+		{
+			return false;
+		}
+
+		// store the new time so the source is not hashed again next load
+		header.sourceTime = time;
+		std::fstream refresh(cachePath, std::ios::in | std::ios::out | std::ios::binary);
+		refresh.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		return true;
+	}
+
+//--------------------------------------------------------------------------------
+// Binary Streams
+//--------------------------------------------------------------------------------
+	Size_t AlignOffset(Size_t offset)
+	{
+		return (offset + CacheAlignment - 1) / CacheAlignment * CacheAlignment;
+	}
+
+	class BinaryWriter
+	{
+	public:
+		template <typename T>
+		void Write(const T& value)
+		{
+			WriteBytes(&value, sizeof(T));
+		}
+
+		template <typename T>
+		void WriteArray(const T* values, Size_t count)
+		{
+			m_data.resize(AlignOffset(m_data.size()));
+			WriteBytes(values, sizeof(T) * count);
+		}
+
+		void WriteString(const std::string& value)
+		{
+			Write(static_cast<Uint32>(value.size()));
+			WriteBytes(value.data(), value.size());
+		}
+
+		std::vector<char>& GetData()
+		{
+			return m_data;
+		}
+
+	private:
+		void WriteBytes(const void* data, Size_t size)
+		{
+			const char* bytes = static_cast<const char*>(data);
+			m_data.insert(m_data.end(), bytes, bytes + size);
+		}
+
+		std::vector<char> m_data;
+	};
+
+	class BinaryReader
+	{
+	public:
+		BinaryReader(const char* data, Size_t size)
+			: m_data{ data }, m_size{ size }, m_offset{ 0 }, m_valid{ true }
+		{
+
+		}
+
+		template <typename T>
+		T Read()
+		{
+			T value{};
+			if (Reserve(sizeof(T)))
+			{
+				std::memcpy(&value, m_data + m_offset, sizeof(T));
+				m_offset += sizeof(T);
+			}
+
+			return value;
+		}
+
+		template <typename T>
+		const T* ReadArray(Size_t count)
+		{
+			m_offset = AlignOffset(m_offset);
+			if (!Reserve(sizeof(T) * count))
+			{
+				return nullptr;
+			}
+
+			const T* values = reinterpret_cast<const T*>(m_data + m_offset);
+			m_offset += sizeof(T) * count;
+			return values;
+		}
+
+		std::string ReadString()
+		{
+			const Uint32 length = Read<Uint32>();
+			if (!Reserve(length))
+			{
+				return std::string();
+			}
+
+			std::string value(m_data + m_offset, length);
+			m_offset += length;
+			return value;
+		}
+
+		bool IsValid() const
+		{
+			return m_valid;
+		}
+
+	private:
+		bool Reserve(Size_t size)
+		{
+			if (!m_valid || m_offset > m_size || size > m_size - m_offset)
+			{
+				m_valid = false;
+			}
+
+			return m_valid;
+		}
+
+		const char* m_data;
+		Size_t m_size;
+		Size_t m_offset;
+		bool m_valid;
+	};
+
+//--------------------------------------------------------------------------------
+// Cooking
+//--------------------------------------------------------------------------------
+	TextureType GetAETextureType(aiTextureType type)
+	{
+		switch(type)
+		{
+			case aiTextureType_NONE:                return TextureType::None;
+			case aiTextureType_DIFFUSE:             return TextureType::Diffuse;
+			case aiTextureType_SPECULAR:            return TextureType::Specular;
+			case aiTextureType_AMBIENT:             return TextureType::Ambient;
+			case aiTextureType_EMISSIVE:            return TextureType::Emissive;
+			case aiTextureType_HEIGHT:              return TextureType::Height;
+			case aiTextureType_NORMALS:             return TextureType::Normals;
+			case aiTextureType_SHININESS:           return TextureType::Shininess;
+			case aiTextureType_OPACITY:             return TextureType::Opacity;
+			case aiTextureType_DISPLACEMENT:        return TextureType::Displacement;
+			case aiTextureType_LIGHTMAP:            return TextureType::Lightmap;
+			case aiTextureType_REFLECTION:          return TextureType::Reflection;
+			case aiTextureType_BASE_COLOR:          return TextureType::BaseColor;
+			case aiTextureType_NORMAL_CAMERA:       return TextureType::NormalCamera;
+			case aiTextureType_EMISSION_COLOR:      return TextureType::EmissionColor;
+			case aiTextureType_METALNESS:           return TextureType::Metalness;
+			case aiTextureType_DIFFUSE_ROUGHNESS:   return TextureType::DiffuseRoughness;
+			case aiTextureType_AMBIENT_OCCLUSION:   return TextureType::AmbientOcclusion;
+			default:                                return TextureType::Unknown;
+		}
+	}
+
+	struct CookStats
+	{
+		Size_t vertexCount = 0;
+		Size_t unpackedVertexBytes = 0;
+		Size_t packedVertexBytes = 0;
+		Size_t unpackedIndexBytes = 0;
+		Size_t packedIndexBytes = 0;
+	};
+
+	class SceneCooker
+	{
+	public:
+		SceneCooker(const aiScene* scene, const std::string& directory)
+			: m_scene{ scene }, m_directory{ directory }
+		{
+
+		}
+
+		void Cook(BinaryWriter& writer)
+		{
+			// meshes are stored in the order the node hierarchy lists them
+			std::vector<const aiMesh*> meshes;
+			CollectMeshes(m_scene->mRootNode, meshes);
+			writer.Write(static_cast<Uint32>(meshes.size()));
+			for (const aiMesh* mesh : meshes)
+			{
+				WriteMesh(writer, mesh);
+			}
+
+			writer.Write(static_cast<Uint32>(m_scene->mNumMaterials));
+			for (unsigned int i = 0; i < m_scene->mNumMaterials; i++)
+			{
+				WriteMaterial(writer, m_scene->mMaterials[i]);
+			}
+
+			// bone ids are handed out while the meshes are written
+			writer.Write(static_cast<Uint32>(m_bones.size()));
+			for (const auto& [name, info] : m_bones)
+			{
+				writer.WriteString(name);
+				writer.Write(info.id);
+				writer.Write(info.offset);
+			}
+
+			WriteNode(writer, m_scene->mRootNode);
+
+			writer.Write(static_cast<Uint32>(m_scene->mNumAnimations));
+			for (unsigned int i = 0; i < m_scene->mNumAnimations; i++)
+			{
+				WriteAnimation(writer, m_scene->mAnimations[i]);
+			}
+		}
+
+		const CookStats& GetStats() const
+		{
+			return m_stats;
+		}
+
+	private:
+		void CollectMeshes(const aiNode* node, std::vector<const aiMesh*>& meshes)
+		{
+			for (unsigned int i = 0; i < node->mNumMeshes; i++)
+			{
+				meshes.push_back(m_scene->mMeshes[node->mMeshes[i]]);
+			}
+
+			for (unsigned int i = 0; i < node->mNumChildren; i++)
+			{
+				CollectMeshes(node->mChildren[i], meshes);
+			}
+		}
+
+		void WriteMesh(BinaryWriter& writer, const aiMesh* mesh)
+		{
+			const Uint32 vertexCount = mesh->mNumVertices;
+			Uint32 indexCount = 0;
+			for (unsigned int i = 0; i < mesh->mNumFaces; i++)
+			{
+				indexCount += mesh->mFaces[i].mNumIndices;
+			}
+
+			MeshBuilder builder(vertexCount, indexCount, mesh->HasBones());
+			for (unsigned int i = 0; i < mesh->mNumFaces; i++)
+			{
+				const aiFace& face = mesh->mFaces[i];
+				for (unsigned int j = 0; j < face.mNumIndices; j++)
+				{
+					builder.AddIndex(face.mIndices[j]);
+				}
+			}
+
+			const bool hasTexCoords = mesh->HasTextureCoords(0);
+			for (unsigned int i = 0; i < vertexCount; i++)
+			{
+				const aiVector3D& position = mesh->mVertices[i];
+				builder.SetPosition(i, Math::vec3(position.x, position.y, position.z));
+				if (hasTexCoords)
+				{
+					builder.SetTexCoord(i, Math::vec2(mesh->mTextureCoords[0][i].x, mesh->mTextureCoords[0][i].y));
+				}
+
+				if (mesh->HasNormals())
+				{
+					builder.SetNormal(i, Math::vec3(mesh->mNormals[i].x, mesh->mNormals[i].y, mesh->mNormals[i].z));
+				}
+			}
+
+			for (unsigned int i = 0; i < mesh->mNumBones; i++)
+			{
+				const aiBone* bone = mesh->mBones[i];
+				const Uint32 id = static_cast<Uint32>(NameToID(bone));
+				for (unsigned int j = 0; j < bone->mNumWeights; j++)
+				{
+					builder.AddBoneInfluence(bone->mWeights[j].mVertexId, id, bone->mWeights[j].mWeight);
+				}
+			}
+
+			const MeshStream stream = builder.Build();
+			writer.Write(stream.vertexCount);
+			writer.Write(stream.indexCount);
+			writer.Write(static_cast<Uint32>(mesh->mMaterialIndex));
+			writer.Write(stream.format);
+			writer.Write(static_cast<Uint32>(stream.indexType));
+			writer.Write(stream.bounds.min);
+			writer.Write(stream.bounds.max);
+			writer.WriteArray(stream.vertices.data(), stream.vertices.size());
+			writer.WriteArray(stream.indices.data(), stream.indices.size());
+
+			// what the separate float streams and 32-bit indices used to take
+			const Size_t unpackedStride = 5 * sizeof(float)
+				+ (mesh->HasNormals() ? 3 * sizeof(float) : 0)
+				+ (mesh->HasBones() ? MAX_BONE_INFLUENCE * (sizeof(int) + sizeof(float)) : 0);
+			m_stats.vertexCount += vertexCount;
+			m_stats.unpackedVertexBytes += unpackedStride * vertexCount;
+			m_stats.packedVertexBytes += stream.vertices.size();
+			m_stats.unpackedIndexBytes += sizeof(Uint32) * stream.indexCount;
+			m_stats.packedIndexBytes += stream.indices.size();
+		}
+
+		int NameToID(const aiBone* bone)
+		{
+			const std::string name = bone->mName.C_Str();
+			auto it = m_bones.find(name);
+			if (it != m_bones.end())
+			{
+				return it->second.id;
+			}
+
+			BoneInfo info;
+			info.id = static_cast<int>(m_bones.size());
+			info.offset = Math::transpose(Math::make_mat4(&bone->mOffsetMatrix.a1));
+			m_bones.emplace(name, info);
+			return info.id;
+		}
+
+		void WriteMaterial(BinaryWriter& writer, const aiMaterial* ai_mat)
+		{
+			writer.WriteString(ai_mat->GetName().C_Str());
+
+			MaterialProperties props;
+			aiColor4D color4;
+			ai_mat->Get(AI_MATKEY_COLOR_DIFFUSE, color4);
+			props.baseColor = Math::vec4(color4.r, color4.g, color4.b, color4.a); // Remove alpha replace with transparencyFactor
+
+			aiColor3D color3;
+			aiColor3D reset;
+			ai_mat->Get(AI_MATKEY_COLOR_EMISSIVE, color3);
+			props.emissionColor = Math::vec3(color3.r, color3.g, color3.b);
+			color3 = reset;
+			ai_mat->Get(AI_MATKEY_COLOR_AMBIENT, color3);
+			props.ambientColor = Math::vec3(color3.r, color3.g, color3.b);
+			color3 = reset;
+			ai_mat->Get(AI_MATKEY_COLOR_TRANSPARENT, color3);
+			props.transparencyColor = Math::vec3(color3.r, color3.g, color3.b);
+
+			ai_real floatval = 0;
+			ai_real reset2 = 0;
+			ai_mat->Get(AI_MATKEY_SHININESS_STRENGTH, floatval);
+			props.shininessStrength = floatval;
+			floatval = reset2;
+			ai_mat->Get(AI_MATKEY_OPACITY, floatval); // Seems to just be alpha
+			props.transparencyFactor = floatval;
+			floatval = reset2;
+			ai_mat->Get(AI_MATKEY_REFRACTI, floatval);
+			props.ior = floatval;
+			floatval = reset2;
+			ai_mat->Get(AI_MATKEY_SHININESS, floatval);
+			props.shininess = floatval;
+			writer.Write(props);
+
+			// the first texture of each type, looked for next to the model whatever path it was exported with
+			std::vector<std::pair<TextureType, std::string>> textures;
+			for (auto ai_type : ai_TextureList)
+			{
+				aiString str;
+				if (ai_mat->GetTextureCount(ai_type) == 0 || ai_mat->GetTexture(ai_type, 0, &str) != AI_SUCCESS)
+				{
+					continue;
+				}
+
+				std::string filename = str.C_Str();
+				Size_t last = filename.find_last_of("\\");
+				if (last != std::string::npos)
+					filename = filename.substr(last + 1);
+
+				textures.emplace_back(GetAETextureType(ai_type), m_directory + "/" + filename);
+			}
+
+			writer.Write(static_cast<Uint32>(textures.size()));
+			for (const auto& [type, path] : textures)
+			{
+				writer.Write(static_cast<int>(type));
+				writer.WriteString(path);
+			}
+		}
+
+		void WriteNode(BinaryWriter& writer, const aiNode* node)
+		{
+			writer.WriteString(node->mName.C_Str());
+			writer.Write(Math::transpose(Math::make_mat4(&node->mTransformation.a1)));
+			writer.Write(static_cast<Uint32>(node->mNumChildren));
+			for (unsigned int i = 0; i < node->mNumChildren; i++)
+			{
+				WriteNode(writer, node->mChildren[i]);
+			}
+		}
+
+		void WriteAnimation(BinaryWriter& writer, const aiAnimation* animation)
+		{
+			writer.WriteString(animation->mName.C_Str());
+			writer.Write(static_cast<float>(animation->mDuration));
+			writer.Write(static_cast<float>(animation->mTicksPerSecond));
+			writer.Write(static_cast<Uint32>(animation->mNumChannels));
+			for (unsigned int i = 0; i < animation->mNumChannels; i++)
+			{
+				const aiNodeAnim* channel = animation->mChannels[i];
+				writer.WriteString(channel->mNodeName.C_Str());
+
+				std::vector<KeyPosition> positions(channel->mNumPositionKeys);
+				for (unsigned int p = 0; p < channel->mNumPositionKeys; p++)
+				{
+					const aiVectorKey& key = channel->mPositionKeys[p];
+					positions[p] = { Math::vec3(key.mValue.x, key.mValue.y, key.mValue.z), static_cast<float>(key.mTime) };
+				}
+
+				std::vector<KeyRotation> rotations(channel->mNumRotationKeys);
+				for (unsigned int r = 0; r < channel->mNumRotationKeys; r++)
+				{
+					const aiQuatKey& key = channel->mRotationKeys[r];
+					rotations[r] = { Math::quat(key.mValue.w, key.mValue.x, key.mValue.y, key.mValue.z), static_cast<float>(key.mTime) };
+				}
+
+				std::vector<KeyScale> scales(channel->mNumScalingKeys);
+				for (unsigned int s = 0; s < channel->mNumScalingKeys; s++)
+				{
+					const aiVectorKey& key = channel->mScalingKeys[s];
+					scales[s] = { Math::vec3(key.mValue.x, key.mValue.y, key.mValue.z), static_cast<float>(key.mTime) };
+				}
+
+				writer.Write(static_cast<Uint32>(positions.size()));
+				writer.WriteArray(positions.data(), positions.size());
+				writer.Write(static_cast<Uint32>(rotations.size()));
+				writer.WriteArray(rotations.data(), rotations.size());
+				writer.Write(static_cast<Uint32>(scales.size()));
+				writer.WriteArray(scales.data(), scales.size());
+			}
+		}
+
+		const aiScene* m_scene;
+		std::string m_directory;
+		std::map<std::string, BoneInfo> m_bones;
+		CookStats m_stats;
+	};
+
+	bool CookToBytes(const std::string& path, std::vector<char>& bytes)
+	{
+		CacheHeader header;
+		std::memcpy(header.magic, CacheMagic, sizeof(CacheMagic));
+		header.version = CacheVersion;
+		if (!GetSourceStamp(path, header.sourceSize, header.sourceTime))
+		{
+			AE_LOG_ERROR("AssimpModelCache::Cook::Failed -> {} not found", path);
+			return false;
+		}
+
+		header.sourceHash = HashFile(path);
+
+		Assimp::Importer importer;
+		const aiScene* scene = importer.ReadFile(path, aiProcess_Triangulate | aiProcess_FlipUVs);
+		if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode)
+		{
+			AE_LOG_ERROR("AssimpModelCache::Cook::Failed -> {}", importer.GetErrorString());
+			return false;
+		}
+
+		BinaryWriter writer;
+		writer.Write(header);
+		SceneCooker cooker(scene, path.substr(0, path.find_last_of('/')));
+		cooker.Cook(writer);
+		bytes = std::move(writer.GetData());
+
+		const CookStats& stats = cooker.GetStats();
+		if (stats.vertexCount > 0)
+		{
+			const double vertexCount = static_cast<double>(stats.vertexCount);
+			AE_LOG_INFO(
+				"AssimpModelCache::Cook::Meshes -> {} ({} vertices, {:.1f} -> {:.1f} bytes per vertex, indices {} -> {} bytes)",
+				path, stats.vertexCount,
+				stats.unpackedVertexBytes / vertexCount, stats.packedVertexBytes / vertexCount,
+				stats.unpackedIndexBytes, stats.packedIndexBytes
+			);
+		}
+
+		return true;
+	}
+
+	bool WriteCache(const std::string& cachePath, const std::vector<char>& bytes)
+	{
+		// written beside the cache and renamed over it, so a reader never sees half a file
+		const std::string tempPath = cachePath + ".tmp";
+		{
+			std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+			if (!file.write(bytes.data(), static_cast<std::streamsize>(bytes.size())))
+			{
+				AE_LOG_WARN("AssimpModelCache::Cook::Warning -> Could not write {}", cachePath);
+				return false;
+			}
+		}
+
+		std::error_code error;
+		std::filesystem::rename(tempPath, cachePath, error);
+		if (error)
+		{
+			AE_LOG_WARN("AssimpModelCache::Cook::Warning -> Could not write {}", cachePath);
+			std::filesystem::remove(tempPath, error);
+			return false;
+		}
+
+		return true;
+	}
+
+//--------------------------------------------------------------------------------
+// Reading
+//--------------------------------------------------------------------------------
+	void ReadNode(BinaryReader& reader, SceneNode& node)
+	{
+		node.name = reader.ReadString();
+		node.transformation = reader.Read<Math::mat4>();
+		const Uint32 childCount = reader.Read<Uint32>();
+		node.numChildren = static_cast<int>(childCount);
+		for (Uint32 i = 0; i < childCount && reader.IsValid(); i++)
+		{
+			node.children.emplace_back();
+			ReadNode(reader, node.children.back());
+		}
+	}
+
+	bool ReadModel(const char* data, Size_t size, CookedModel& model)
+	{
+		BinaryReader reader(data, size);
+		reader.Read<CacheHeader>();
+
+		const Uint32 meshCount = reader.Read<Uint32>();
+		for (Uint32 i = 0; i < meshCount && reader.IsValid(); i++)
+		{
+			CookedMesh mesh;
+			mesh.vertexCount = reader.Read<Uint32>();
+			mesh.indexCount = reader.Read<Uint32>();
+			mesh.materialIndex = reader.Read<Uint32>();
+			mesh.format = reader.Read<Uint32>();
+			const Uint32 indexType = reader.Read<Uint32>();
+			if (indexType > static_cast<Uint32>(IndexType::Uint32))
+			{
+				return false;
+			}
+
+			mesh.indexType = static_cast<IndexType>(indexType);
+			mesh.bounds.min = reader.Read<Math::vec3>();
+			mesh.bounds.max = reader.Read<Math::vec3>();
+
+			const Size_t vertexBytes = static_cast<Size_t>(MeshBuilder::GetStride(mesh.format)) * mesh.vertexCount;
+			const Size_t indexBytes = static_cast<Size_t>(IndexBuffer::GetIndexSize(mesh.indexType)) * mesh.indexCount;
+			mesh.vertices = reader.ReadArray<Uint8>(vertexBytes);
+			mesh.indices = reader.ReadArray<Uint8>(indexBytes);
+
+			model.meshes.push_back(mesh);
+		}
+
+		const Uint32 materialCount = reader.Read<Uint32>();
+		for (Uint32 i = 0; i < materialCount && reader.IsValid(); i++)
+		{
+			CookedMaterial material;
+			material.name = reader.ReadString();
+			material.properties = reader.Read<MaterialProperties>();
+			const Uint32 textureCount = reader.Read<Uint32>();
+			for (Uint32 t = 0; t < textureCount && reader.IsValid(); t++)
+			{
+				const TextureType type = static_cast<TextureType>(reader.Read<int>());
+				material.textures.push_back({ type, reader.ReadString() });
+			}
+
+			model.materials.push_back(std::move(material));
+		}
+
+		const Uint32 boneCount = reader.Read<Uint32>();
+		for (Uint32 i = 0; i < boneCount && reader.IsValid(); i++)
+		{
+			std::string name = reader.ReadString();
+			BoneInfo info;
+			info.id = reader.Read<int>();
+			info.offset = reader.Read<Math::mat4>();
+			model.bones.emplace(std::move(name), info);
+		}
+
+		ReadNode(reader, model.root);
+
+		const Uint32 animationCount = reader.Read<Uint32>();
+		for (Uint32 i = 0; i < animationCount && reader.IsValid(); i++)
+		{
+			CookedAnimation animation;
+			animation.name = reader.ReadString();
+			animation.duration = reader.Read<float>();
+			animation.ticksPerSecond = reader.Read<float>();
+			const Uint32 channelCount = reader.Read<Uint32>();
+			for (Uint32 c = 0; c < channelCount && reader.IsValid(); c++)
+			{
+				CookedChannel channel;
+				channel.name = reader.ReadString();
+				channel.positionCount = reader.Read<Uint32>();
+				channel.positions = reader.ReadArray<KeyPosition>(channel.positionCount);
+				channel.rotationCount = reader.Read<Uint32>();
+				channel.rotations = reader.ReadArray<KeyRotation>(channel.rotationCount);
+				channel.scaleCount = reader.Read<Uint32>();
+				channel.scales = reader.ReadArray<KeyScale>(channel.scaleCount);
+				animation.channels.push_back(std::move(channel));
+			}
+
+			model.animations.push_back(std::move(animation));
+		}
+
+		return reader.IsValid();
+	}
+}
+
+namespace AEngine
+{
+	std::string AssimpModelCache::GetCachePath(const std::string& path)
+	{
+		return path + ".aecache";
+	}
+
+	bool AssimpModelCache::Cook(const std::string& path)
+	{
+		std::vector<char> bytes;
+		return CookToBytes(path, bytes) && WriteCache(GetCachePath(path), bytes);
+	}
+
+	UniquePtr<CookedModel> AssimpModelCache::Load(const std::string& path)
+	{
+		using Clock = std::chrono::steady_clock;
+		const Clock::time_point start = Clock::now();
+		const std::string cachePath = GetCachePath(path);
+
+		// warm, the arrays point straight into the mapped file
+		if (IsCacheCurrent(path, cachePath))
+		{
+			UniquePtr<CookedModel> model = MakeUnique<CookedModel>();
+			model->file = MappedFile::Open(cachePath);
+			if (model->file && ReadModel(model->file->GetData(), model->file->GetSize(), *model))
+			{
+				AE_LOG_INFO("AssimpModelCache::Load::Warm -> {} ({:.2f} ms)", path, TimeStep(Clock::now() - start).Milliseconds());
+				return model;
+			}
+
+			AE_LOG_WARN("AssimpModelCache::Load::Warning -> {} is corrupt, cooking again", cachePath);
+		}
+
+		// cold, import and cook the model first
+		std::vector<char> bytes;
+		if (!CookToBytes(path, bytes))
+		{
+			return nullptr;
+		}
+
+		UniquePtr<CookedModel> model = MakeUnique<CookedModel>();
+		if (WriteCache(cachePath, bytes))
+		{
+			model->file = MappedFile::Open(cachePath);
+		}
+
+		bool loaded = false;
+		if (model->file)
+		{
+			loaded = ReadModel(model->file->GetData(), model->file->GetSize(), *model);
+		}
+		else
+		{
+			model->bytes = std::move(bytes);
+			loaded = ReadModel(model->bytes.data(), model->bytes.size(), *model);
+		}
+
+		if (!loaded)
+		{
+			AE_LOG_ERROR("AssimpModelCache::Load::Failed -> {}", path);
+			return nullptr;
+		}
+
+		AE_LOG_INFO("AssimpModelCache::Load::Cold -> {} ({:.2f} ms)", path, TimeStep(Clock::now() - start).Milliseconds());
+		return model;
+	}
+}
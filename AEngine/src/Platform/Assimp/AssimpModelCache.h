@@ -0,0 +1,136 @@
+/**
+ * \file
+ * \author Ben Hawkins (34112619)
+ * \author Christien Alden (34119981)
+**/
+
+#pragma once
+
+#include "AEngine/Core/Types.h"
+#include "AEngine/Math/Bounds.h"
+#include "AEngine/Render/Animation.h"
+#include "AEngine/Render/Bone.h"
+#include "AEngine/Render/Material.h"
+#include "AEngine/Render/Types.h"
+#include "AEngine/Resource/MappedFile.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace AEngine
+{
+		/**
+		 * \struct CookedMesh
+		 * \brief Interleaved vertices and indices of a mesh, laid out as they are uploaded
+		 * \note Arrays point into the storage owned by the CookedModel
+		**/
+	struct CookedMesh
+	{
+		Uint32 vertexCount;
+		Uint32 indexCount;
+		Uint32 materialIndex;
+		Uint32 format; // MeshBuilder::Format flags
+		IndexType indexType;
+		Math::AABB bounds;
+		const Uint8* vertices; // MeshBuilder::GetStride(format) bytes per vertex
+		const Uint8* indices;
+	};
+
+		/**
+		 * \struct CookedTexture
+		 * \brief Texture used by a material
+		**/
+	struct CookedTexture
+	{
+		TextureType type;
+		std::string path; // next to the model, as passed to AssetManager<Texture>::Load
+	};
+
+		/**
+		 * \struct CookedMaterial
+		 * \brief Material properties and textures
+		**/
+	struct CookedMaterial
+	{
+		std::string name;
+		MaterialProperties properties;
+		std::vector<CookedTexture> textures;
+	};
+
+		/**
+		 * \struct CookedChannel
+		 * \brief Keyframes of a single bone
+		 * \note Arrays point into the storage owned by the CookedModel
+		**/
+	struct CookedChannel
+	{
+		std::string name;
+		const KeyPosition* positions;
+		Uint32 positionCount;
+		const KeyRotation* rotations;
+		Uint32 rotationCount;
+		const KeyScale* scales;
+		Uint32 scaleCount;
+	};
+
+		/**
+		 * \struct CookedAnimation
+		 * \brief Keyframes of an animation
+		**/
+	struct CookedAnimation
+	{
+		std::string name;
+		float duration;
+		float ticksPerSecond;
+		std::vector<CookedChannel> channels;
+	};
+
+		/**
+		 * \struct CookedModel
+		 * \brief Everything AssimpModel needs to create a model, without Assimp
+		**/
+	struct CookedModel
+	{
+		std::vector<CookedMesh> meshes;
+		std::vector<CookedMaterial> materials;
+		std::map<std::string, BoneInfo> bones;
+		SceneNode root; // node hierarchy the animations are applied to
+		std::vector<CookedAnimation> animations;
+
+		UniquePtr<MappedFile> file; // the cooked file the arrays point into
+		std::vector<char> bytes; // used instead when the cooked file could not be written
+	};
+
+		/**
+		 * \class AssimpModelCache
+		 * \brief Cooks models imported with Assimp into a binary file kept next to the source
+		 * \details
+		 * The cooked file holds the vertex streams, indices, bone weights, materials, skeleton and
+		 * keyframes in the layout they are used, so a warm load maps the file and uploads straight
+		 * from it. The source's size and modification time are stored with a hash of its contents,
+		 * a source that was only touched keeps its cooked file.
+		**/
+	class AssimpModelCache
+	{
+	public:
+			/**
+			 * \brief Gets the path of the cooked file for a model
+			 * \param[in] path Model path
+			**/
+		static std::string GetCachePath(const std::string& path);
+			/**
+			 * \brief Imports a model and writes its cooked file
+			 * \param[in] path Model path
+			 * \retval true if the cooked file was written
+			**/
+		static bool Cook(const std::string& path);
+			/**
+			 * \brief Loads a model from its cooked file, cooking it first if it is missing or stale
+			 * \param[in] path Model path
+			 * \return The cooked model, or nullptr if the model could not be imported
+			 * \note Safe to call from any thread
+			**/
+		static UniquePtr<CookedModel> Load(const std::string& path);
+	};
+}
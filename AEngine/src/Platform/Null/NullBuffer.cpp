@@ -0,0 +1,162 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#include "NullBuffer.h"
+#include "NullRenderCommand.h"
+#include <algorithm>
+
+namespace
+{
+	void RecordUpload(AEngine::Intptr_t bytes)
+	{
+		AEngine::NullRenderStats& stats = AEngine::NullRenderCommand::GetStats();
+		++stats.uploads;
+		stats.bytesUploaded += static_cast<AEngine::Size_t>(bytes);
+	}
+}
+
+namespace AEngine
+{
+//--------------------------------------------------------------------------------
+// Vertex Buffer
+//--------------------------------------------------------------------------------
+	NullVertexBuffer::NullVertexBuffer()
+		: m_size{ 0 }
+	{
+
+	}
+
+	void NullVertexBuffer::Bind() const
+	{
+		++NullRenderCommand::GetStats().bufferBinds;
+	}
+
+	void NullVertexBuffer::Unbind() const
+	{
+
+	}
+
+	Intptr_t NullVertexBuffer::Size() const
+	{
+		return m_size;
+	}
+
+	Intptr_t NullVertexBuffer::GetCount() const
+	{
+		Intptr_t layoutStride = m_layout.GetStride();
+		if (m_size == 0 || layoutStride == 0)
+		{
+			return 0;
+		}
+
+		return m_size / layoutStride;
+	}
+
+	void NullVertexBuffer::SetData(const void* data, Intptr_t bytes, BufferUsage usage)
+	{
+		m_size = bytes;
+		RecordUpload(bytes);
+	}
+
+	void NullVertexBuffer::SetSubData(const void* data, Intptr_t bytes, Intptr_t offset)
+	{
+		RecordUpload(bytes);
+	}
+
+//--------------------------------------------------------------------------------
+// Index Buffer
+//--------------------------------------------------------------------------------
+	NullIndexBuffer::NullIndexBuffer()
+		: m_count{ 0 }
+	{
+
+	}
+
+	void NullIndexBuffer::Bind() const
+	{
+		++NullRenderCommand::GetStats().bufferBinds;
+	}
+
+	void NullIndexBuffer::Unbind() const
+	{
+
+	}
+
+	Intptr_t NullIndexBuffer::GetCount() const
+	{
+		return m_count;
+	}
+
+	void NullIndexBuffer::SetData(const Uint32* data, Intptr_t count, BufferUsage usage)
+	{
+		m_count = count;
+		m_indexType = IndexType::Uint32;
+		RecordUpload(count * GetIndexSize(m_indexType));
+	}
+
+	void NullIndexBuffer::SetData(const Uint16* data, Intptr_t count, BufferUsage usage)
+	{
+		m_count = count;
+		m_indexType = IndexType::Uint16;
+		RecordUpload(count * GetIndexSize(m_indexType));
+	}
+
+//--------------------------------------------------------------------------------
+// Uniform Buffer
+//--------------------------------------------------------------------------------
+	NullUniformBuffer::NullUniformBuffer(UniformBlock block)
+		: UniformBuffer(block), m_data{}
+	{
+
+	}
+
+	void NullUniformBuffer::Bind() const
+	{
+		++NullRenderCommand::GetStats().bufferBinds;
+		NullRenderCommand::GetUniformBinding(m_block) = { this, 0, Size() };
+	}
+
+	void NullUniformBuffer::BindRange(Intptr_t offset, Intptr_t bytes) const
+	{
+		++NullRenderCommand::GetStats().bufferBinds;
+		NullRenderCommand::GetUniformBinding(m_block) = { this, offset, bytes };
+	}
+
+	void NullUniformBuffer::Unbind() const
+	{
+		NullRenderCommand::GetUniformBinding(m_block) = {};
+	}
+
+	Intptr_t NullUniformBuffer::Size() const
+	{
+		return static_cast<Intptr_t>(m_data.size());
+	}
+
+	void NullUniformBuffer::SetData(const void* data, Intptr_t bytes, BufferUsage usage)
+	{
+		const Uint8* source = static_cast<const Uint8*>(data);
+		if (source)
+		{
+			m_data.assign(source, source + bytes);
+		}
+		else
+		{
+			m_data.assign(static_cast<Size_t>(bytes), 0);
+		}
+
+		RecordUpload(bytes);
+	}
+
+	void NullUniformBuffer::SetSubData(const void* data, Intptr_t bytes, Intptr_t offset)
+	{
+		const Uint8* source = static_cast<const Uint8*>(data);
+		std::copy(source, source + bytes, m_data.begin() + offset);
+		RecordUpload(bytes);
+	}
+
+	const Uint8* NullUniformBuffer::GetData() const
+	{
+		return m_data.data();
+	}
+}
@@ -0,0 +1,132 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#pragma once
+#include "AEngine/Render/Buffer.h"
+#include <vector>
+
+namespace AEngine
+{
+		/**
+		 * \class NullVertexBuffer
+		 * \brief Vertex buffer that records uploads without storing the data
+		*/
+	class NullVertexBuffer : public VertexBuffer
+	{
+	public:
+		NullVertexBuffer();
+			/**
+			 * \copydoc VertexBuffer::Bind
+			*/
+		virtual void Bind() const override;
+			/**
+			 * \copydoc VertexBuffer::Unbind
+			*/
+		virtual void Unbind() const override;
+			/**
+			 * \copydoc VertexBuffer::Size
+			*/
+		virtual Intptr_t Size() const override;
+			/**
+			 * \copydoc VertexBuffer::GetCount
+			*/
+		virtual Intptr_t GetCount() const override;
+			/**
+			 * \copydoc VertexBuffer::SetData
+			*/
+		virtual void SetData(const void* data, Intptr_t bytes, BufferUsage usage) override;
+			/**
+			 * \copydoc VertexBuffer::SetSubData
+			*/
+		virtual void SetSubData(const void* data, Intptr_t bytes, Intptr_t offset = 0) override;
+
+	private:
+			/**
+			 * \brief The size of the vertex buffer in bytes
+			*/
+		Intptr_t m_size;
+	};
+
+		/**
+		 * \class NullIndexBuffer
+		 * \brief Index buffer that records uploads without storing the data
+		*/
+	class NullIndexBuffer : public IndexBuffer
+	{
+	public:
+		NullIndexBuffer();
+			/**
+			 * \copydoc IndexBuffer::Bind
+			*/
+		virtual void Bind() const override;
+			/**
+			 * \copydoc IndexBuffer::Unbind
+			*/
+		virtual void Unbind() const override;
+			/**
+			 * \copydoc IndexBuffer::GetCount
+			*/
+		virtual Intptr_t GetCount() const override;
+			/**
+			 * \copydoc IndexBuffer::SetData
+			*/
+		virtual void SetData(const Uint32* data, Intptr_t count, BufferUsage usage) override;
+			/**
+			 * \copydoc IndexBuffer::SetData(const Uint16*, Intptr_t, BufferUsage)
+			*/
+		virtual void SetData(const Uint16* data, Intptr_t count, BufferUsage usage) override;
+
+	private:
+			/**
+			 * \brief The number of indices in the index buffer
+			*/
+		Intptr_t m_count;
+	};
+
+		/**
+		 * \class NullUniformBuffer
+		 * \brief Uniform buffer that records uploads and keeps its data for inspection
+		 * \details Binding records the range in NullRenderCommand::GetUniformBinding
+		*/
+	class NullUniformBuffer : public UniformBuffer
+	{
+	public:
+		explicit NullUniformBuffer(UniformBlock block);
+			/**
+			 * \copydoc UniformBuffer::Bind
+			*/
+		virtual void Bind() const override;
+			/**
+			 * \copydoc UniformBuffer::BindRange
+			*/
+		virtual void BindRange(Intptr_t offset, Intptr_t bytes) const override;
+			/**
+			 * \copydoc UniformBuffer::Unbind
+			*/
+		virtual void Unbind() const override;
+			/**
+			 * \copydoc UniformBuffer::Size
+			*/
+		virtual Intptr_t Size() const override;
+			/**
+			 * \copydoc UniformBuffer::SetData
+			*/
+		virtual void SetData(const void* data, Intptr_t bytes, BufferUsage usage) override;
+			/**
+			 * \copydoc UniformBuffer::SetSubData
+			*/
+		virtual void SetSubData(const void* data, Intptr_t bytes, Intptr_t offset = 0) override;
+			/**
+			 * \brief Returns the contents of the uniform buffer
+			 * \return Pointer to Size() bytes
+			*/
+		const Uint8* GetData() const;
+
+	private:
+			/**
+			 * \brief The contents of the uniform buffer, its size is the size of the buffer
+			*/
+		std::vector<Uint8> m_data;
+	};
+}
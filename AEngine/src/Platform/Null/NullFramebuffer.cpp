@@ -0,0 +1,60 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#include "NullFramebuffer.h"
+#include "NullRenderCommand.h"
+
+namespace AEngine
+{
+	NullFramebuffer::NullFramebuffer(Math::uvec2 size)
+		: m_size(size)
+	{
+
+	}
+
+	void NullFramebuffer::TransferDepthBuffer(unsigned int dest)
+	{
+		++NullRenderCommand::GetStats().framebufferBinds;
+	}
+
+	void NullFramebuffer::SetActiveDrawBuffers(const std::vector<unsigned int>& buffers)
+	{
+
+	}
+
+	void NullFramebuffer::ResizeBuffers(Math::uvec2 size)
+	{
+		m_size = size;
+	}
+
+	void NullFramebuffer::BindBuffers(const std::vector<unsigned int>& buffers)
+	{
+		NullRenderCommand::GetStats().textureBinds += buffers.size();
+	}
+
+	void NullFramebuffer::UnbindBuffers()
+	{
+
+	}
+
+	void NullFramebuffer::Bind(FramebufferMode mode)
+	{
+		++NullRenderCommand::GetStats().framebufferBinds;
+	}
+
+	void NullFramebuffer::Unbind()
+	{
+
+	}
+
+	void NullFramebuffer::Attach(FramebufferAttachment type, unsigned int index)
+	{
+
+	}
+
+	void NullFramebuffer::Detach(FramebufferAttachment type, unsigned int index)
+	{
+
+	}
+}
@@ -0,0 +1,33 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#pragma once
+#include "AEngine/Render/Framebuffer.h"
+
+namespace AEngine
+{
+		/**
+		 * \class NullFramebuffer
+		 * \brief Framebuffer without attachments that records binds
+		*/
+	class NullFramebuffer : public Framebuffer
+	{
+	public:
+		NullFramebuffer(Math::uvec2 size);
+		~NullFramebuffer() override = default;
+
+		virtual void TransferDepthBuffer(unsigned int dest) override;
+		virtual void SetActiveDrawBuffers(const std::vector<unsigned int>& buffers) override;
+		virtual void ResizeBuffers(Math::uvec2 size) override;
+		virtual void BindBuffers(const std::vector<unsigned int>& buffers) override;
+		virtual void UnbindBuffers() override;
+		virtual void Bind(FramebufferMode mode = FramebufferMode::ReadWrite) override;
+		virtual void Unbind() override;
+		virtual void Attach(FramebufferAttachment type, unsigned int index = 0) override;
+		virtual void Detach(FramebufferAttachment type, unsigned int index = 0) override;
+
+	private:
+		Math::uvec2 m_size;
+	};
+}
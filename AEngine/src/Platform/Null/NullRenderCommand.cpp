@@ -0,0 +1,216 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#include "NullRenderCommand.h"
+
+namespace
+{
+	AEngine::NullRenderStats g_stats;
+	AEngine::NullUniformBinding g_uniformBindings[static_cast<int>(AEngine::UniformBlock::Count)];
+}
+
+namespace AEngine
+{
+	void NullRenderCommand::Clear()
+	{
+		++g_stats.stateChanges;
+	}
+
+	void NullRenderCommand::SetClearColor(const Math::vec4& color)
+	{
+		m_clearColor = color;
+		++g_stats.stateChanges;
+	}
+
+	void NullRenderCommand::EnableDepthTest(bool set)
+	{
+		m_depthTest = set;
+		++g_stats.stateChanges;
+	}
+
+	void NullRenderCommand::SetDepthTestFunction(DepthTestFunction function)
+	{
+		m_depthFunction = function;
+		++g_stats.stateChanges;
+	}
+
+	void NullRenderCommand::EnableBlend(bool set)
+	{
+		m_blend = set;
+		++g_stats.stateChanges;
+	}
+
+	void NullRenderCommand::SetBlendFunction(BlendFunction source, BlendFunction destination)
+	{
+		m_blendSource = source;
+		m_blendDestination = destination;
+		++g_stats.stateChanges;
+	}
+
+	void NullRenderCommand::SetBlendConstant(const Math::vec4& color)
+	{
+		m_blendConstant = color;
+		++g_stats.stateChanges;
+	}
+
+	void NullRenderCommand::EnableFaceCulling(bool set)
+	{
+		m_faceCulling = set;
+		++g_stats.stateChanges;
+	}
+
+	void NullRenderCommand::SetCullFace(PolygonFace face)
+	{
+		m_cullFace = face;
+		++g_stats.stateChanges;
+	}
+
+	void NullRenderCommand::SetFrontFace(Winding direction)
+	{
+		m_frontFace = direction;
+		++g_stats.stateChanges;
+	}
+
+	void NullRenderCommand::SetViewport(int x, int y, int width, int height)
+	{
+		m_viewport = { x, y, width, height };
+		++g_stats.stateChanges;
+	}
+
+//--------------------------------------------------------------------------------
+// Inspection
+//--------------------------------------------------------------------------------
+	bool NullRenderCommand::IsDepthTestEnabled()
+	{
+		return m_depthTest;
+	}
+
+	bool NullRenderCommand::IsBlendEnabled()
+	{
+		return m_blend;
+	}
+
+	bool NullRenderCommand::IsFaceCullingEnabled()
+	{
+		return m_faceCulling;
+	}
+
+	Math::vec4 NullRenderCommand::GetClearColor()
+	{
+		return m_clearColor;
+	}
+
+	DepthTestFunction NullRenderCommand::GetDepthTestFunction()
+	{
+		return m_depthFunction;
+	}
+
+	BlendFunction NullRenderCommand::GetBlendSourceFunction()
+	{
+		return m_blendSource;
+	}
+
+	BlendFunction NullRenderCommand::GetBlendDestinationFunction()
+	{
+		return m_blendDestination;
+	}
+
+	Math::vec4 NullRenderCommand::GetBlendConstant()
+	{
+		return m_blendConstant;
+	}
+
+	PolygonFace NullRenderCommand::GetCullFace()
+	{
+		return m_cullFace;
+	}
+
+	Winding NullRenderCommand::GetFrontFace()
+	{
+		return m_frontFace;
+	}
+
+	PolygonDraw NullRenderCommand::GetPolygonMode(PolygonFace face)
+	{
+		switch (face)
+		{
+		case PolygonFace::Front:
+			return m_frontMode;
+		case PolygonFace::Back:
+			return m_backMode;
+		default:
+			// matches the OpenGL backend, a single mode can't describe both faces
+			return (m_frontMode == m_backMode) ? m_frontMode : PolygonDraw::Invalid;
+		}
+	}
+
+	Math::ivec4 NullRenderCommand::GetViewport()
+	{
+		return m_viewport;
+	}
+
+//--------------------------------------------------------------------------------
+// Drawing
+//--------------------------------------------------------------------------------
+	void NullRenderCommand::PolygonMode(PolygonFace face, PolygonDraw type)
+	{
+		if (face != PolygonFace::Back)
+		{
+			m_frontMode = type;
+		}
+
+		if (face != PolygonFace::Front)
+		{
+			m_backMode = type;
+		}
+
+		++g_stats.stateChanges;
+	}
+
+	void NullRenderCommand::DrawIndexed(Primitive type, Intptr_t count, void* offset, IndexType indexType)
+	{
+		++g_stats.drawCalls;
+		++g_stats.instances;
+		g_stats.elements += static_cast<Size_t>(count);
+	}
+
+	void NullRenderCommand::DrawIndexedInstanced(Primitive type, Intptr_t count, void* offset, Intptr_t instanceCount, IndexType indexType)
+	{
+		++g_stats.drawCalls;
+		g_stats.instances += static_cast<Size_t>(instanceCount);
+		g_stats.elements += static_cast<Size_t>(count * instanceCount);
+	}
+
+	void NullRenderCommand::DrawArrays(Primitive type, int offset, Intptr_t count)
+	{
+		++g_stats.drawCalls;
+		++g_stats.instances;
+		g_stats.elements += static_cast<Size_t>(count);
+	}
+
+	void NullRenderCommand::UnbindTexture()
+	{
+		++g_stats.textureBinds;
+	}
+
+	RenderLibrary NullRenderCommand::GetLibrary()
+	{
+		return RenderLibrary::Null;
+	}
+
+	NullRenderStats& NullRenderCommand::GetStats()
+	{
+		return g_stats;
+	}
+
+	void NullRenderCommand::ResetStats()
+	{
+		g_stats = NullRenderStats();
+	}
+
+	NullUniformBinding& NullRenderCommand::GetUniformBinding(UniformBlock block)
+	{
+		return g_uniformBindings[static_cast<int>(block)];
+	}
+}
@@ -0,0 +1,210 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#pragma once
+#include "AEngine/Render/RenderCommandImpl.h"
+
+namespace AEngine
+{
+		/**
+		 * \struct NullRenderStats
+		 * \brief Work recorded by the null render backend
+		 * \details
+		 * Counts accumulate until NullRenderCommand::ResetStats() is called, so a frame's work
+		 * can be measured by resetting before it and reading after it.
+		*/
+	struct NullRenderStats
+	{
+		Size_t drawCalls = 0;          ///< Draw calls of any kind
+		Size_t instances = 0;          ///< Instances submitted, one per non-instanced draw
+		Size_t elements = 0;           ///< Indices or vertices submitted
+		Size_t shaderBinds = 0;        ///< Shader binds
+		Size_t textureBinds = 0;       ///< Texture binds
+		Size_t vertexArrayBinds = 0;   ///< Vertex array binds
+		Size_t bufferBinds = 0;        ///< Vertex, index and uniform buffer binds
+		Size_t framebufferBinds = 0;   ///< Framebuffer binds
+		Size_t uniformSets = 0;        ///< Individual uniform uploads
+		Size_t stateChanges = 0;       ///< Render state changes, such as blending and depth testing
+		Size_t uploads = 0;            ///< Buffer and texture uploads
+		Size_t bytesUploaded = 0;      ///< Bytes of buffer and texture data uploaded
+	};
+
+	class NullUniformBuffer;
+
+		/**
+		 * \struct NullUniformBinding
+		 * \brief Range of a uniform buffer last bound to a uniform block
+		*/
+	struct NullUniformBinding
+	{
+		const NullUniformBuffer* buffer = nullptr;   ///< Bound buffer, null if none has been bound
+		Intptr_t offset = 0;                         ///< Start of the bound range in bytes
+		Intptr_t bytes = 0;                          ///< Size of the bound range in bytes
+	};
+
+		/**
+		 * \class NullRenderCommand
+		 * \brief Render commands that record work without a graphics context
+		 * \details
+		 * Used to run scenes headless, so the CPU side of a frame can be profiled on machines
+		 * without a display. Render state is kept so inspection returns what was last set.
+		*/
+	class NullRenderCommand : public RenderCommandImpl
+	{
+	public:
+			/**
+			 * \copydoc RenderCommand::Clear
+			*/
+		virtual void Clear() override;
+			/**
+			 * \copydoc RenderCommand::SetClearColor
+			*/
+		virtual void SetClearColor(const Math::vec4& color) override;
+			/**
+			 * \copydoc RenderCommand::EnableDepthTest
+			*/
+		virtual void EnableDepthTest(bool set) override;
+			/**
+			 * \copydoc RenderCommand::SetDepthTestFunction
+			*/
+		virtual void SetDepthTestFunction(DepthTestFunction function) override;
+			/**
+			 * \copydoc RenderCommand::EnableBlend
+			*/
+		virtual void EnableBlend(bool set) override;
+			/**
+			 * \copydoc RenderCommand::SetBlendFunction
+			*/
+		virtual void SetBlendFunction(BlendFunction source, BlendFunction destination) override;
+			/**
+			 * \copydoc RenderCommand::SetBlendConstant
+			*/
+		virtual void SetBlendConstant(const Math::vec4& color) override;
+			/**
+			 * \copydoc RenderCommand::EnableFaceCulling
+			*/
+		virtual void EnableFaceCulling(bool set) override;
+			/**
+			 * \copydoc RenderCommand::SetCullFace
+			*/
+		virtual void SetCullFace(PolygonFace face) override;
+			/**
+			 * \copydoc RenderCommand::SetFrontFace
+			*/
+		virtual void SetFrontFace(Winding direction) override;
+			/**
+			 * \copydoc RenderCommand::SetViewport
+			*/
+		virtual void SetViewport(int x, int y, int width, int height) override;
+
+//--------------------------------------------------------------------------------
+// Inspection
+//--------------------------------------------------------------------------------
+			/**
+			 * \copydoc RenderCommand::IsDepthTestEnabled
+			*/
+		virtual bool IsDepthTestEnabled() override;
+			/**
+			 * \copydoc RenderCommand::IsBlendEnabled
+			*/
+		virtual bool IsBlendEnabled() override;
+			/**
+			 * \copydoc RenderCommand::IsFaceCullingEnabled
+			*/
+		virtual bool IsFaceCullingEnabled() override;
+			/**
+			 * \copydoc RenderCommand::GetClearColor
+			*/
+		virtual Math::vec4 GetClearColor() override;
+			/**
+			 * \copydoc RenderCommand::GetDepthTestFunction
+			*/
+		virtual DepthTestFunction GetDepthTestFunction() override;
+			/**
+			 * \copydoc RenderCommand::GetBlendSourceFunction
+			*/
+		virtual BlendFunction GetBlendSourceFunction() override;
+			/**
+			 * \copydoc RenderCommand::GetBlendDestinationFunction
+			*/
+		virtual BlendFunction GetBlendDestinationFunction() override;
+			/**
+			 * \copydoc RenderCommand::GetBlendConstant
+			*/
+		virtual Math::vec4 GetBlendConstant() override;
+			/**
+			 * \copydoc RenderCommand::GetCullFace
+			*/
+		virtual PolygonFace GetCullFace() override;
+			/**
+			 * \copydoc RenderCommand::GetFrontFace
+			*/
+		virtual Winding GetFrontFace() override;
+			/**
+			 * \copydoc RenderCommand::GetPolygonMode
+			*/
+		virtual PolygonDraw GetPolygonMode(PolygonFace face) override;
+			/**
+			 * \copydoc RenderCommand::GetViewport
+			*/
+		virtual Math::ivec4 GetViewport() override;
+
+//--------------------------------------------------------------------------------
+// Drawing
+//--------------------------------------------------------------------------------
+			/**
+			 * \copydoc RenderCommand::PolygonMode
+			*/
+		virtual void PolygonMode(PolygonFace face, PolygonDraw type) override;
+			/**
+			 * \copydoc RenderCommand::DrawIndexed
+			*/
+		virtual void DrawIndexed(Primitive type, Intptr_t count, void* offset, IndexType indexType) override;
+			/**
+			 * \copydoc RenderCommand::DrawIndexedInstanced
+			*/
+		virtual void DrawIndexedInstanced(Primitive type, Intptr_t count, void* offset, Intptr_t instanceCount, IndexType indexType) override;
+			/**
+			 * \copydoc RenderCommand::DrawArrays
+			*/
+		virtual void DrawArrays(Primitive type, int offset, Intptr_t count) override;
+
+		virtual void UnbindTexture() override;
+			/**
+			 * \copydoc RenderCommand::GetLibrary
+			*/
+		virtual RenderLibrary GetLibrary() override;
+
+			/**
+			 * \brief Returns the work recorded since the last reset
+			 * \return Recorded work, shared by every null render object
+			*/
+		static NullRenderStats& GetStats();
+			/**
+			 * \brief Clears the recorded work
+			*/
+		static void ResetStats();
+			/**
+			 * \brief Returns what is bound to a uniform block
+			 * \param[in] block to inspect
+			 * \return Binding of the block, kept until the next bind or unbind of that block
+			*/
+		static NullUniformBinding& GetUniformBinding(UniformBlock block);
+
+	private:
+		Math::vec4 m_clearColor{ 0.0f };
+		Math::vec4 m_blendConstant{ 0.0f };
+		Math::ivec4 m_viewport{ 0 };
+		bool m_depthTest = false;
+		bool m_blend = false;
+		bool m_faceCulling = false;
+		DepthTestFunction m_depthFunction = DepthTestFunction::Less;
+		BlendFunction m_blendSource = BlendFunction::One;
+		BlendFunction m_blendDestination = BlendFunction::Zero;
+		PolygonFace m_cullFace = PolygonFace::Back;
+		Winding m_frontFace = Winding::CounterClockwise;
+		PolygonDraw m_frontMode = PolygonDraw::Fill;
+		PolygonDraw m_backMode = PolygonDraw::Fill;
+	};
+}
@@ -0,0 +1,127 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#include "NullShader.h"
+#include "AEngine/Core/Logger.h"
+#include "NullRenderCommand.h"
+
+namespace AEngine
+{
+	NullShader::NullShader(const char* shaderSource)
+		: Shader(shaderSource)
+	{
+
+	}
+
+	NullShader::NullShader(const std::string& ident, const std::string& fname)
+		: Shader(ident, fname)
+	{
+		AE_LOG_DEBUG("NullShader::Constructor {}", ident);
+	}
+
+	void NullShader::Bind() const
+	{
+		++NullRenderCommand::GetStats().shaderBinds;
+	}
+
+	void NullShader::Unbind() const
+	{
+
+	}
+
+	void NullShader::RecordUniform()
+	{
+		++NullRenderCommand::GetStats().uniformSets;
+	}
+
+	//--------------------------------------------------------------------------------
+	// Uniforms
+	//--------------------------------------------------------------------------------
+
+	void NullShader::SetUniformInteger(const std::string& name, int value) const
+	{
+		RecordUniform();
+	}
+
+	void NullShader::SetUniformFloat(const std::string& name, float value) const
+	{
+		RecordUniform();
+	}
+
+	void NullShader::SetUniformFloat2(const std::string& name, const Math::vec2& value) const
+	{
+		RecordUniform();
+	}
+
+	void NullShader::SetUniformFloat3(const std::string& name, const Math::vec3& value) const
+	{
+		RecordUniform();
+	}
+
+	void NullShader::SetUniformFloat4(const std::string& name, const Math::vec4& value) const
+	{
+		RecordUniform();
+	}
+
+	void NullShader::SetUniformMat3(const std::string& name, const Math::mat3& matrix) const
+	{
+		RecordUniform();
+	}
+
+	void NullShader::SetUniformMat4(const std::string& name, const Math::mat4& matrix) const
+	{
+		RecordUniform();
+	}
+
+	void NullShader::SetUniformMat4Array(const std::string& name, const Math::mat4* matrices, Size_t count) const
+	{
+		RecordUniform();
+	}
+
+	UniformHandle NullShader::GetUniformHandle(const std::string& name) const
+	{
+		auto it = m_uniformHandles.emplace(name, static_cast<int>(m_uniformHandles.size())).first;
+		return UniformHandle{ it->second };
+	}
+
+	void NullShader::SetUniform(UniformHandle handle, int value) const
+	{
+		RecordUniform();
+	}
+
+	void NullShader::SetUniform(UniformHandle handle, float value) const
+	{
+		RecordUniform();
+	}
+
+	void NullShader::SetUniform(UniformHandle handle, const Math::vec2& value) const
+	{
+		RecordUniform();
+	}
+
+	void NullShader::SetUniform(UniformHandle handle, const Math::vec3& value) const
+	{
+		RecordUniform();
+	}
+
+	void NullShader::SetUniform(UniformHandle handle, const Math::vec4& value) const
+	{
+		RecordUniform();
+	}
+
+	void NullShader::SetUniform(UniformHandle handle, const Math::mat3& matrix) const
+	{
+		RecordUniform();
+	}
+
+	void NullShader::SetUniform(UniformHandle handle, const Math::mat4& matrix) const
+	{
+		RecordUniform();
+	}
+
+	void NullShader::SetUniformMat4Array(UniformHandle handle, const Math::mat4* matrices, Size_t count) const
+	{
+		RecordUniform();
+	}
+}
@@ -0,0 +1,65 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#pragma once
+#include "AEngine/Render/Shader.h"
+#include <string>
+#include <unordered_map>
+
+namespace AEngine
+{
+		/**
+		 * \class NullShader
+		 * \brief Shader that records binds and uniform uploads without compiling a program
+		 * \details
+		 * Every uniform name is treated as active, handles are assigned in the order names are
+		 * first requested.
+		*/
+	class NullShader : public Shader
+	{
+	public:
+		NullShader(const char* shaderSource);
+		NullShader(const std::string& ident, const std::string& fname);
+
+			/**
+			 * \copydoc Shader::Bind
+			*/
+		void Bind() const override;
+			/**
+			 * \copydoc Shader::Unbind
+			*/
+		void Unbind() const override;
+
+		void SetUniformInteger(const std::string& name, int value) const override;
+		void SetUniformFloat(const std::string& name, float value) const override;
+		void SetUniformFloat2(const std::string& name, const Math::vec2& value) const override;
+		void SetUniformFloat3(const std::string& name, const Math::vec3& value) const override;
+		void SetUniformFloat4(const std::string& name, const Math::vec4& value) const override;
+		void SetUniformMat3(const std::string& name, const Math::mat3& matrix) const override;
+		void SetUniformMat4(const std::string& name, const Math::mat4& matrix) const override;
+		void SetUniformMat4Array(const std::string& name, const Math::mat4* matrices, Size_t count) const override;
+
+			/**
+			 * \copydoc Shader::GetUniformHandle
+			*/
+		UniformHandle GetUniformHandle(const std::string& name) const override;
+		void SetUniform(UniformHandle handle, int value) const override;
+		void SetUniform(UniformHandle handle, float value) const override;
+		void SetUniform(UniformHandle handle, const Math::vec2& value) const override;
+		void SetUniform(UniformHandle handle, const Math::vec3& value) const override;
+		void SetUniform(UniformHandle handle, const Math::vec4& value) const override;
+		void SetUniform(UniformHandle handle, const Math::mat3& matrix) const override;
+		void SetUniform(UniformHandle handle, const Math::mat4& matrix) const override;
+		void SetUniformMat4Array(UniformHandle handle, const Math::mat4* matrices, Size_t count) const override;
+
+	private:
+			// uniform name to handle table, grows as names are requested
+		mutable std::unordered_map<std::string, int> m_uniformHandles;
+
+			/**
+			 * \brief Records a single uniform upload
+			*/
+		static void RecordUniform();
+	};
+}
@@ -0,0 +1,90 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#include "NullTexture.h"
+#include "AEngine/Core/Logger.h"
+#include "NullRenderCommand.h"
+
+namespace AEngine
+{
+	NullTexture::NullTexture(const std::string& ident, const std::string& fname)
+		: NullTexture(ident, fname, *Image::Load(fname))
+	{
+
+	}
+
+	NullTexture::NullTexture(const std::string& ident, const std::string& fname, const Image& image)
+		: Texture(ident, fname), m_width(image.GetWidth()), m_height(image.GetHeight()), m_nrChannels(image.GetChannels())
+	{
+		AE_LOG_DEBUG("NullTexture::Constructor");
+		if (!image.IsValid())
+		{
+			AE_LOG_FATAL("NullTexture::Constructor::Failed -> {}", fname);
+		}
+
+		NullRenderStats& stats = NullRenderCommand::GetStats();
+		++stats.uploads;
+		stats.bytesUploaded += image.GetSize();
+	}
+
+	int NullTexture::GetWidth() const
+	{
+		return m_width;
+	}
+
+	int NullTexture::GetHeight() const
+	{
+		return m_height;
+	}
+
+	void NullTexture::Bind(unsigned int unit) const
+	{
+		++NullRenderCommand::GetStats().textureBinds;
+	}
+
+	void NullTexture::Unbind(unsigned int unit) const
+	{
+
+	}
+
+	void NullTexture::SetWrapS(TextureWrapMode mode)
+	{
+
+	}
+
+	void NullTexture::SetWrapT(TextureWrapMode mode)
+	{
+
+	}
+
+	void NullTexture::SetMinFilter(TextureFilter filter)
+	{
+
+	}
+
+	void NullTexture::SetMagFilter(TextureFilter filter)
+	{
+
+	}
+
+	void NullTexture::SetTextureBaseLevel(int baseLevel)
+	{
+
+	}
+
+	void NullTexture::SetTextureMaxLevel(int maxLevel)
+	{
+
+	}
+
+	void NullTexture::SetTextureLODBias(float lodBias)
+	{
+
+	}
+
+	void NullTexture::SetTextureBorderColor(Math::vec4 borderColor)
+	{
+
+	}
+}
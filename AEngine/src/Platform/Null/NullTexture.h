@@ -0,0 +1,44 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#pragma once
+#include "AEngine/Render/Texture.h"
+#include <string>
+
+namespace AEngine
+{
+		/**
+		 * \class NullTexture
+		 * \brief Texture that decodes its image but never uploads it
+		 * \details
+		 * The image is still decoded so the CPU cost of loading a scene is kept,
+		 * the decoded bytes are recorded as an upload and then released.
+		*/
+	class NullTexture : public Texture
+	{
+	public:
+		NullTexture(const std::string& ident, const std::string& fname);
+		NullTexture(const std::string& ident, const std::string& fname, const Image& image);
+
+		void Bind(unsigned int unit = 0) const override;
+		void Unbind(unsigned int unit = 0) const override;
+
+		int GetWidth() const override;
+		int GetHeight() const override;
+
+		virtual void SetWrapS(TextureWrapMode mode) override;
+		virtual void SetWrapT(TextureWrapMode mode) override;
+		virtual void SetMinFilter(TextureFilter filter) override;
+		virtual void SetMagFilter(TextureFilter filter) override;
+		virtual void SetTextureBaseLevel(int baseLevel) override;
+		virtual void SetTextureMaxLevel(int maxLevel) override;
+		virtual void SetTextureLODBias(float lodBias) override;
+		virtual void SetTextureBorderColor(Math::vec4 borderColor) override;
+
+	private:
+		int m_width;
+		int m_height;
+		int m_nrChannels;
+	};
+}
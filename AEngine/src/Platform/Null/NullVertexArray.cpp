@@ -0,0 +1,49 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#include "NullVertexArray.h"
+#include "NullRenderCommand.h"
+
+namespace AEngine
+{
+	void NullVertexArray::Bind() const
+	{
+		++NullRenderCommand::GetStats().vertexArrayBinds;
+	}
+
+	void NullVertexArray::Unbind() const
+	{
+
+	}
+
+	void NullVertexArray::AddVertexBuffer(const SharedPtr<VertexBuffer>& vertexBuffer)
+	{
+		m_vertexBuffers.push_back(vertexBuffer);
+	}
+
+	void NullVertexArray::SetIndexBuffer(const SharedPtr<IndexBuffer>& indexBuffer)
+	{
+		m_indexBuffer = indexBuffer;
+	}
+
+	void NullVertexArray::SetInstanceBuffer(const SharedPtr<VertexBuffer>& instanceBuffer)
+	{
+		m_instanceBuffer = instanceBuffer;
+	}
+
+	const std::vector<SharedPtr<VertexBuffer>>& NullVertexArray::GetVertexBuffers() const
+	{
+		return m_vertexBuffers;
+	}
+
+	const SharedPtr<IndexBuffer>& NullVertexArray::GetIndexBuffer() const
+	{
+		return m_indexBuffer;
+	}
+
+	const SharedPtr<VertexBuffer>& NullVertexArray::GetInstanceBuffer() const
+	{
+		return m_instanceBuffer;
+	}
+}
@@ -0,0 +1,34 @@
+/**
+ * \file
+ * \author Christien Alden (34119981)
+*/
+#pragma once
+#include "AEngine/Core/Types.h"
+#include "AEngine/Render/VertexArray.h"
+#include <vector>
+
+namespace AEngine
+{
+		/**
+		 * \class NullVertexArray
+		 * \brief Vertex array that keeps its buffers and records binds
+		*/
+	class NullVertexArray : public VertexArray
+	{
+	public:
+		void Bind() const override;
+		void Unbind() const override;
+		void AddVertexBuffer(const SharedPtr<VertexBuffer>& vertexBuffer) override;
+		void SetIndexBuffer(const SharedPtr<IndexBuffer>& indexBuffer) override;
+		void SetInstanceBuffer(const SharedPtr<VertexBuffer>& instanceBuffer) override;
+
+		const std::vector<SharedPtr<VertexBuffer>>& GetVertexBuffers() const override;
+		const SharedPtr<IndexBuffer>& GetIndexBuffer() const override;
+		const SharedPtr<VertexBuffer>& GetInstanceBuffer() const override;
+
+	private:
+		std::vector<SharedPtr<VertexBuffer>> m_vertexBuffers;
+		SharedPtr<IndexBuffer> m_indexBuffer;
+		SharedPtr<VertexBuffer> m_instanceBuffer;
+	};
+}
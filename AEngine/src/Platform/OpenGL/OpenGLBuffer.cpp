@@ -111,12 +111,76 @@ namespace AEngine
 	}
 
 	void OpenGLIndexBuffer::SetData(const Uint32* data, Intptr_t count, BufferUsage usage)
+	{
+		Upload(data, count, IndexType::Uint32, usage);
+	}
+
+	void OpenGLIndexBuffer::SetData(const Uint16* data, Intptr_t count, BufferUsage usage)
+	{
+		Upload(data, count, IndexType::Uint16, usage);
+	}
+
+	void OpenGLIndexBuffer::Upload(const void* data, Intptr_t count, IndexType type, BufferUsage usage)
 	{
 		m_count = static_cast<GLsizeiptr>(count);
+		m_indexType = type;
 
 		Bind();
 		GLenum glUsage = g_glBufferUsage[static_cast<int>(usage)];
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, m_count * sizeof(Uint32), data, glUsage);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, m_count * GetIndexSize(type), data, glUsage);
 		Unbind();
 	}
+
+//--------------------------------------------------------------------------------
+// UniformBuffer
+//--------------------------------------------------------------------------------
+	OpenGLUniformBuffer::OpenGLUniformBuffer(UniformBlock block)
+		: UniformBuffer(block), m_id{ 0 }, m_size{ 0 }
+	{
+		glGenBuffers(1, &m_id);
+	}
+
+	OpenGLUniformBuffer::~OpenGLUniformBuffer()
+	{
+		glDeleteBuffers(1, &m_id);
+		m_id = 0;
+		m_size = 0;
+	}
+
+	void OpenGLUniformBuffer::Bind() const
+	{
+		glBindBufferBase(GL_UNIFORM_BUFFER, static_cast<GLuint>(m_block), m_id);
+	}
+
+	void OpenGLUniformBuffer::BindRange(Intptr_t offset, Intptr_t bytes) const
+	{
+		glBindBufferRange(GL_UNIFORM_BUFFER, static_cast<GLuint>(m_block), m_id, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(bytes));
+	}
+
+	void OpenGLUniformBuffer::Unbind() const
+	{
+		glBindBufferBase(GL_UNIFORM_BUFFER, static_cast<GLuint>(m_block), 0);
+	}
+
+	Intptr_t OpenGLUniformBuffer::Size() const
+	{
+		return static_cast<Intptr_t>(m_size);
+	}
+
+	void OpenGLUniformBuffer::SetData(const void* data, Intptr_t bytes, BufferUsage usage)
+	{
+		m_size = static_cast<GLsizeiptr>(bytes);
+
+		glBindBuffer(GL_UNIFORM_BUFFER, m_id);
+		GLenum glUsage = g_glBufferUsage[static_cast<int>(usage)];
+		glBufferData(GL_UNIFORM_BUFFER, m_size, data, glUsage);
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+	}
+
+	void OpenGLUniformBuffer::SetSubData(const void* data, Intptr_t bytes, Intptr_t offset)
+	{
+		glBindBuffer(GL_UNIFORM_BUFFER, m_id);
+		glBufferSubData(GL_UNIFORM_BUFFER, offset, bytes, data);
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+	}
 }
\ No newline at end of file
@@ -70,8 +70,16 @@ namespace AEngine
 			 * \copydoc IndexBuffer::SetData
 			*/
 		virtual void SetData(const Uint32* data, Intptr_t count, BufferUsage usage) override;
+			/**
+			 * \copydoc IndexBuffer::SetData(const Uint16*, Intptr_t, BufferUsage)
+			*/
+		virtual void SetData(const Uint16* data, Intptr_t count, BufferUsage usage) override;
 
 	private:
+			/**
+			 * \brief Uploads indices of the given width
+			*/
+		void Upload(const void* data, Intptr_t count, IndexType type, BufferUsage usage);
 			/**
 			 * \brief The OpenGL handle to the index buffer
 			*/
@@ -81,4 +89,45 @@ namespace AEngine
 			*/
 		GLsizeiptr m_count;
 	};
+
+	class OpenGLUniformBuffer : public UniformBuffer
+	{
+	public:
+		explicit OpenGLUniformBuffer(UniformBlock block);
+		virtual ~OpenGLUniformBuffer();
+			/**
+			 * \copydoc UniformBuffer::Bind
+			*/
+		virtual void Bind() const override;
+			/**
+			 * \copydoc UniformBuffer::BindRange
+			*/
+		virtual void BindRange(Intptr_t offset, Intptr_t bytes) const override;
+			/**
+			 * \copydoc UniformBuffer::Unbind
+			*/
+		virtual void Unbind() const override;
+			/**
+			 * \copydoc UniformBuffer::Size
+			*/
+		virtual Intptr_t Size() const override;
+			/**
+			 * \copydoc UniformBuffer::SetData
+			*/
+		virtual void SetData(const void* data, Intptr_t bytes, BufferUsage usage) override;
+			/**
+			 * \copydoc UniformBuffer::SetSubData
+			*/
+		virtual void SetSubData(const void* data, Intptr_t bytes, Intptr_t offset = 0) override;
+
+	private:
+			/**
+			 * \brief The OpenGL handle to the uniform buffer
+			*/
+		GLuint m_id;
+			/**
+			 * \brief The size of the uniform buffer in bytes
+			*/
+		GLsizeiptr m_size;
+	};
 }
\ No newline at end of file
@@ -43,6 +43,10 @@ namespace
 		GL_TRIANGLES, GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN
 	};
 
+	static constexpr GLenum g_glIndexTypes[] = {
+		GL_UNSIGNED_SHORT, GL_UNSIGNED_INT
+	};
+
 	inline AEngine::BlendFunction GetAEBlendFunction(GLenum func)
 	{
 		switch (func)
@@ -246,10 +250,18 @@ namespace AEngine
 		glPolygonMode(faceEnum, typeEnum);
 	}
 
-	void OpenGLRenderCommand::DrawIndexed(Primitive type, Intptr_t count, void* offset)
+	void OpenGLRenderCommand::DrawIndexed(Primitive type, Intptr_t count, void* offset, IndexType indexType)
+	{
+		GLenum mode = g_glPrimitiveDraws[static_cast<int>(type)];
+		GLenum glIndexType = g_glIndexTypes[static_cast<int>(indexType)];
+		glDrawElements(mode, static_cast<GLsizei>(count), glIndexType, offset);
+	}
+
+	void OpenGLRenderCommand::DrawIndexedInstanced(Primitive type, Intptr_t count, void* offset, Intptr_t instanceCount, IndexType indexType)
 	{
 		GLenum mode = g_glPrimitiveDraws[static_cast<int>(type)];
-		glDrawElements(mode, static_cast<GLsizei>(count), GL_UNSIGNED_INT, offset);
+		GLenum glIndexType = g_glIndexTypes[static_cast<int>(indexType)];
+		glDrawElementsInstanced(mode, static_cast<GLsizei>(count), glIndexType, offset, static_cast<GLsizei>(instanceCount));
 	}
 
 	void OpenGLRenderCommand::DrawArrays(Primitive type, int offset, Intptr_t count)
@@ -122,7 +122,11 @@ namespace AEngine
 			/**
 			 * \copydoc RenderCommandImpl::DrawIndexed
 			*/
-		virtual void DrawIndexed(Primitive type, Intptr_t count, void* offset) override;
+		virtual void DrawIndexed(Primitive type, Intptr_t count, void* offset, IndexType indexType) override;
+			/**
+			 * \copydoc RenderCommandImpl::DrawIndexedInstanced
+			*/
+		virtual void DrawIndexedInstanced(Primitive type, Intptr_t count, void* offset, Intptr_t instanceCount, IndexType indexType) override;
 			/**
 			 * \copydoc RenderCommandImpl::DrawArrays
 			*/
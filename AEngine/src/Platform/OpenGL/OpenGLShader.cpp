@@ -7,6 +7,7 @@
 #include <fstream>
 #include <iostream>
 #include "AEngine/Core/Logger.h"
+#include "AEngine/Render/Buffer.h"
 #include "OpenGLShader.h"
 
 namespace AEngine
@@ -49,44 +50,103 @@ namespace AEngine
 
 	void OpenGLShader::SetUniformInteger(const std::string& name, int value) const
 	{
-		int32_t location = glGetUniformLocation(m_id, name.c_str());
-		glUniform1i(location, value);
+		glUniform1i(GetUniformLocation(name), value);
 	}
 
 	void OpenGLShader::SetUniformFloat(const std::string& name, float value) const
 	{
-	    int32_t location = glGetUniformLocation(m_id, name.c_str());
-	    glUniform1f(location, value);
+		glUniform1f(GetUniformLocation(name), value);
 	}
 
 	void OpenGLShader::SetUniformFloat2(const std::string& name, const Math::vec2& value) const
 	{
-	    int32_t location = glGetUniformLocation(m_id, name.c_str());
-	    glUniform2f(location, value.x, value.y);
+		glUniform2f(GetUniformLocation(name), value.x, value.y);
 	}
 
 	void OpenGLShader::SetUniformFloat3(const std::string& name, const Math::vec3& value) const
 	{
-	    int32_t location = glGetUniformLocation(m_id, name.c_str());
-	    glUniform3f(location, value.x, value.y, value.z);
+		glUniform3f(GetUniformLocation(name), value.x, value.y, value.z);
 	}
 
 	void OpenGLShader::SetUniformFloat4(const std::string& name, const Math::vec4& value) const
 	{
-	    int32_t location = glGetUniformLocation(m_id, name.c_str());
-	    glUniform4f(location, value.x, value.y, value.z, value.w);
+		glUniform4f(GetUniformLocation(name), value.x, value.y, value.z, value.w);
 	}
 
 	void OpenGLShader::SetUniformMat3(const std::string& name, const Math::mat3& matrix) const
 	{
-		int32_t location = glGetUniformLocation(m_id, name.c_str());
-		glUniformMatrix3fv(location, 1, false, Math::value_ptr(matrix));
+		glUniformMatrix3fv(GetUniformLocation(name), 1, false, Math::value_ptr(matrix));
 	}
 
 	void OpenGLShader::SetUniformMat4(const std::string& name, const Math::mat4& matrix) const
 	{
-	    int32_t location = glGetUniformLocation(m_id, name.c_str());
-		glUniformMatrix4fv(location, 1, false, Math::value_ptr(matrix));
+		glUniformMatrix4fv(GetUniformLocation(name), 1, false, Math::value_ptr(matrix));
+	}
+
+	void OpenGLShader::SetUniformMat4Array(const std::string& name, const Math::mat4* matrices, Size_t count) const
+	{
+		// an empty array has no first element to point at
+		if (count == 0)
+		{
+			return;
+		}
+
+		glUniformMatrix4fv(GetUniformLocation(name), static_cast<GLsizei>(count), false, Math::value_ptr(matrices[0]));
+	}
+
+	//--------------------------------------------------------------------------------
+	// Uniform Handles
+	//--------------------------------------------------------------------------------
+
+	UniformHandle OpenGLShader::GetUniformHandle(const std::string& name) const
+	{
+		return UniformHandle{ GetUniformLocation(name) };
+	}
+
+	void OpenGLShader::SetUniform(UniformHandle handle, int value) const
+	{
+		glUniform1i(handle.id, value);
+	}
+
+	void OpenGLShader::SetUniform(UniformHandle handle, float value) const
+	{
+		glUniform1f(handle.id, value);
+	}
+
+	void OpenGLShader::SetUniform(UniformHandle handle, const Math::vec2& value) const
+	{
+		glUniform2f(handle.id, value.x, value.y);
+	}
+
+	void OpenGLShader::SetUniform(UniformHandle handle, const Math::vec3& value) const
+	{
+		glUniform3f(handle.id, value.x, value.y, value.z);
+	}
+
+	void OpenGLShader::SetUniform(UniformHandle handle, const Math::vec4& value) const
+	{
+		glUniform4f(handle.id, value.x, value.y, value.z, value.w);
+	}
+
+	void OpenGLShader::SetUniform(UniformHandle handle, const Math::mat3& matrix) const
+	{
+		glUniformMatrix3fv(handle.id, 1, false, Math::value_ptr(matrix));
+	}
+
+	void OpenGLShader::SetUniform(UniformHandle handle, const Math::mat4& matrix) const
+	{
+		glUniformMatrix4fv(handle.id, 1, false, Math::value_ptr(matrix));
+	}
+
+	void OpenGLShader::SetUniformMat4Array(UniformHandle handle, const Math::mat4* matrices, Size_t count) const
+	{
+		// an empty array has no first element to point at
+		if (count == 0)
+		{
+			return;
+		}
+
+		glUniformMatrix4fv(handle.id, static_cast<GLsizei>(count), false, Math::value_ptr(matrices[0]));
 	}
 
 	//--------------------------------------------------------------------------------
@@ -125,6 +185,79 @@ namespace AEngine
 
 		glDeleteShader(vertId);
 		glDeleteShader(fragId);
+
+		ReflectUniforms();
+		BindUniformBlocks();
+	}
+
+	GLint OpenGLShader::GetUniformLocation(const std::string& name) const
+	{
+		auto it = m_uniformLocations.find(name);
+		if (it != m_uniformLocations.end())
+		{
+			return it->second;
+		}
+
+		// inactive uniforms are silently ignored by glUniform* when given -1
+		return -1;
+	}
+
+	void OpenGLShader::ReflectUniforms()
+	{
+		m_uniformLocations.clear();
+
+		GLint uniformCount = 0;
+		GLint maxNameLength = 0;
+		glGetProgramiv(m_id, GL_ACTIVE_UNIFORMS, &uniformCount);
+		glGetProgramiv(m_id, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+
+		std::string nameBuffer(static_cast<Size_t>(maxNameLength), '\0');
+		for (GLint i = 0; i < uniformCount; ++i)
+		{
+			GLsizei nameLength = 0;
+			GLint arraySize = 0;
+			GLenum type = 0;
+			glGetActiveUniform(m_id, static_cast<GLuint>(i), maxNameLength, &nameLength, &arraySize, &type, &nameBuffer[0]);
+			std::string name = nameBuffer.substr(0, nameLength);
+
+			// uniforms in uniform blocks have no location
+			GLint location = glGetUniformLocation(m_id, name.c_str());
+			if (location < 0)
+			{
+				continue;
+			}
+
+			m_uniformLocations[name] = location;
+
+			// arrays are reported as "name[0]", register the base name and every element
+			Size_t bracket = name.rfind("[0]");
+			if (bracket != std::string::npos && bracket + 3 == name.size())
+			{
+				std::string baseName = name.substr(0, bracket);
+				m_uniformLocations[baseName] = location;
+				for (GLint element = 1; element < arraySize; ++element)
+				{
+					std::string elementName = baseName + "[" + std::to_string(element) + "]";
+					m_uniformLocations[elementName] = glGetUniformLocation(m_id, elementName.c_str());
+				}
+			}
+		}
+
+		AE_LOG_TRACE("OpenGLShader::ReflectUniforms -> {} locations", m_uniformLocations.size());
+	}
+
+	void OpenGLShader::BindUniformBlocks() const
+	{
+		// GLSL 330 cannot declare the binding in source, so link any engine blocks by name
+		for (int i = 0; i < static_cast<int>(UniformBlock::Count); ++i)
+		{
+			const UniformBlock block = static_cast<UniformBlock>(i);
+			GLuint index = glGetUniformBlockIndex(m_id, UniformBuffer::GetBlockName(block));
+			if (index != GL_INVALID_INDEX)
+			{
+				glUniformBlockBinding(m_id, index, static_cast<GLuint>(block));
+			}
+		}
 	}
 
 	//--------------------------------------------------------------------------------
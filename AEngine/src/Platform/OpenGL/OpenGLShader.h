@@ -83,10 +83,78 @@ namespace AEngine
 			 * @retval void
 			**/
 		void SetUniformMat4(const std::string& name, const Math::mat4& matrix) const override;
+			/**
+			 * @brief Upload an array of mat4 uniforms to shader
+			 * @param[in] name of uniform array
+			 * @param[in] matrices to upload
+			 * @param[in] count number of matrices
+			 * @retval void
+			**/
+		void SetUniformMat4Array(const std::string& name, const Math::mat4* matrices, Size_t count) const override;
+
+			/**
+			 * @copydoc Shader::GetUniformHandle
+			**/
+		UniformHandle GetUniformHandle(const std::string& name) const override;
+			/**
+			 * @copydoc Shader::SetUniform(UniformHandle, int) const
+			**/
+		void SetUniform(UniformHandle handle, int value) const override;
+			/**
+			 * @copydoc Shader::SetUniform(UniformHandle, float) const
+			**/
+		void SetUniform(UniformHandle handle, float value) const override;
+			/**
+			 * @copydoc Shader::SetUniform(UniformHandle, const Math::vec2&) const
+			**/
+		void SetUniform(UniformHandle handle, const Math::vec2& value) const override;
+			/**
+			 * @copydoc Shader::SetUniform(UniformHandle, const Math::vec3&) const
+			**/
+		void SetUniform(UniformHandle handle, const Math::vec3& value) const override;
+			/**
+			 * @copydoc Shader::SetUniform(UniformHandle, const Math::vec4&) const
+			**/
+		void SetUniform(UniformHandle handle, const Math::vec4& value) const override;
+			/**
+			 * @copydoc Shader::SetUniform(UniformHandle, const Math::mat3&) const
+			**/
+		void SetUniform(UniformHandle handle, const Math::mat3& matrix) const override;
+			/**
+			 * @copydoc Shader::SetUniform(UniformHandle, const Math::mat4&) const
+			**/
+		void SetUniform(UniformHandle handle, const Math::mat4& matrix) const override;
+			/**
+			 * @copydoc Shader::SetUniformMat4Array(UniformHandle, const Math::mat4*, Size_t) const
+			**/
+		void SetUniformMat4Array(UniformHandle handle, const Math::mat4* matrices, Size_t count) const override;
 
 	private:
 			// OpenGL object handle
 		GLuint m_id = 0;
+			// uniform name to location table, filled when the program is linked
+		std::unordered_map<std::string, GLint> m_uniformLocations;
+
+			/**
+			 * @brief Looks up the location of a uniform in the location table
+			 * @param[in] name of uniform
+			 * @return Location of the uniform or -1 if it is not active
+			**/
+		GLint GetUniformLocation(const std::string& name) const;
+			/**
+			 * @brief Enumerates the active uniforms of the linked program into the location table
+			 * @return void
+			 * @details
+			 * Array uniforms are registered by their base name as well as by each element,
+			 * ie. "u_bones", "u_bones[0]", "u_bones[1]", ...
+			**/
+		void ReflectUniforms();
+			/**
+			 * @brief Links each engine uniform block declared by the program to its binding point
+			 * @return void
+			 * @see UniformBlock
+			**/
+		void BindUniformBlocks() const;
 
 			/**
 			 * @brief Compiles shader program from sources
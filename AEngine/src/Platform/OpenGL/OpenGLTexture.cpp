@@ -23,10 +23,16 @@ namespace
 namespace AEngine
 {
 	OpenGLTexture::OpenGLTexture(const std::string& ident, const std::string& fname)
+		: OpenGLTexture(ident, fname, *Image::Load(fname))
+	{
+
+	}
+
+	OpenGLTexture::OpenGLTexture(const std::string& ident, const std::string& fname, const Image& image)
 		: Texture(ident, fname), m_id(0), m_width(0), m_height(0), m_nrChannels(0)
 	{
 		AE_LOG_DEBUG("OpenGLTexture::Constructor");
-		Generate(fname);
+		Generate(fname, image);
 	}
 
 	OpenGLTexture::~OpenGLTexture()
@@ -59,28 +65,25 @@ namespace AEngine
 		glBindTexture(GL_TEXTURE_2D, 0);
 	}
 
-	void OpenGLTexture::Generate(const std::string& fname)
+	void OpenGLTexture::Generate(const std::string& fname, const Image& image)
 	{
+		if (!image.IsValid())
+		{
+			AE_LOG_FATAL("OpenGLTexture::Generate::Failed -> {}", fname);
+		}
+
 		// generate and bind
 		glGenTextures(1, &m_id);
 		Bind();
 
-		// generate texture
-		unsigned char* data = stbi_load(fname.c_str(), &m_width, &m_height, &m_nrChannels, 0);
-		if (data)
-		{
-			GLenum format = (m_nrChannels == 4) ? GL_RGBA : GL_RGB;
-			
-			glTexImage2D(GL_TEXTURE_2D, 0, format, m_width, m_height, 0, format, GL_UNSIGNED_BYTE, data);
-			glGenerateMipmap(GL_TEXTURE_2D);
-		}
-		else
-		{
-			AE_LOG_FATAL("OpenGLTexture::Generate::Failed -> {}", fname);
-		}
+		// upload the decoded image
+		m_width = image.GetWidth();
+		m_height = image.GetHeight();
+		m_nrChannels = image.GetChannels();
+		GLenum format = (m_nrChannels == 4) ? GL_RGBA : GL_RGB;
 
-		// clean-up
-		stbi_image_free(data);
+		glTexImage2D(GL_TEXTURE_2D, 0, format, m_width, m_height, 0, format, GL_UNSIGNED_BYTE, image.GetData());
+		glGenerateMipmap(GL_TEXTURE_2D);
 		Unbind();
 	}
 
@@ -14,6 +14,7 @@ namespace AEngine
 	{
 	public:
 		OpenGLTexture(const std::string& ident, const std::string& fname);
+		OpenGLTexture(const std::string& ident, const std::string& fname, const Image& image);
 		virtual ~OpenGLTexture();
 
 			/**
@@ -69,6 +70,6 @@ namespace AEngine
 		int m_height;
 		int m_nrChannels;
 
-		void Generate(const std::string& fname);
+		void Generate(const std::string& fname, const Image& image);
 	};
 }
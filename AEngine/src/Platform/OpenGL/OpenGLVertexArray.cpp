@@ -8,19 +8,23 @@
 namespace
 {
 	static constexpr GLenum g_glDataTypes[] = {
-		GL_BYTE,          GL_BYTE,          GL_BYTE, GL_BYTE,                                       // bytes
-		GL_UNSIGNED_BYTE, GL_UNSIGNED_BYTE, GL_UNSIGNED_BYTE, GL_UNSIGNED_BYTE,   // ubytes
-		GL_INT,           GL_INT,           GL_INT, GL_INT,                                           // ints
-		GL_UNSIGNED_INT,  GL_UNSIGNED_INT,  GL_UNSIGNED_INT, GL_UNSIGNED_INT,       // uints
-		GL_FLOAT,         GL_FLOAT,         GL_FLOAT, GL_FLOAT,                                   // floats
-		GL_FLOAT,         GL_FLOAT                                                        // mat3, mat4
+		GL_BYTE,           GL_BYTE,           GL_BYTE,           GL_BYTE,             // bytes
+		GL_UNSIGNED_BYTE,  GL_UNSIGNED_BYTE,  GL_UNSIGNED_BYTE,  GL_UNSIGNED_BYTE,    // ubytes
+		GL_SHORT,          GL_SHORT,          GL_SHORT,          GL_SHORT,            // shorts
+		GL_UNSIGNED_SHORT, GL_UNSIGNED_SHORT, GL_UNSIGNED_SHORT, GL_UNSIGNED_SHORT,   // ushorts
+		GL_INT,            GL_INT,            GL_INT,            GL_INT,              // ints
+		GL_UNSIGNED_INT,   GL_UNSIGNED_INT,   GL_UNSIGNED_INT,   GL_UNSIGNED_INT,     // uints
+		GL_HALF_FLOAT,     GL_HALF_FLOAT,     GL_HALF_FLOAT,     GL_HALF_FLOAT,       // halves
+		GL_FLOAT,          GL_FLOAT,          GL_FLOAT,          GL_FLOAT,            // floats
+		GL_FLOAT,          GL_FLOAT,                                                  // mat3, mat4
+		GL_INT_2_10_10_10_REV                                                         // int 10_10_10_2
 	};
 }
 
 namespace AEngine
 {
 	OpenGLVertexArray::OpenGLVertexArray()
-		: m_id{ 0 }, m_vertexLocationIndex{ 0 }, m_vertexBuffers{}, m_indexBuffer{ nullptr }
+		: m_id{ 0 }, m_vertexLocationIndex{ 0 }, m_vertexBuffers{}, m_indexBuffer{ nullptr }, m_instanceBuffer{ nullptr }
 	{
 		glGenVertexArrays(1, &m_id);
 	}
@@ -31,6 +35,7 @@ namespace AEngine
 		m_id = 0;
 		m_vertexBuffers.clear();
 		m_indexBuffer = nullptr;
+		m_instanceBuffer = nullptr;
 	}
 
 	void OpenGLVertexArray::Bind() const
@@ -51,43 +56,14 @@ namespace AEngine
 
 		// get layout and data
 		const VertexBufferLayout& layout = vertexBuffer->GetLayout();
-		const std::vector<BufferElement> layoutData = layout.GetElements();
-		const Size_t size = layoutData.size();
-		if (size == 0)
+		if (layout.GetElements().empty())
 		{
 			AE_LOG_ERROR("Vertex buffer has no layout!");
 			Unbind();
 			return;
 		}
 
-		for (Size_t i = 0; i < size; ++i)
-		{
-			const BufferElement& data = layoutData[i];
-			glEnableVertexAttribArray(m_vertexLocationIndex);
-			if (data.GetPrecision() == BufferElementPrecision::Integer)
-			{
-				glVertexAttribIPointer(
-					m_vertexLocationIndex,
-					data.GetCount(),
-					g_glDataTypes[static_cast<int>(data.GetType())],
-					static_cast<GLsizei>(layout.GetStride()),
-					(const void*) data.GetOffset()
-				);
-			}
-			else
-			{
-				glVertexAttribPointer(
-					m_vertexLocationIndex,
-					data.GetCount(),
-					g_glDataTypes[static_cast<int>(data.GetType())],
-					data.GetNormalize(),
-					static_cast<GLsizei>(layout.GetStride()),
-					(const void*) data.GetOffset()
-				);
-			}
-
-			++m_vertexLocationIndex;
-		}
+		m_vertexLocationIndex = EnableAttributes(layout, m_vertexLocationIndex, 0);
 
 		Unbind();
 		m_vertexBuffers.push_back(vertexBuffer);
@@ -102,6 +78,29 @@ namespace AEngine
 		m_indexBuffer = indexBuffer;
 	}
 
+	void OpenGLVertexArray::SetInstanceBuffer(const SharedPtr<VertexBuffer>& instanceBuffer)
+	{
+		const VertexBufferLayout& layout = instanceBuffer->GetLayout();
+		if (layout.GetElements().empty())
+		{
+			AE_LOG_ERROR("Instance buffer has no layout!");
+			return;
+		}
+
+		if (m_vertexLocationIndex > InstanceAttributeLocation)
+		{
+			AE_LOG_ERROR("OpenGLVertexArray::SetInstanceBuffer::Error -> Vertex attributes overlap instance attributes");
+			return;
+		}
+
+		Bind();
+		instanceBuffer->Bind();
+		EnableAttributes(layout, InstanceAttributeLocation, 1);
+		Unbind();
+
+		m_instanceBuffer = instanceBuffer;
+	}
+
 	const std::vector<SharedPtr<VertexBuffer>>& OpenGLVertexArray::GetVertexBuffers() const
 	{
 		return m_vertexBuffers;
@@ -111,4 +110,45 @@ namespace AEngine
 	{
 		return m_indexBuffer;
 	}
+
+	const SharedPtr<VertexBuffer>& OpenGLVertexArray::GetInstanceBuffer() const
+	{
+		return m_instanceBuffer;
+	}
+
+	GLuint OpenGLVertexArray::EnableAttributes(const VertexBufferLayout& layout, GLuint location, GLuint divisor)
+	{
+		const GLsizei stride = static_cast<GLsizei>(layout.GetStride());
+		for (const BufferElement& data : layout.GetElements())
+		{
+			const GLenum type = g_glDataTypes[static_cast<int>(data.GetType())];
+
+			// matrices are passed as one attribute per column
+			unsigned int columns = 1;
+			if (data.GetType() == BufferElementType::Mat3) { columns = 3; }
+			if (data.GetType() == BufferElementType::Mat4) { columns = 4; }
+			const GLint columnCount = static_cast<GLint>(data.GetCount() / columns);
+			const Intptr_t columnSize = columnCount * sizeof(float);
+
+			for (unsigned int column = 0; column < columns; ++column)
+			{
+				const void* offset = (const void*) (data.GetOffset() + column * columnSize);
+				glEnableVertexAttribArray(location);
+				// normalized integers are read as floats
+				if (data.GetPrecision() == BufferElementPrecision::Integer && !data.GetNormalize())
+				{
+					glVertexAttribIPointer(location, columnCount, type, stride, offset);
+				}
+				else
+				{
+					glVertexAttribPointer(location, columnCount, type, data.GetNormalize(), stride, offset);
+				}
+
+				glVertexAttribDivisor(location, divisor);
+				++location;
+			}
+		}
+
+		return location;
+	}
 }
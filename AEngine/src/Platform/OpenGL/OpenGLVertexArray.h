@@ -31,6 +31,10 @@ namespace AEngine
 			 * \copydoc VertexArray::SetIndexBuffer
 			*/
 		void SetIndexBuffer(const SharedPtr<IndexBuffer>& indexBuffer) override;
+			/**
+			 * \copydoc VertexArray::SetInstanceBuffer
+			*/
+		void SetInstanceBuffer(const SharedPtr<VertexBuffer>& instanceBuffer) override;
 
 			/**
 			 * \copydoc VertexArray::GetVertexBuffers
@@ -40,6 +44,10 @@ namespace AEngine
 			 * \copydoc VertexArray::GetIndexBuffer
 			*/
 		const SharedPtr<IndexBuffer>& GetIndexBuffer() const override;
+			/**
+			 * \copydoc VertexArray::GetInstanceBuffer
+			*/
+		const SharedPtr<VertexBuffer>& GetInstanceBuffer() const override;
 
 	private:
 			/**
@@ -58,5 +66,19 @@ namespace AEngine
 			 * \brief The index buffer of the vertex array
 			*/
 		SharedPtr<IndexBuffer> m_indexBuffer;
+			/**
+			 * \brief The per-instance vertex buffer of the vertex array
+			*/
+		SharedPtr<VertexBuffer> m_instanceBuffer;
+
+			/**
+			 * \brief Enables and describes the attributes of a vertex buffer layout
+			 * \param[in] layout The layout of the currently bound vertex buffer
+			 * \param[in] location The first attribute location to use
+			 * \param[in] divisor The attribute divisor, 0 for per-vertex and 1 for per-instance
+			 * \return The next free attribute location
+			 * \note The vertex array and vertex buffer must be bound
+			*/
+		static GLuint EnableAttributes(const VertexBufferLayout& layout, GLuint location, GLuint divisor);
 	};
 }
@@ -35,7 +35,14 @@ namespace AEngine
 
 	void ReactCollisionBody::SetTransform(const Math::vec3& position, const Math::quat& orientation)
 	{
+		// bodies at rest are set to the same pose every step, only a real change needs syncing
+		if (position == m_position && orientation == m_orientation)
+		{
+			return;
+		}
+
 		// update member variables
+		m_moved = true;
 		m_position = position;
 		m_orientation = orientation;
 
@@ -53,6 +60,19 @@ namespace AEngine
 		orientation = m_orientation;
 	}
 
+	bool ReactCollisionBody::ReadMovedTransform(Math::vec3& position, Math::quat& orientation)
+	{
+		if (!m_moved)
+		{
+			return false;
+		}
+
+		position = m_position;
+		orientation = m_orientation;
+		m_moved = false;
+		return true;
+	}
+
 	SharedPtr<BoxCollider> ReactCollisionBody::AddBoxCollider(const Math::vec3& size, const Math::vec3& offset, const Math::quat& orientation)
 	{
 		rp3d::PhysicsCommon* common = dynamic_cast<ReactPhysicsAPI&>(PhysicsAPI::Instance()).GetCommon();
@@ -314,6 +334,11 @@ namespace AEngine
 		m_body->GetTransform(position, orientation);
 	}
 
+	bool ReactRigidBody::ReadMovedTransform(Math::vec3& position, Math::quat& orientation)
+	{
+		return m_body->ReadMovedTransform(position, orientation);
+	}
+
 	SharedPtr<BoxCollider> ReactRigidBody::AddBoxCollider(const Math::vec3& size, const Math::vec3& offset, const Math::quat& orientation)
 	{
 		// attach the collider and update the inertia tensor
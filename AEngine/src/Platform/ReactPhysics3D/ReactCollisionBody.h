@@ -64,6 +64,13 @@ namespace AEngine
 			 * \return A pointer to the native ReactPhysics3D CollisionBody object.
 			 */
 		rp3d::CollisionBody* GetNative() const;
+			/**
+			 * \brief Reads the transform if the body has moved since it was last read.
+			 * \param[out] position The output parameter to store the position vector.
+			 * \param[out] orientation The output parameter to store the orientation quaternion.
+			 * \return True if the body moved, the outputs are only written when it did.
+			 */
+		bool ReadMovedTransform(Math::vec3& position, Math::quat& orientation);
 
 	protected:
 		rp3d::CollisionBody* m_body;                  ///< The native ReactPhysics3D CollisionBody object.
@@ -72,6 +79,7 @@ namespace AEngine
 	private:
 		Math::vec3 m_position;                        ///< The position of the collision body.
 		Math::quat m_orientation;                     ///< The orientation of the collision body.
+		bool m_moved{ false };                        ///< Whether the transform changed since it was last read.
 		std::list<SharedPtr<Collider>> m_colliders;   ///< The colliders attached to the collision body.
 	};
 
@@ -241,6 +249,10 @@ namespace AEngine
 			 * \copydoc ReactCollisionBody::RemoveCollider
 			*/
 		virtual void RemoveCollider(Collider* collider) override;
+			/**
+			 * \copydoc ReactCollisionBody::ReadMovedTransform
+			 */
+		bool ReadMovedTransform(Math::vec3& position, Math::quat& orientation);
 
 	private:
 		UniquePtr<ReactCollisionBody> m_body;                ///< The ReactCollisionBody associated with the rigid body.
@@ -353,6 +353,30 @@ namespace AEngine
 		return body;
 	}
 
+	void ReactPhysicsWorld::WriteTransforms(CollisionBody* const* bodies, const Math::vec3* positions, const Math::quat* orientations, Size_t count)
+	{
+		for (Size_t i = 0; i < count; ++i)
+		{
+			bodies[i]->SetTransform(positions[i], orientations[i]);
+		}
+	}
+
+	Size_t ReactPhysicsWorld::ReadTransforms(RigidBody* const* bodies, Size_t count, Uint32* moved, Math::vec3* positions, Math::quat* orientations)
+	{
+		// every rigid body in this world is a ReactRigidBody, so the poses are read without virtual calls
+		Size_t movedCount = 0;
+		for (Size_t i = 0; i < count; ++i)
+		{
+			ReactRigidBody* body = static_cast<ReactRigidBody*>(bodies[i]);
+			if (body->ReadMovedTransform(positions[movedCount], orientations[movedCount]))
+			{
+				moved[movedCount++] = static_cast<Uint32>(i);
+			}
+		}
+
+		return movedCount;
+	}
+
 	void ReactPhysicsWorld::Render(const Math::mat4& projectionView) const
 	{
 		m_renderer->Render(projectionView);
@@ -164,6 +164,14 @@ namespace AEngine
 			 * \return A pointer to the created RigidBody.
 			 */
 		virtual SharedPtr<RigidBody> AddRigidBody(const Math::vec3& position, const Math::quat& orientation) override;
+			/**
+			 * \copydoc PhysicsWorld::WriteTransforms
+			 */
+		virtual void WriteTransforms(CollisionBody* const* bodies, const Math::vec3* positions, const Math::quat* orientations, Size_t count) override;
+			/**
+			 * \copydoc PhysicsWorld::ReadTransforms
+			 */
+		virtual Size_t ReadTransforms(RigidBody* const* bodies, Size_t count, Uint32* moved, Math::vec3* positions, Math::quat* orientations) override;
 			/**
 			 * \brief Renders the world.
 			 *
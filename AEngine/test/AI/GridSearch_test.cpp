@@ -0,0 +1,250 @@
+#include <Catch2/catch_test_macros.hpp>
+#include <Catch2/benchmark/catch_benchmark.hpp>
+#include <Catch2/generators/catch_generators.hpp>
+#include <AEngine/AI/GridSearch.h>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <queue>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace AEngine;
+
+namespace
+{
+    struct TestGrid
+    {
+        Math::ivec2 size;
+        std::vector<Uint8> walkable;
+
+        TestGrid(int width, int height)
+            : size(width, height), walkable(static_cast<Size_t>(width) * height, 1) {}
+
+        Uint8& At(int x, int y)
+        {
+            return walkable[static_cast<Size_t>(x) * size.y + y];
+        }
+
+        // blocks a percentage of the cells at random
+        void Scatter(std::mt19937& random, int blockedPercent)
+        {
+            std::uniform_int_distribution<int> percent(0, 99);
+            for (Uint8& cell : walkable)
+            {
+                cell = percent(random) >= blockedPercent;
+            }
+        }
+
+        // opens a cell and its neighbours, so a query end is not walled in
+        void Open(Math::ivec2 cell)
+        {
+            for (int dx = -1; dx <= 1; ++dx)
+            {
+                for (int dy = -1; dy <= 1; ++dy)
+                {
+                    const int x = cell.x + dx;
+                    const int y = cell.y + dy;
+                    if (x >= 0 && x < size.x && y >= 0 && y < size.y)
+                    {
+                        At(x, y) = 1;
+                    }
+                }
+            }
+        }
+
+        bool Find(Math::ivec2 start, Math::ivec2 end, std::vector<Math::ivec2>& path) const
+        {
+            return GridSearch::FindPath(walkable.data(), size, start, end, path);
+        }
+    };
+
+    Uint32 PathCost(const std::vector<Math::ivec2>& path)
+    {
+        Uint32 cost = 0;
+        for (Size_t i = 1; i < path.size(); ++i)
+        {
+            cost += GridSearch::GetDistance(path[i - 1], path[i]);
+        }
+
+        return cost;
+    }
+
+    bool IsConnected(const TestGrid& grid, const std::vector<Math::ivec2>& path)
+    {
+        for (Size_t i = 0; i < path.size(); ++i)
+        {
+            const Math::ivec2 cell = path[i];
+            if (!grid.walkable[static_cast<Size_t>(cell.x) * grid.size.y + cell.y])
+            {
+                return false;
+            }
+
+            if (i > 0 && (std::abs(cell.x - path[i - 1].x) > 1 || std::abs(cell.y - path[i - 1].y) > 1))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Dijkstra over the same moves, the cost A* must match
+    Uint32 ReferenceCost(const TestGrid& grid, Math::ivec2 start, Math::ivec2 end)
+    {
+        using Entry = std::pair<Uint32, int>;
+        std::vector<Uint32> cost(grid.walkable.size(), UINT32_MAX);
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+        const int startCell = start.x * grid.size.y + start.y;
+        const int endCell = end.x * grid.size.y + end.y;
+        cost[startCell] = 0;
+        open.push({ 0, startCell });
+        while (!open.empty())
+        {
+            const auto [current, cell] = open.top();
+            open.pop();
+            if (cell == endCell)
+            {
+                return current;
+            }
+
+            if (current > cost[cell])
+            {
+                continue;
+            }
+
+            const Math::ivec2 position{ cell / grid.size.y, cell % grid.size.y };
+            for (int dx = -1; dx <= 1; ++dx)
+            {
+                for (int dy = -1; dy <= 1; ++dy)
+                {
+                    const Math::ivec2 next{ position.x + dx, position.y + dy };
+                    if ((dx == 0 && dy == 0) || next.x < 0 || next.x >= grid.size.x || next.y < 0 || next.y >= grid.size.y)
+                    {
+                        continue;
+                    }
+
+                    const int nextCell = next.x * grid.size.y + next.y;
+                    const Uint32 nextCost = current + GridSearch::GetDistance(position, next);
+                    if (grid.walkable[nextCell] && nextCost < cost[nextCell])
+                    {
+                        cost[nextCell] = nextCost;
+                        open.push({ nextCost, nextCell });
+                    }
+                }
+            }
+        }
+
+        return UINT32_MAX;
+    }
+}
+
+TEST_CASE( "Paths on an open grid are straight", "[GridSearch]" ) {
+    TestGrid grid(16, 16);
+    std::vector<Math::ivec2> path;
+
+    REQUIRE( grid.Find({ 0, 0 }, { 5, 5 }, path) );
+    REQUIRE( path.size() == 6 );
+    REQUIRE( PathCost(path) == 70 );
+
+    REQUIRE( grid.Find({ 3, 3 }, { 3, 3 }, path) );
+    REQUIRE( path.size() == 1 );
+}
+
+TEST_CASE( "Paths go around walls", "[GridSearch]" ) {
+    TestGrid grid(10, 10);
+    for (int y = 0; y < 9; ++y)
+    {
+        grid.At(5, y) = 0;
+    }
+
+    std::vector<Math::ivec2> path;
+    REQUIRE( grid.Find({ 0, 0 }, { 9, 0 }, path) );
+    REQUIRE( IsConnected(grid, path) );
+    REQUIRE( path.front().x == 0 );
+    REQUIRE( path.back().x == 9 );
+    REQUIRE( PathCost(path) == ReferenceCost(grid, { 0, 0 }, { 9, 0 }) );
+
+    // closing the gap leaves no path, and no stale path from the last query
+    grid.At(5, 9) = 0;
+    REQUIRE_FALSE( grid.Find({ 0, 0 }, { 9, 0 }, path) );
+    REQUIRE( path.empty() );
+}
+
+TEST_CASE( "Blocked or outside cells have no path", "[GridSearch]" ) {
+    TestGrid grid(8, 8);
+    grid.At(4, 4) = 0;
+    std::vector<Math::ivec2> path;
+
+    REQUIRE_FALSE( grid.Find({ 0, 0 }, { 4, 4 }, path) );
+    REQUIRE_FALSE( grid.Find({ 4, 4 }, { 0, 0 }, path) );
+    REQUIRE_FALSE( grid.Find({ -1, 0 }, { 0, 0 }, path) );
+    REQUIRE_FALSE( grid.Find({ 0, 0 }, { 0, 8 }, path) );
+}
+
+TEST_CASE( "Paths are as cheap as Dijkstra's", "[GridSearch]" ) {
+    std::mt19937 random(7);
+    std::vector<Math::ivec2> path;
+    for (int i = 0; i < 200; ++i)
+    {
+        TestGrid grid(5 + static_cast<int>(random() % 40), 5 + static_cast<int>(random() % 40));
+        grid.Scatter(random, 30);
+        const Math::ivec2 start(static_cast<int>(random() % grid.size.x), static_cast<int>(random() % grid.size.y));
+        const Math::ivec2 end(static_cast<int>(random() % grid.size.x), static_cast<int>(random() % grid.size.y));
+        grid.At(start.x, start.y) = 1;
+        grid.At(end.x, end.y) = 1;
+
+        // queries on differently sized grids share the thread's scratch buffers
+        const Uint32 expected = ReferenceCost(grid, start, end);
+        REQUIRE( grid.Find(start, end, path) == (expected != UINT32_MAX) );
+        if (!path.empty())
+        {
+            REQUIRE( IsConnected(grid, path) );
+            REQUIRE( PathCost(path) == expected );
+        }
+    }
+}
+
+TEST_CASE( "Grid path queries", "[GridSearch][!benchmark]" ) {
+    const int size = GENERATE(256, 1024, 4096);
+    const std::string suffix = " (" + std::to_string(size) + "x" + std::to_string(size) + ")";
+
+    // agents path across a local area, so the queries span at most 128 cells on every grid
+    std::mt19937 random(11);
+    TestGrid grid(size, size);
+    grid.Scatter(random, 20);
+    std::vector<std::pair<Math::ivec2, Math::ivec2>> queries;
+    for (int i = 0; i < 256; ++i)
+    {
+        const int x = static_cast<int>(random() % (size - 128));
+        const int y = static_cast<int>(random() % (size - 128));
+        const Math::ivec2 start(x + static_cast<int>(random() % 128), y + static_cast<int>(random() % 128));
+        const Math::ivec2 end(x + static_cast<int>(random() % 128), y + static_cast<int>(random() % 128));
+        grid.Open(start);
+        grid.Open(end);
+        queries.emplace_back(start, end);
+    }
+
+    std::vector<Math::ivec2> path;
+    grid.Find(queries.front().first, queries.front().second, path);
+
+    Size_t next = 0;
+    BENCHMARK( "A* query" + suffix ) {
+        const auto& [start, end] = queries[next++ % queries.size()];
+        return grid.Find(start, end, path);
+    };
+
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point begin = Clock::now();
+    Size_t found = 0;
+    for (const auto& [start, end] : queries)
+    {
+        found += grid.Find(start, end, path) ? 1 : 0;
+    }
+
+    const double seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+    WARN( "A* queries per second" << suffix << ": " << static_cast<double>(queries.size()) / seconds << ", " << found << " found" );
+}
@@ -0,0 +1,94 @@
+#include <Catch2/catch_test_macros.hpp>
+#include <AEngine/Core/Identifier.h>
+#include <vector>
+
+using namespace AEngine;
+
+TEST_CASE( "Identifier packs index and generation", "[Identifier]" ) {
+    const Uint64 ident = Identifier::Make(42, 7);
+    REQUIRE( Identifier::GetIndex(ident) == 42 );
+    REQUIRE( Identifier::GetGeneration(ident) == 7 );
+    REQUIRE( Identifier::Make(0, 0) != Identifier::Null );
+}
+
+TEST_CASE( "Identifier::Release() recycles the index with a new generation", "[Identifier]" ) {
+    const Uint64 first = Identifier::Generate();
+    REQUIRE( Identifier::IsAlive(first) );
+
+    Identifier::Release(first);
+    REQUIRE_FALSE( Identifier::IsAlive(first) );
+
+    const Uint64 second = Identifier::Generate();
+    REQUIRE( Identifier::GetIndex(second) == Identifier::GetIndex(first) );
+    REQUIRE( Identifier::GetGeneration(second) == Identifier::GetGeneration(first) + 1 );
+    REQUIRE( second != first );
+    REQUIRE( Identifier::IsAlive(second) );
+
+    // releasing a stale identifier must not free the live one
+    Identifier::Release(first);
+    REQUIRE( Identifier::IsAlive(second) );
+
+    Identifier::Release(second);
+}
+
+TEST_CASE( "Identifier::Acquire() restores serialised identifiers", "[Identifier]" ) {
+    const Uint64 live = Identifier::Generate();
+    REQUIRE_FALSE( Identifier::Acquire(live) );
+
+    // claim an index beyond anything generated so far
+    const Uint64 restored = Identifier::Make(Identifier::GetIndex(live) + 16, 3);
+    REQUIRE( Identifier::Acquire(restored) );
+    REQUIRE( Identifier::IsAlive(restored) );
+    REQUIRE_FALSE( Identifier::Acquire(restored) );
+
+    // the skipped indices are handed out before the list grows again
+    const Uint64 next = Identifier::Generate();
+    REQUIRE( Identifier::GetIndex(next) < Identifier::GetIndex(restored) );
+
+    Identifier::Release(next);
+    Identifier::Release(restored);
+    Identifier::Release(live);
+}
+
+TEST_CASE( "Identifier::Acquire() rejects invalid indices", "[Identifier]" ) {
+    REQUIRE_FALSE( Identifier::Acquire(Identifier::Null) );
+    REQUIRE_FALSE( Identifier::Acquire(Identifier::Make(0xFFFFFFFFu, 0)) );
+    REQUIRE_FALSE( Identifier::Acquire(Identifier::Make(0xFFFFFFFEu, 0)) );
+
+    // nothing was grown, the next identifier is still a low index
+    const Uint64 next = Identifier::Generate();
+    REQUIRE( Identifier::GetIndex(next) < Identifier::MaxAcquireGrowth );
+    Identifier::Release(next);
+}
+
+TEST_CASE( "Identifier::Acquire() claims released indices in any order", "[Identifier]" ) {
+    std::vector<Uint64> idents;
+    for (int i = 0; i < 64; ++i)
+    {
+        idents.push_back(Identifier::Generate());
+    }
+
+    for (Uint64 ident : idents)
+    {
+        Identifier::Release(ident);
+    }
+
+    // reload from the middle outwards, as a scene file might
+    for (Size_t i = 0; i < idents.size(); ++i)
+    {
+        const Size_t at = (i * 37) % idents.size();
+        const Uint64 restored = Identifier::Make(Identifier::GetIndex(idents[at]), 9);
+        REQUIRE( Identifier::Acquire(restored) );
+        idents[at] = restored;
+    }
+
+    // every released index was claimed, so a new one is not among them
+    const Uint64 next = Identifier::Generate();
+    for (Uint64 ident : idents)
+    {
+        REQUIRE( Identifier::GetIndex(next) != Identifier::GetIndex(ident) );
+        Identifier::Release(ident);
+    }
+
+    Identifier::Release(next);
+}
@@ -0,0 +1,223 @@
+#include <Catch2/catch_test_macros.hpp>
+#include <Catch2/benchmark/catch_benchmark.hpp>
+#include <AEngine/Core/JobGraph.h>
+#include <AEngine/Core/JobSystem.h>
+#include <AEngine/Core/ScratchArena.h>
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+using namespace AEngine;
+
+TEST_CASE( "JobSystem::ParallelFor() runs every item exactly once", "[JobSystem]" ) {
+    JobSystem& jobs = JobSystem::Instance();
+    jobs.Initialise(3);
+
+    for (Size_t count : { 0, 1, 7, 64, 1000 })
+    {
+        std::vector<std::atomic<int>> hits(count);
+        for (std::atomic<int>& hit : hits)
+        {
+            hit = 0;
+        }
+
+        jobs.ParallelFor(count, 8, [&hits](Size_t begin, Size_t end) {
+            for (Size_t i = begin; i < end; ++i)
+            {
+                ++hits[i];
+            }
+        });
+
+        for (const std::atomic<int>& hit : hits)
+        {
+            REQUIRE( hit == 1 );
+        }
+    }
+
+    jobs.Shutdown();
+    REQUIRE( jobs.GetWorkerCount() == 0 );
+}
+
+TEST_CASE( "JobSystem::ParallelFor() runs on the calling thread without workers", "[JobSystem]" ) {
+    int calls = 0;
+    JobSystem::Instance().ParallelFor(100, 10, [&calls](Size_t begin, Size_t end) {
+        ++calls;
+        REQUIRE( begin == 0 );
+        REQUIRE( end == 100 );
+    });
+
+    REQUIRE( calls == 1 );
+}
+
+TEST_CASE( "JobSystem::Wait() joins jobs that fork their own work", "[JobSystem]" ) {
+    JobSystem& jobs = JobSystem::Instance();
+    jobs.Initialise(3);
+
+    std::atomic<Size_t> sum{ 0 };
+    JobCounter counter;
+    for (Size_t task = 0; task < 16; ++task)
+    {
+        jobs.Run([&jobs, &sum]() {
+            jobs.ParallelFor(1000, 10, [&sum](Size_t begin, Size_t end) {
+                for (Size_t i = begin; i < end; ++i)
+                {
+                    sum += i;
+                }
+            });
+        }, counter);
+    }
+
+    jobs.Wait(counter);
+    REQUIRE( counter.IsDone() );
+    REQUIRE( sum == 16 * (999 * 1000 / 2) );
+    jobs.Shutdown();
+}
+
+TEST_CASE( "JobSystem::ParallelForEach() visits every element of a range", "[JobSystem]" ) {
+    JobSystem& jobs = JobSystem::Instance();
+    jobs.Initialise(3);
+
+    std::vector<int> values(500);
+    std::iota(values.begin(), values.end(), 1);
+    std::atomic<int> sum{ 0 };
+    jobs.ParallelForEach(values, 16, [&sum](int value) { sum += value; });
+
+    REQUIRE( sum == 500 * 501 / 2 );
+    jobs.Shutdown();
+}
+
+TEST_CASE( "JobSystem::ParallelForEach() gathers ranges larger than the scratch arena", "[JobSystem]" ) {
+    JobSystem& jobs = JobSystem::Instance();
+    jobs.Initialise(3);
+
+    // more elements than the calling thread's arena can hold
+    const Size_t count = jobs.GetScratch().GetCapacity() / sizeof(Uint32) + 1000;
+    std::vector<Uint32> values(count, 1);
+    std::atomic<Size_t> sum{ 0 };
+    jobs.ParallelForEach(values, 1024, [&sum](Uint32 value) { sum += value; });
+
+    REQUIRE( sum == count );
+    REQUIRE( jobs.GetScratch().GetMarker() == 0 );
+    jobs.Shutdown();
+}
+
+TEST_CASE( "JobGraph runs stages after their dependencies", "[JobSystem]" ) {
+    JobSystem& jobs = JobSystem::Instance();
+    jobs.Initialise(3);
+
+    // a diamond, the last stage sees the work of both branches
+    std::atomic<int> order{ 0 };
+    int first = -1, left = -1, right = -1, last = -1;
+    JobGraph graph;
+    const JobGraph::Stage a = graph.Add("First", [&]() { first = order++; });
+    const JobGraph::Stage b = graph.Add("Left", [&]() { left = order++; });
+    const JobGraph::Stage c = graph.Add("Right", [&]() { right = order++; });
+    const JobGraph::Stage d = graph.Add("Last", [&]() { last = order++; });
+    graph.Precede(a, b);
+    graph.Precede(a, c);
+    graph.Precede(b, d);
+    graph.Precede(c, d);
+
+    for (int run = 0; run < 100; ++run)
+    {
+        order = 0;
+        graph.Run();
+        REQUIRE( first == 0 );
+        REQUIRE( left > first );
+        REQUIRE( right > first );
+        REQUIRE( last == 3 );
+    }
+
+    REQUIRE( graph.GetTimings().size() == 4 );
+    jobs.Shutdown();
+}
+
+TEST_CASE( "ScratchArena aligns and releases to a marker", "[JobSystem]" ) {
+    ScratchArena arena(1024);
+    arena.Allocate(3, 1);
+    const Size_t marker = arena.GetMarker();
+    {
+        ScratchScope scope(arena);
+        double* values = arena.Allocate<double>(16);
+        REQUIRE( reinterpret_cast<Intptr_t>(values) % alignof(double) == 0 );
+        REQUIRE( arena.GetMarker() > marker );
+    }
+
+    REQUIRE( arena.GetMarker() == marker );
+    REQUIRE( arena.GetPeak() >= 3 + 16 * sizeof(double) );
+}
+
+TEST_CASE( "ScratchArena reports whether an allocation fits", "[JobSystem]" ) {
+    ScratchArena arena(64);
+    REQUIRE( arena.CanAllocate(64, 1) );
+    REQUIRE_FALSE( arena.CanAllocate(65, 1) );
+
+    arena.Allocate(1, 1);
+    REQUIRE( arena.CanAllocate(63, 1) );
+    REQUIRE_FALSE( arena.CanAllocate(64, 1) );
+    REQUIRE_FALSE( arena.CanAllocate(static_cast<Size_t>(-1), 1) );
+
+    // padding for the alignment counts against what is left
+    REQUIRE_FALSE( arena.CanAllocate(63, 8) );
+    REQUIRE( arena.CanAllocate(64 - 8, 8) );
+}
+
+TEST_CASE( "Job scheduling", "[JobSystem][!benchmark]" ) {
+    JobSystem& jobs = JobSystem::Instance();
+    jobs.Initialise(JobSystem::GetDefaultWorkerCount());
+    jobs.ResetStats();
+
+    BENCHMARK( "Fork and join 1000 empty jobs" ) {
+        JobCounter counter;
+        for (int i = 0; i < 1000; ++i)
+        {
+            jobs.Run([]() {}, counter);
+        }
+        jobs.Wait(counter);
+        return counter.IsDone();
+    };
+
+    std::vector<float> values(1 << 20, 1.0f);
+    BENCHMARK( "Parallel for over a million floats" ) {
+        jobs.ParallelFor(values.size(), 4096, [&values](Size_t begin, Size_t end) {
+            for (Size_t i = begin; i < end; ++i)
+            {
+                values[i] = values[i] * 0.5f + 1.0f;
+            }
+        });
+        return values.front();
+    };
+
+    // uneven stages in pairs, idle threads have to steal to stay busy
+    std::vector<std::vector<float>> buffers(8, std::vector<float>(1 << 18, 0.0f));
+    JobGraph graph;
+    JobGraph::Stage previous = graph.Add("Root", []() {});
+    for (int i = 0; i < 8; ++i)
+    {
+        std::vector<float>& buffer = buffers[i];
+        const JobGraph::Stage stage = graph.Add("Stage", [&jobs, &buffer, i]() {
+            jobs.ParallelFor(buffer.size() >> (i % 4), 1024, [&buffer](Size_t begin, Size_t end) {
+                for (Size_t j = begin; j < end; ++j)
+                {
+                    buffer[j] += 1.0f;
+                }
+            });
+        });
+        graph.Precede(previous, stage);
+        if (i % 2 == 1)
+        {
+            previous = stage;
+        }
+    }
+
+    BENCHMARK( "Graph of uneven stages" ) {
+        graph.Run();
+        return buffers.back().front();
+    };
+
+    // contention and utilisation of each thread over the benchmarks above
+    const JobSystem::Stats stats = jobs.GetStats();
+    REQUIRE( stats.threads.size() == jobs.GetWorkerCount() + 1 );
+    jobs.LogReport();
+    jobs.Shutdown();
+}
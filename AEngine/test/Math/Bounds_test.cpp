@@ -0,0 +1,67 @@
+#include <Catch2/catch_test_macros.hpp>
+#include <Catch2/matchers/catch_matchers_floating_point.hpp>
+#include <AEngine/Math/Bounds.h>
+
+using namespace AEngine;
+using namespace Catch::Matchers;
+
+TEST_CASE( "Default AABB is invalid until expanded", "[AABB]" ) {
+    Math::AABB box;
+    REQUIRE_FALSE( box.IsValid() );
+
+    box.Expand(Math::vec3(1.0f, 2.0f, 3.0f));
+    REQUIRE( box.IsValid() );
+
+    box.Expand(Math::vec3(-1.0f, 0.0f, 5.0f));
+    REQUIRE_THAT( box.min.x, WithinRel(-1.0f) );
+    REQUIRE_THAT( box.max.z, WithinRel(5.0f) );
+    REQUIRE_THAT( box.GetCenter().y, WithinRel(1.0f) );
+    REQUIRE_THAT( box.GetExtents().x, WithinRel(1.0f) );
+}
+
+TEST_CASE( "AABB::Expand() ignores invalid boxes", "[AABB]" ) {
+    Math::AABB box{ Math::vec3(-1.0f), Math::vec3(1.0f) };
+    box.Expand(Math::AABB{});
+    REQUIRE_THAT( box.min.x, WithinRel(-1.0f) );
+    REQUIRE_THAT( box.max.x, WithinRel(1.0f) );
+}
+
+TEST_CASE( "AABB::Transform() bounds the transformed box", "[AABB]" ) {
+    const Math::AABB box{ Math::vec3(-1.0f), Math::vec3(1.0f) };
+
+    SECTION( "Translation and scale" ) {
+        Math::mat4 transform = Math::translate(Math::mat4(1.0f), Math::vec3(10.0f, 0.0f, 0.0f));
+        transform = Math::scale(transform, Math::vec3(2.0f));
+        Math::AABB result = box.Transform(transform);
+        REQUIRE_THAT( result.min.x, WithinRel(8.0f) );
+        REQUIRE_THAT( result.max.x, WithinRel(12.0f) );
+        REQUIRE_THAT( result.max.y, WithinRel(2.0f) );
+    }
+
+    SECTION( "Rotation grows the box" ) {
+        Math::mat4 transform = Math::rotate(Math::mat4(1.0f), Math::radians(45.0f), Math::vec3(0.0f, 1.0f, 0.0f));
+        Math::AABB result = box.Transform(transform);
+        REQUIRE_THAT( result.max.x, WithinRel(Math::sqrt(2.0f), 0.0001f) );
+        REQUIRE_THAT( result.max.y, WithinRel(1.0f, 0.0001f) );
+    }
+}
+
+TEST_CASE( "Frustum::Intersects() rejects boxes outside the camera", "[Frustum]" ) {
+    const Math::mat4 projection = Math::perspective(Math::radians(45.0f), 1.0f, 1.0f, 100.0f);
+    const Math::mat4 view = Math::lookAt(Math::vec3(0.0f), Math::vec3(0.0f, 0.0f, -1.0f), Math::vec3(0.0f, 1.0f, 0.0f));
+    const Math::Frustum frustum(projection * view);
+
+    const Math::vec3 halfSize(0.5f);
+    REQUIRE( frustum.Intersects({ Math::vec3(0.0f, 0.0f, -10.0f) - halfSize, Math::vec3(0.0f, 0.0f, -10.0f) + halfSize }) );
+    REQUIRE_FALSE( frustum.Intersects({ Math::vec3(0.0f, 0.0f, 10.0f) - halfSize, Math::vec3(0.0f, 0.0f, 10.0f) + halfSize }) );
+    REQUIRE_FALSE( frustum.Intersects({ Math::vec3(50.0f, 0.0f, -10.0f) - halfSize, Math::vec3(50.0f, 0.0f, -10.0f) + halfSize }) );
+    REQUIRE_FALSE( frustum.Intersects({ Math::vec3(0.0f, 0.0f, -200.0f) - halfSize, Math::vec3(0.0f, 0.0f, -200.0f) + halfSize }) );
+
+    // straddling the near plane is still visible
+    REQUIRE( frustum.Intersects({ Math::vec3(-1.0f, -1.0f, -2.0f), Math::vec3(1.0f, 1.0f, 0.0f) }) );
+}
+
+TEST_CASE( "Default frustum contains everything", "[Frustum]" ) {
+    const Math::Frustum frustum;
+    REQUIRE( frustum.Intersects({ Math::vec3(1000.0f), Math::vec3(1001.0f) }) );
+}
@@ -0,0 +1,51 @@
+#include <Catch2/catch_test_macros.hpp>
+#include <AEngine/Messaging/MessageData.h>
+
+using namespace AEngine;
+
+namespace
+{
+    struct Contact
+    {
+        Uint64 other;
+        float depth;
+    };
+}
+
+TEST_CASE( "MessageData is empty by default", "[MessageData]" ) {
+    MessageData data;
+    REQUIRE( data.IsEmpty() );
+    REQUIRE_FALSE( data.IsTable() );
+    REQUIRE( data.Get<int>() == nullptr );
+    REQUIRE_FALSE( data.GetTable().valid() );
+}
+
+TEST_CASE( "MessageData holds native values by type", "[MessageData]" ) {
+    MessageData data = MessageData::Create(Contact{ 7, 0.25f });
+    REQUIRE_FALSE( data.IsEmpty() );
+    REQUIRE_FALSE( data.IsTable() );
+    REQUIRE( data.Is<Contact>() );
+    REQUIRE( data.Get<Contact>()->other == 7 );
+    REQUIRE( data.Get<Contact>()->depth == 0.25f );
+
+    // a different type with the same size is not a match
+    REQUIRE( data.Get<Uint64>() == nullptr );
+
+    MessageData copy = data;
+    REQUIRE( copy.Get<Contact>()->other == 7 );
+}
+
+TEST_CASE( "MessageData shares Lua tables between copies", "[MessageData]" ) {
+    sol::state lua;
+    sol::table table = lua.create_table();
+    table["value"] = 3;
+
+    MessageData data = table;
+    MessageData copy = data;
+    REQUIRE( data.IsTable() );
+    REQUIRE( copy.GetTable().get<int>("value") == 3 );
+
+    // both copies see changes made through either
+    copy.GetTable()["value"] = 4;
+    REQUIRE( data.GetTable().get<int>("value") == 4 );
+}
@@ -0,0 +1,268 @@
+#include <Catch2/catch_test_macros.hpp>
+#include <Catch2/benchmark/catch_benchmark.hpp>
+#include <Catch2/generators/catch_generators.hpp>
+#include <AEngine/Core/Identifier.h>
+#include <AEngine/Messaging/MessageService.h>
+#include <string>
+#include <vector>
+
+using namespace AEngine;
+
+namespace
+{
+    // the service is a singleton, so every test destroys the agents it creates
+    struct Agents
+    {
+        std::vector<Agent> ids;
+        std::vector<MessageAgent> agents;
+
+        explicit Agents(int count)
+        {
+            ids.reserve(count);
+            agents.reserve(count);
+            for (int i = 0; i < count; ++i)
+            {
+                ids.push_back(Identifier::Generate());
+                agents.push_back(MessageService::CreateAgent(ids.back()));
+            }
+        }
+
+        ~Agents()
+        {
+            for (MessageAgent& agent : agents)
+            {
+                agent.Destroy();
+            }
+
+            // purges the destroyed agents
+            MessageService::DispatchMessages();
+            for (Agent id : ids)
+            {
+                Identifier::Release(id);
+            }
+        }
+    };
+}
+
+TEST_CASE( "Broadcast messages reach every other agent", "[MessageService]" ) {
+    sol::state lua;
+    Agents group(4);
+    int received = 0;
+    for (MessageAgent& agent : group.agents)
+    {
+        agent.RegisterMessageHandler(1, [&](Message) { ++received; });
+    }
+
+    group.agents[0].BroadcastMessage(1, lua.create_table());
+    group.agents[0].BroadcastMessage(2, lua.create_table());
+    MessageService::DispatchMessages();
+    REQUIRE( received == 3 );
+}
+
+TEST_CASE( "Messages keep their sender, receiver and order", "[MessageService]" ) {
+    sol::state lua;
+    Agents group(2);
+    std::vector<int> order;
+    group.agents[1].RegisterMessageHandler(1, [&](Message message) {
+        REQUIRE( message.sender == group.ids[0] );
+        REQUIRE( message.receiver == group.ids[1] );
+        order.push_back(message.payload.GetTable().get<int>("value"));
+    });
+
+    for (int i = 0; i < 3; ++i)
+    {
+        sol::table payload = lua.create_table();
+        payload["value"] = i;
+        group.agents[0].SendMessageToAgent(group.ids[1], 1, payload);
+    }
+
+    MessageService::DispatchMessages();
+    REQUIRE( order == std::vector<int>{ 0, 1, 2 } );
+}
+
+TEST_CASE( "Messages to purged agents are dropped", "[MessageService]" ) {
+    sol::state lua;
+    Agents group(2);
+    int received = 0;
+    group.agents[1].RegisterMessageHandler(1, [&](Message) { ++received; });
+    group.agents[1].Destroy();
+    MessageService::DispatchMessages();
+
+    // the purged slot is reused without inheriting the old handler
+    Agents replacement(1);
+    group.agents[0].BroadcastMessage(1, lua.create_table());
+    MessageService::DispatchMessages();
+    REQUIRE( received == 0 );
+    REQUIRE( replacement.agents[0].GetRegisteredMessageTypes().empty() );
+}
+
+TEST_CASE( "Handler changes and replies made during dispatch apply afterwards", "[MessageService]" ) {
+    sol::state lua;
+    Agents group(2);
+    int received = 0;
+    int replies = 0;
+    MessageAgent& receiver = group.agents[1];
+    receiver.RegisterMessageHandler(1, [&](Message message) {
+        ++received;
+        receiver.UnregisterMessageHandler(1);
+        receiver.SendMessageToAgent(message.sender, 2, message.payload);
+    });
+    group.agents[0].RegisterMessageHandler(2, [&](Message) { ++replies; });
+
+    group.agents[0].SendMessageToAgent(group.ids[1], 1, lua.create_table());
+    group.agents[0].SendMessageToAgent(group.ids[1], 1, lua.create_table());
+    MessageService::DispatchMessages();
+    REQUIRE( received == 2 );
+    REQUIRE( replies == 0 );
+    REQUIRE( receiver.GetRegisteredMessageTypes().empty() );
+
+    MessageService::DispatchMessages();
+    REQUIRE( replies == 2 );
+}
+
+TEST_CASE( "Categories only receive their members' messages", "[MessageService]" ) {
+    sol::state lua;
+    Agents group(3);
+    int received = 0;
+    for (MessageAgent& agent : group.agents)
+    {
+        agent.RegisterMessageHandler(1, [&](Message) { ++received; });
+    }
+
+    group.agents[1].AddToCategory(AgentCategory(5));
+    group.agents[2].AddToCategory(AgentCategorySet{ 5, 6 });
+    group.agents[2].RemoveFromCategory(AgentCategory(5));
+    REQUIRE( group.agents[2].GetRegisteredCategories() == AgentCategorySet{ 6 } );
+
+    group.agents[0].SendMessageToCategory(AgentCategory(5), 1, lua.create_table());
+    MessageService::DispatchMessages();
+    REQUIRE( received == 1 );
+}
+
+TEST_CASE( "Purged agents leave their categories", "[MessageService]" ) {
+    sol::state lua;
+    Agents group(2);
+    group.agents[1].AddToCategory(AgentCategorySet{ 3, 200 });
+    group.agents[1].Destroy();
+    MessageService::DispatchMessages();
+
+    // the new agent takes the purged agent's slot
+    Agents replacement(1);
+    int received = 0;
+    replacement.agents[0].RegisterMessageHandler(1, [&](Message) { ++received; });
+    REQUIRE( replacement.agents[0].GetRegisteredCategories().empty() );
+
+    group.agents[0].SendMessageToCategory(AgentCategorySet{ 3, 200 }, 1, lua.create_table());
+    MessageService::DispatchMessages();
+    REQUIRE( received == 0 );
+
+    replacement.agents[0].AddToCategory(AgentCategory(200));
+    group.agents[0].SendMessageToCategory(AgentCategorySet{ 3, 200 }, 1, lua.create_table());
+    MessageService::DispatchMessages();
+    REQUIRE( received == 1 );
+}
+
+TEST_CASE( "Native payloads are delivered without a Lua state", "[MessageService]" ) {
+    struct Hit
+    {
+        Agent other;
+        float impulse;
+    };
+
+    Agents group(2);
+    float impulse = 0.0f;
+    group.agents[1].RegisterMessageHandler(1, [&](Message message) {
+        REQUIRE_FALSE( message.payload.IsTable() );
+        const Hit* hit = message.payload.Get<Hit>();
+        REQUIRE( hit != nullptr );
+        REQUIRE( hit->other == group.ids[0] );
+        impulse = hit->impulse;
+    });
+
+    group.agents[0].SendMessageToAgent(group.ids[1], 1, MessageData::Create(Hit{ group.ids[0], 2.5f }));
+    MessageService::DispatchMessages();
+    REQUIRE( impulse == 2.5f );
+}
+
+TEST_CASE( "Message service scaling", "[MessageService][!benchmark]" ) {
+    const int count = GENERATE( 100, 1000, 5000 );
+    const std::string suffix = " (" + std::to_string(count) + " agents)";
+
+    sol::state lua;
+    sol::table payload = lua.create_table();
+    Agents group(count);
+    Size_t received = 0;
+    for (MessageAgent& agent : group.agents)
+    {
+        agent.RegisterMessageHandler(1, [&](Message) { ++received; });
+    }
+
+    // a handful of agents broadcast each frame, like a crowd of scripted agents reacting to events
+    constexpr int broadcasters = 16;
+    auto frame = [&](MessageType type) {
+        for (int i = 0; i < broadcasters; ++i)
+        {
+            group.agents[i * count / broadcasters].BroadcastMessage(type, payload);
+        }
+
+        MessageService::DispatchMessages();
+        return received;
+    };
+
+    // nobody handles type 2, so this is the cost of queueing and draining the arena
+    BENCHMARK( "SendMessageToAllAgents, unhandled" + suffix ) {
+        return frame(2);
+    };
+
+    BENCHMARK( "SendMessageToAllAgents and DispatchMessages" + suffix ) {
+        return frame(1);
+    };
+}
+
+TEST_CASE( "Message payload throughput", "[MessageService][!benchmark]" ) {
+    struct Position
+    {
+        float x, y, z;
+    };
+
+    constexpr int count = 1000;
+    constexpr int broadcasters = 16;
+
+    sol::state lua;
+    Agents group(count);
+    float sum = 0.0f;
+    for (MessageAgent& agent : group.agents)
+    {
+        agent.RegisterMessageHandler(1, [&](Message message) {
+            sum += message.payload.GetTable().get<float>("x");
+        });
+        agent.RegisterMessageHandler(2, [&](Message message) {
+            sum += message.payload.Get<Position>()->x;
+        });
+    }
+
+    BENCHMARK( "Lua table payload (1000 agents)" ) {
+        for (int i = 0; i < broadcasters; ++i)
+        {
+            // scripts build a fresh table for each message
+            sol::table payload = lua.create_table();
+            payload["x"] = 1.0f;
+            payload["y"] = 2.0f;
+            payload["z"] = 3.0f;
+            group.agents[i * count / broadcasters].BroadcastMessage(1, payload);
+        }
+
+        MessageService::DispatchMessages();
+        return sum;
+    };
+
+    BENCHMARK( "Native payload (1000 agents)" ) {
+        for (int i = 0; i < broadcasters; ++i)
+        {
+            group.agents[i * count / broadcasters].BroadcastMessage(2, MessageData::Create(Position{ 1.0f, 2.0f, 3.0f }));
+        }
+
+        MessageService::DispatchMessages();
+        return sum;
+    };
+}
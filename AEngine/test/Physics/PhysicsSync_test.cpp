@@ -0,0 +1,184 @@
+#include <Catch2/catch_test_macros.hpp>
+#include <Catch2/benchmark/catch_benchmark.hpp>
+#include <Catch2/generators/catch_generators.hpp>
+#include <AEngine/Physics/Physics.h>
+#include <AEngine/Scene/Components.h>
+#include <string>
+#include <vector>
+
+using namespace AEngine;
+
+namespace
+{
+    struct SyncBatch
+    {
+        std::vector<Uint32> moved;
+        std::vector<Math::vec3> positions;
+        std::vector<Math::quat> orientations;
+
+        explicit SyncBatch(Size_t count)
+            : moved(count), positions(count), orientations(count) {}
+
+        Size_t Read(PhysicsWorld& world, std::vector<RigidBody*>& bodies)
+        {
+            return world.ReadTransforms(bodies.data(), bodies.size(), moved.data(), positions.data(), orientations.data());
+        }
+    };
+
+    bool Near(const Math::vec3& lhs, const Math::vec3& rhs)
+    {
+        return Math::all(Math::lessThan(Math::abs(lhs - rhs), Math::vec3(1e-4f)));
+    }
+}
+
+TEST_CASE( "Only bodies the simulation moved are read back", "[PhysicsSync]" ) {
+    UniquePtr<PhysicsWorld> world = PhysicsAPI::Instance().CreateWorld();
+    const Math::quat identity{ Math::vec3(0.0f) };
+
+    SharedPtr<RigidBody> falling = world->AddRigidBody(Math::vec3(0.0f, 10.0f, 0.0f), identity);
+    falling->SetHasGravity(true);
+    SharedPtr<RigidBody> fixed = world->AddRigidBody(Math::vec3(5.0f, 0.0f, 0.0f), identity);
+    fixed->SetType(RigidBody::Type::Static);
+    SharedPtr<RigidBody> resting = world->AddRigidBody(Math::vec3(-5.0f, 0.0f, 0.0f), identity);
+
+    std::vector<RigidBody*> bodies{ fixed.get(), falling.get(), resting.get() };
+    SyncBatch batch(bodies.size());
+
+    // bodies start where they were created, so there is nothing to sync
+    REQUIRE( batch.Read(*world, bodies) == 0 );
+
+    world->OnUpdate(world->GetProps().updateStep);
+    REQUIRE( batch.Read(*world, bodies) == 1 );
+    REQUIRE( batch.moved[0] == 1 );
+    REQUIRE( batch.positions[0].y < 10.0f );
+
+    // reading clears the moved state
+    REQUIRE( batch.Read(*world, bodies) == 0 );
+}
+
+TEST_CASE( "Written transforms move their bodies", "[PhysicsSync]" ) {
+    UniquePtr<PhysicsWorld> world = PhysicsAPI::Instance().CreateWorld();
+    const Math::quat identity{ Math::vec3(0.0f) };
+
+    SharedPtr<RigidBody> first = world->AddRigidBody(Math::vec3(0.0f), identity);
+    SharedPtr<RigidBody> second = world->AddRigidBody(Math::vec3(0.0f), identity);
+    SharedPtr<CollisionBody> trigger = world->AddCollisionBody(Math::vec3(0.0f), identity);
+
+    CollisionBody* written[] = { second.get(), trigger.get() };
+    const Math::vec3 positions[] = { Math::vec3(1.0f, 2.0f, 3.0f), Math::vec3(4.0f, 5.0f, 6.0f) };
+    const Math::quat orientations[] = { identity, Math::angleAxis(Math::radians(90.0f), Math::vec3(0.0f, 1.0f, 0.0f)) };
+    world->WriteTransforms(written, positions, orientations, 2);
+
+    Math::vec3 position;
+    Math::quat orientation;
+    trigger->GetTransform(position, orientation);
+    REQUIRE( position == positions[1] );
+    REQUIRE( orientation == orientations[1] );
+
+    // a body written with its current pose has not moved
+    world->WriteTransforms(written, positions, orientations, 2);
+
+    std::vector<RigidBody*> bodies{ first.get(), second.get() };
+    SyncBatch batch(bodies.size());
+    REQUIRE( batch.Read(*world, bodies) == 1 );
+    REQUIRE( batch.moved[0] == 1 );
+    REQUIRE( batch.positions[0] == positions[0] );
+}
+
+TEST_CASE( "Simulated child bodies keep their world position", "[PhysicsSync]" ) {
+    UniquePtr<PhysicsWorld> world = PhysicsAPI::Instance().CreateWorld();
+
+    // the scene graph, a rotated and scaled root with a child off to one side
+    TransformComponent rootLocal, childLocal;
+    rootLocal.translation = { 0.0f, 5.0f, 0.0f };
+    rootLocal.orientation = Math::angleAxis(Math::radians(90.0f), Math::vec3(0.0f, 1.0f, 0.0f));
+    rootLocal.scale = Math::vec3(2.0f);
+    childLocal.translation = { 1.0f, 0.0f, 0.0f };
+    WorldTransformComponent rootWorld, childWorld;
+    rootWorld.Update(rootLocal, nullptr);
+    childWorld.Update(childLocal, &rootWorld);
+
+    SharedPtr<RigidBody> root = world->AddRigidBody(rootWorld.GetTranslation(), rootWorld.GetOrientation());
+    SharedPtr<RigidBody> child = world->AddRigidBody(childWorld.GetTranslation(), childWorld.GetOrientation());
+    child->SetHasGravity(true);
+    const float startHeight = childWorld.GetTranslation().y;
+
+    std::vector<RigidBody*> bodies{ root.get(), child.get() };
+    SyncBatch batch(bodies.size());
+
+    SECTION( "Only the child moves" ) {
+        root->SetType(RigidBody::Type::Static);
+        world->OnUpdate(world->GetProps().updateStep);
+        REQUIRE( batch.Read(*world, bodies) == 1 );
+        REQUIRE( batch.moved[0] == 1 );
+
+        rootWorld.ToLocal(batch.positions[0], batch.orientations[0], childLocal);
+        childWorld.Update(childLocal, &rootWorld);
+        REQUIRE( Near(childWorld.GetTranslation(), batch.positions[0]) );
+        REQUIRE( childWorld.GetTranslation().y < startHeight );
+    }
+
+    SECTION( "The parent moves in the same step" ) {
+        root->SetHasGravity(true);
+        world->OnUpdate(world->GetProps().updateStep);
+        REQUIRE( batch.Read(*world, bodies) == 2 );
+
+        // parents are written and rebuilt before their children are moved into their space
+        rootLocal.translation = batch.positions[0];
+        rootLocal.orientation = batch.orientations[0];
+        rootWorld.Update(rootLocal, nullptr);
+        rootWorld.ToLocal(batch.positions[1], batch.orientations[1], childLocal);
+        childWorld.Update(childLocal, &rootWorld);
+        REQUIRE( Near(childWorld.GetTranslation(), batch.positions[1]) );
+        REQUIRE( childWorld.GetTranslation().y < startHeight );
+    }
+}
+
+TEST_CASE( "Physics transform sync", "[PhysicsSync][!benchmark]" ) {
+    const Size_t count = GENERATE(Size_t{ 1000 }, Size_t{ 10000 });
+    const std::string suffix = " (" + std::to_string(count) + " bodies)";
+
+    UniquePtr<PhysicsWorld> world = PhysicsAPI::Instance().CreateWorld();
+    const Math::quat identity{ Math::vec3(0.0f) };
+    std::vector<SharedPtr<RigidBody>> owners;
+    std::vector<RigidBody*> bodies;
+    std::vector<CollisionBody*> written;
+    std::vector<Math::vec3> targets(count);
+    std::vector<Math::quat> targetOrientations(count, identity);
+    for (Size_t i = 0; i < count; ++i)
+    {
+        owners.push_back(world->AddRigidBody(Math::vec3(static_cast<float>(i), 0.0f, 0.0f), identity));
+        bodies.push_back(owners.back().get());
+        written.push_back(owners.back().get());
+    }
+
+    // the old sync fetched every body through its virtual interface, moved or not
+    std::vector<Math::vec3> positions(count);
+    std::vector<Math::quat> orientations(count);
+    BENCHMARK( "Per body GetTransform" + suffix ) {
+        for (Size_t i = 0; i < count; ++i)
+        {
+            bodies[i]->GetTransform(positions[i], orientations[i]);
+        }
+        return positions.back().x;
+    };
+
+    SyncBatch batch(count);
+    BENCHMARK( "Batched read, all at rest" + suffix ) {
+        return batch.Read(*world, bodies);
+    };
+
+    // a busy frame, a tenth of the bodies move
+    float offset = 0.0f;
+    BENCHMARK( "Batched write and read, 10% moving" + suffix ) {
+        offset += 1.0f;
+        const Size_t moving = count / 10;
+        for (Size_t i = 0; i < moving; ++i)
+        {
+            targets[i] = Math::vec3(static_cast<float>(i), offset, 0.0f);
+        }
+
+        world->WriteTransforms(written.data(), targets.data(), targetOrientations.data(), moving);
+        return batch.Read(*world, bodies);
+    };
+}
@@ -0,0 +1,513 @@
+#include <Catch2/catch_test_macros.hpp>
+#include <Catch2/benchmark/catch_benchmark.hpp>
+#include <Catch2/generators/catch_generators.hpp>
+#include <AEngine/Core/JobSystem.h>
+#include <AEngine/Render/AnimationScheduler.h>
+#include <AEngine/Render/Animator.h>
+#include <AEngine/Render/RenderCommand.h>
+#include <Platform/Null/NullBuffer.h>
+#include <Platform/Null/NullRenderCommand.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace AEngine;
+
+namespace
+{
+    // counter of the innermost AllocationCounter alive on this thread, null if none
+    thread_local Size_t* g_allocations = nullptr;
+
+    // counts the heap allocations made by this thread while it is alive, so the replaced
+    // operator new below is a plain malloc for every other test in the binary
+    class AllocationCounter
+    {
+    public:
+        AllocationCounter()
+            : m_previous{ g_allocations }
+        {
+            g_allocations = &m_count;
+        }
+
+        ~AllocationCounter()
+        {
+            g_allocations = m_previous;
+        }
+
+        AllocationCounter(const AllocationCounter&) = delete;
+        AllocationCounter& operator=(const AllocationCounter&) = delete;
+
+        Size_t GetCount() const
+        {
+            return m_count;
+        }
+
+    private:
+        Size_t m_count = 0;
+        Size_t* m_previous;
+    };
+}
+
+void* operator new(std::size_t size)
+{
+    if (g_allocations)
+    {
+        ++*g_allocations;
+    }
+
+    if (void* memory = std::malloc(size > 0 ? size : 1))
+    {
+        return memory;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+namespace
+{
+    class TestBone : public Bone
+    {
+    public:
+        TestBone(const std::string& name, int keys, float phase)
+        {
+            m_name = name;
+            for (int i = 0; i < keys; ++i)
+            {
+                const float time = static_cast<float>(i);
+                m_positions.push_back({ Math::vec3(0.0f, 1.0f, 0.1f * time), time });
+                m_rotations.push_back({ Math::angleAxis(0.05f * time + phase, Math::vec3(0.0f, 0.0f, 1.0f)), time });
+                m_scales.push_back({ Math::vec3(1.0f), time });
+            }
+        }
+    };
+
+    // a chain of bones under an unanimated root, every second bone branches to a leaf that
+    // is not animated but skins vertices
+    class TestAnimation : public Animation
+    {
+    public:
+        explicit TestAnimation(int chain, float phase = 0.0f)
+            : Animation("Test", "Test")
+        {
+            m_name = "Test";
+            m_duration = 63.0f;
+            m_ticksPerSecond = 30.0f;
+
+            m_RootNode = { Math::translate(Math::mat4(1.0f), Math::vec3(0.0f, 0.0f, 2.0f)), "Root", 0, {} };
+            SceneNode* parent = &m_RootNode;
+            for (int i = 0; i < chain; ++i)
+            {
+                const std::string name = "Bone" + std::to_string(i);
+                m_bones.push_back(MakeShared<TestBone>(name, 64, 0.1f * i + phase));
+                m_BoneInfoMap[name] = { static_cast<int>(m_BoneInfoMap.size()), Math::translate(Math::mat4(1.0f), Math::vec3(0.0f, -1.0f, 0.0f)) };
+
+                parent->children.push_back({ Math::mat4(1.0f), name, 0, {} });
+                if (i % 2 == 1)
+                {
+                    const std::string leaf = "Leaf" + std::to_string(i);
+                    m_BoneInfoMap[leaf] = { static_cast<int>(m_BoneInfoMap.size()), Math::mat4(1.0f) };
+                    parent->children.push_back({ Math::scale(Math::mat4(1.0f), Math::vec3(2.0f)), leaf, 0, {} });
+                }
+
+                parent->numChildren = static_cast<int>(parent->children.size());
+                parent = &parent->children.front();
+            }
+
+            BuildSkeleton();
+        }
+
+        // the previous implementation, a recursive walk with name lookups
+        void Reference(const SceneNode& node, const Math::mat4& parentTransform, float time, std::vector<Math::mat4>& matrices) const
+        {
+            Math::mat4 nodeTransform = node.transformation;
+            for (const SharedPtr<Bone>& bone : m_bones)
+            {
+                if (bone->GetBoneName() == node.name)
+                {
+                    nodeTransform = bone->GetLocalTransform(time);
+                }
+            }
+
+            const Math::mat4 globalTransform = parentTransform * nodeTransform;
+            auto info = m_BoneInfoMap.find(node.name);
+            if (info != m_BoneInfoMap.end())
+            {
+                matrices[info->second.id] = globalTransform * info->second.offset;
+            }
+
+            for (const SceneNode& child : node.children)
+            {
+                Reference(child, globalTransform, time, matrices);
+            }
+        }
+    };
+
+    bool Near(const std::vector<Math::mat4>& a, const std::vector<Math::mat4>& b)
+    {
+        for (Size_t i = 0; i < a.size(); ++i)
+        {
+            for (int column = 0; column < 4; ++column)
+            {
+                for (int row = 0; row < 4; ++row)
+                {
+                    if (Math::abs(a[i][column][row] - b[i][column][row]) > 1e-3f)
+                    {
+                        return false;
+                    }
+                }
+            }
+        }
+
+        return true;
+    }
+}
+
+TEST_CASE( "Skeleton lists parents before their children", "[Animator]" ) {
+    TestAnimation animation(6);
+    const std::vector<SkeletonNode>& skeleton = animation.GetSkeleton();
+    REQUIRE( skeleton.size() == 1 + 6 + 3 );
+    REQUIRE( skeleton[0].parent == -1 );
+    REQUIRE( skeleton[0].bone == nullptr );
+    for (Size_t i = 1; i < skeleton.size(); ++i)
+    {
+        REQUIRE( skeleton[i].parent >= 0 );
+        REQUIRE( skeleton[i].parent < static_cast<int>(i) );
+        REQUIRE( skeleton[i].boneId >= 0 );
+    }
+}
+
+TEST_CASE( "Animator pose matches the recursive evaluation", "[Animator]" ) {
+    TestAnimation animation(8);
+    Animator animator(animation);
+
+    for (int frame = 0; frame < 200; ++frame)
+    {
+        animator.UpdateAnimation(1.0f / 60.0f);
+        std::vector<Math::mat4> expected(100, Math::mat4(1.0f));
+        animation.Reference(animation.GetRoot(), Math::mat4(1.0f), animator.GetTime(), expected);
+        REQUIRE( Near(animator.GetFinalBoneMatrices(), expected) );
+    }
+}
+
+TEST_CASE( "AnimationScheduler shares poses and defers distant animators", "[Animator]" ) {
+    TestAnimation animation(4);
+    Animator nearA(animation);
+    Animator nearB(animation);
+    Animator far(animation);
+    Animator hidden(animation);
+
+    AnimationScheduler scheduler;
+    AnimationScheduler::Settings& settings = scheduler.GetSettings();
+    settings.farInterval = 4;
+
+    Uint32 farEvaluations = 0;
+    for (int frame = 0; frame < 8; ++frame)
+    {
+        scheduler.Clear();
+        scheduler.Submit(nearA, 1.0f, true, 0);
+        scheduler.Submit(nearB, 2.0f, true, 1);
+        scheduler.Submit(far, 100.0f, true, 0);
+        scheduler.Submit(hidden, 1.0f, false, 0);
+        scheduler.Update(1.0f / 60.0f);
+
+        const AnimationScheduler::Stats& stats = scheduler.GetStats();
+        REQUIRE( stats.animators == 4 );
+        REQUIRE( stats.shared >= 1 );   // nearA and nearB are at the same time
+        farEvaluations += stats.evaluated + stats.shared - 2;
+
+        // every animator keeps time, evaluated or not
+        REQUIRE( far.GetTime() == nearA.GetTime() );
+        REQUIRE( hidden.GetTime() == nearA.GetTime() );
+        REQUIRE_FALSE( hidden.HasPose() );
+        REQUIRE( Near(nearB.GetFinalBoneMatrices(), nearA.GetFinalBoneMatrices()) );
+    }
+
+    // evaluated on the first frame, then every fourth frame
+    REQUIRE( farEvaluations == 1 + 2 );
+}
+
+TEST_CASE( "AnimationScheduler shares poses by the animation that poses the skeleton", "[Animator]" ) {
+    constexpr float dt = 1.0f / 60.0f;
+    TestAnimation walk(6);
+    TestAnimation run(6, 1.0f);
+
+    // the blend space reports walk as its animation, but only run is weighted
+    Animator blended(walk);
+    const BlendPoint points[] = { { &walk, 0.0f }, { &run, 1.0f } };
+    blended.SetBlendSpace(points, 2, 0.0f);
+    blended.SetBlendParameter(1.0f);
+    Animator walking(walk);
+    Animator running(run);
+
+    AnimationScheduler scheduler;
+    scheduler.Submit(blended, 1.0f, true, 0);
+    scheduler.Submit(walking, 1.0f, true, 0);
+    scheduler.Update(dt);
+    running.UpdateAnimation(dt);
+
+    REQUIRE( scheduler.GetStats().shared == 0 );
+    REQUIRE( Near(blended.GetFinalBoneMatrices(), running.GetFinalBoneMatrices()) );
+    REQUIRE_FALSE( Near(walking.GetFinalBoneMatrices(), running.GetFinalBoneMatrices()) );
+}
+
+TEST_CASE( "AnimationScheduler gathers visible poses into the palette", "[Animator]" ) {
+    TestAnimation animation(4);
+    std::vector<Animator> animators(64, Animator(animation));
+    for (Size_t i = 0; i < animators.size(); ++i)
+    {
+        animators[i].Advance(0.01f * i);
+    }
+
+    JobSystem::Instance().Initialise(3);
+    AnimationScheduler scheduler;
+    std::vector<Uint32> slots;
+    for (Size_t i = 0; i < animators.size(); ++i)
+    {
+        slots.push_back(scheduler.Submit(animators[i], 1.0f, i % 4 != 0, static_cast<Uint32>(i)));
+    }
+    scheduler.Update(1.0f / 60.0f);
+    JobSystem::Instance().Shutdown();
+
+    Uint32 expectedSlot = 0;
+    for (Size_t i = 0; i < animators.size(); ++i)
+    {
+        if (i % 4 == 0)
+        {
+            REQUIRE( slots[i] == AnimationScheduler::InvalidSlot );
+            continue;
+        }
+
+        // slots are handed out densely in submission order
+        REQUIRE( slots[i] == expectedSlot++ );
+        const std::vector<Math::mat4>& pose = animators[i].GetFinalBoneMatrices();
+        const std::vector<Math::mat4> palette(scheduler.GetPalette(slots[i]), scheduler.GetPalette(slots[i]) + Animator::MaxBones);
+        REQUIRE( Near(palette, pose) );
+    }
+}
+
+TEST_CASE( "AnimationScheduler binds each slot at its own palette offset", "[Animator]" ) {
+    RenderCommand::Initialise(RenderLibrary::Null);
+    TestAnimation animation(4);
+    std::vector<Animator> animators(3, Animator(animation));
+    for (Size_t i = 0; i < animators.size(); ++i)
+    {
+        animators[i].Advance(0.1f * i);
+    }
+
+    AnimationScheduler scheduler;
+    std::vector<Uint32> slots;
+    for (Animator& animator : animators)
+    {
+        slots.push_back(scheduler.Submit(animator, 1.0f, true, 0));
+    }
+    scheduler.Update(1.0f / 60.0f);
+
+    scheduler.UploadPalette();
+
+    constexpr Intptr_t slotBytes = Animator::MaxBones * sizeof(Math::mat4);
+    const NullUniformBinding& binding = NullRenderCommand::GetUniformBinding(UniformBlock::Skeleton);
+    for (Size_t i = 0; i < slots.size(); ++i)
+    {
+        scheduler.BindPalette(slots[i]);
+        REQUIRE( binding.buffer != nullptr );
+        REQUIRE( binding.offset == static_cast<Intptr_t>(slots[i]) * slotBytes );
+        REQUIRE( binding.bytes == slotBytes );
+        REQUIRE( binding.offset % 256 == 0 );
+
+        // the bound range holds this animator's pose
+        std::vector<Math::mat4> bound(Animator::MaxBones);
+        std::memcpy(bound.data(), binding.buffer->GetData() + binding.offset, slotBytes);
+        REQUIRE( Near(bound, animators[i].GetFinalBoneMatrices()) );
+    }
+}
+
+TEST_CASE( "Animator crossfades from the old pose to the new one", "[Animator]" ) {
+    constexpr float dt = 1.0f / 60.0f;
+    TestAnimation walk(6);
+    TestAnimation run(6, 1.0f);
+    Animator animator(walk);
+    Animator walking(walk);
+    for (int frame = 0; frame < 10; ++frame)
+    {
+        animator.UpdateAnimation(dt);
+        walking.UpdateAnimation(dt);
+    }
+
+    animator.CrossFade(run, 0.5f);
+    animator.Evaluate();
+    REQUIRE( animator.GetAnimation() == &run );
+    REQUIRE( Near(animator.GetFinalBoneMatrices(), walking.GetFinalBoneMatrices()) );
+
+    Animator running(run);
+    for (int frame = 0; frame < 40; ++frame)
+    {
+        animator.UpdateAnimation(dt);
+        running.UpdateAnimation(dt);
+        if (frame == 10)
+        {
+            REQUIRE( animator.IsBlending() );
+        }
+    }
+
+    REQUIRE_FALSE( animator.IsBlending() );
+    REQUIRE( animator.GetTime() == running.GetTime() );
+    REQUIRE( Near(animator.GetFinalBoneMatrices(), running.GetFinalBoneMatrices()) );
+}
+
+TEST_CASE( "Animator blend space plays the animation at the parameter", "[Animator]" ) {
+    constexpr float dt = 1.0f / 60.0f;
+    TestAnimation walk(6);
+    TestAnimation run(6, 1.0f);
+    Animator animator(walk);
+    const BlendPoint points[] = { { &walk, 0.0f }, { &run, 1.0f } };
+    animator.SetBlendSpace(points, 2, 0.0f);
+
+    animator.SetBlendParameter(0.5f);
+    animator.UpdateAnimation(dt);
+    REQUIRE( animator.IsBlending() );
+
+    Animator running(run);
+    running.UpdateAnimation(dt);
+    animator.SetBlendParameter(2.0f);
+    for (int frame = 0; frame < 20; ++frame)
+    {
+        animator.UpdateAnimation(dt);
+        running.UpdateAnimation(dt);
+    }
+
+    REQUIRE_FALSE( animator.IsBlending() );
+    REQUIRE( Near(animator.GetFinalBoneMatrices(), running.GetFinalBoneMatrices()) );
+}
+
+TEST_CASE( "Animator layers add the difference from their first frame", "[Animator]" ) {
+    TestAnimation walk(6);
+    TestAnimation wave(6, 1.0f);
+    Animator animator(walk);
+    animator.UpdateAnimation(0.5f);
+    const std::vector<Math::mat4> base = animator.GetFinalBoneMatrices();
+
+    const int layer = animator.AddLayer(wave, 1.0f);
+    REQUIRE( layer >= 0 );
+    animator.Evaluate();
+    REQUIRE( Near(animator.GetFinalBoneMatrices(), base) );
+
+    animator.UpdateAnimation(0.5f);
+    REQUIRE( animator.IsBlending() );
+    animator.RemoveLayer(layer);
+    REQUIRE_FALSE( animator.IsBlending() );
+}
+
+TEST_CASE( "Animator blends without allocating", "[Animator]" ) {
+    constexpr float dt = 1.0f / 60.0f;
+    TestAnimation walk(20);
+    TestAnimation run(20, 1.0f);
+    TestAnimation wave(20, 2.0f);
+    Animator animator(walk);
+    const int layer = animator.AddLayer(wave, 0.5f);
+    const BlendPoint points[] = { { &walk, 0.0f }, { &run, 1.0f } };
+
+    AllocationCounter counter;
+    for (int frame = 0; frame < 600; ++frame)
+    {
+        switch (frame % 150)
+        {
+        case 0: animator.CrossFade(run, 0.25f); break;
+        case 50: animator.CrossFade(walk, 0.25f); break;
+        case 100: animator.SetBlendSpace(points, 2, 0.25f); break;
+        default: break;
+        }
+
+        animator.SetBlendParameter(static_cast<float>(frame % 60) / 60.0f);
+        animator.SetLayerWeight(layer, static_cast<float>(frame % 30) / 30.0f);
+        animator.UpdateAnimation(dt);
+    }
+    const Size_t allocations = counter.GetCount();
+
+    REQUIRE( allocations == 0 );
+}
+
+TEST_CASE( "Crowd animation", "[Animator][!benchmark]" ) {
+    constexpr int crowd = 1000;
+    TestAnimation animation(40);
+    std::vector<Animator> animators(crowd, Animator(animation));
+
+    // spread the crowd over the clip so no poses are shared
+    for (int i = 0; i < crowd; ++i)
+    {
+        animators[i].Advance(0.001f * i);
+    }
+
+    BENCHMARK( "Every animator every frame" ) {
+        for (Animator& animator : animators)
+        {
+            animator.UpdateAnimation(1.0f / 60.0f);
+        }
+        return animators.front().GetTime();
+    };
+
+    AnimationScheduler scheduler;
+    BENCHMARK( "Scheduled by distance" ) {
+        scheduler.Clear();
+        for (int i = 0; i < crowd; ++i)
+        {
+            scheduler.Submit(animators[i], static_cast<float>(i % 100), true, static_cast<Uint32>(i));
+        }
+        scheduler.Update(1.0f / 60.0f);
+        return scheduler.GetStats().evaluated;
+    };
+
+    std::vector<Animator> instanced(crowd, Animator(animation));
+    BENCHMARK( "Shared poses, one clip in step" ) {
+        scheduler.Clear();
+        for (int i = 0; i < crowd; ++i)
+        {
+            scheduler.Submit(instanced[i], 1.0f, true, static_cast<Uint32>(i));
+        }
+        scheduler.Update(1.0f / 60.0f);
+        return scheduler.GetStats().shared;
+    };
+}
+
+TEST_CASE( "Crowd animation across threads", "[Animator][!benchmark]" ) {
+    constexpr int crowd = 1000;
+    const unsigned int threads = GENERATE( 1u, 2u, 4u, 8u );
+    if (threads > std::max(std::thread::hardware_concurrency(), 1u))
+    {
+        return;   // more threads than the machine has measures contention, not scaling
+    }
+
+    TestAnimation animation(40);
+    std::vector<Animator> animators(crowd, Animator(animation));
+    for (int i = 0; i < crowd; ++i)
+    {
+        animators[i].Advance(0.001f * i);
+    }
+
+    // the calling thread takes part, so it is one of the threads
+    JobSystem::Instance().Initialise(threads - 1);
+    AnimationScheduler scheduler;
+    BENCHMARK( "Every animator every frame, " + std::to_string(threads) + " threads" ) {
+        scheduler.Clear();
+        for (int i = 0; i < crowd; ++i)
+        {
+            scheduler.Submit(animators[i], 1.0f, true, static_cast<Uint32>(i));
+        }
+        scheduler.Update(1.0f / 60.0f);
+        return scheduler.GetStats().evaluated;
+    };
+    JobSystem::Instance().Shutdown();
+}
@@ -0,0 +1,132 @@
+#include <Catch2/catch_test_macros.hpp>
+#include <Catch2/benchmark/catch_benchmark.hpp>
+#include <Catch2/generators/catch_generators.hpp>
+#include <AEngine/Render/Bone.h>
+#include <string>
+
+using namespace AEngine;
+
+namespace
+{
+    // a clip with one key per tick on every channel
+    class TestBone : public Bone
+    {
+    public:
+        explicit TestBone(int keys)
+        {
+            m_name = "Bone";
+            for (int i = 0; i < keys; ++i)
+            {
+                const float time = static_cast<float>(i);
+                m_positions.push_back({ Math::vec3(time, 2.0f * time, -time), time });
+                m_rotations.push_back({ Math::angleAxis(0.1f * time, Math::normalize(Math::vec3(1.0f, 2.0f, 3.0f))), time });
+                m_scales.push_back({ Math::vec3(1.0f + 0.01f * time), time });
+            }
+        }
+
+        // the previous implementation, linear scans and three matrix products
+        Math::mat4 Reference(float animationTime) const
+        {
+            auto find = [animationTime](const auto& keys) {
+                for (Size_t i = 0; i + 1 < keys.size(); ++i)
+                {
+                    if (animationTime < keys[i + 1].timeStamp)
+                    {
+                        return i;
+                    }
+                }
+                return Size_t(0);
+            };
+
+            const Size_t p = find(m_positions);
+            const Size_t r = find(m_rotations);
+            const Size_t s = find(m_scales);
+            const float t = animationTime - static_cast<float>(p);
+            const Math::vec3 position = Math::mix(m_positions[p].position, m_positions[p + 1].position, t);
+            const Math::quat rotation = Math::normalize(Math::slerp(m_rotations[r].rotation, m_rotations[r + 1].rotation, t));
+            const Math::vec3 scale = Math::mix(m_scales[s].scale, m_scales[s + 1].scale, t);
+
+            return Math::translate(Math::mat4(1.0f), position) * Math::toMat4(rotation) * Math::scale(Math::mat4(1.0f), scale);
+        }
+    };
+
+    bool Near(const Math::mat4& a, const Math::mat4& b)
+    {
+        for (int column = 0; column < 4; ++column)
+        {
+            for (int row = 0; row < 4; ++row)
+            {
+                if (Math::abs(a[column][row] - b[column][row]) > 1e-3f)
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+}
+
+TEST_CASE( "Bone::GetLocalTransform() matches matrix composition", "[Bone]" ) {
+    TestBone bone(64);
+    BoneCursor cursor;
+    for (float time = 0.0f; time < 63.0f; time += 0.37f)
+    {
+        REQUIRE( Near(bone.GetLocalTransform(time, cursor), bone.Reference(time)) );
+        REQUIRE( Near(bone.GetLocalTransform(time), bone.Reference(time)) );
+    }
+}
+
+TEST_CASE( "BoneCursor survives seeking and looping", "[Bone]" ) {
+    TestBone bone(64);
+    BoneCursor cursor;
+    const float times[] = { 10.5f, 50.25f, 3.75f, 62.5f, 0.0f, 31.0f, 31.0f, 12.2f };
+    for (float time : times)
+    {
+        REQUIRE( Near(bone.GetLocalTransform(time, cursor), bone.Reference(time)) );
+    }
+}
+
+TEST_CASE( "Bone holds the end keys outside the clip", "[Bone]" ) {
+    TestBone bone(8);
+    BoneCursor cursor;
+    REQUIRE( Near(bone.GetLocalTransform(-1.0f, cursor), bone.Reference(0.0f)) );
+    REQUIRE( Near(bone.GetLocalTransform(100.0f, cursor), bone.GetLocalTransform(7.0f)) );
+}
+
+TEST_CASE( "Keyframe sampling scaling", "[Bone][!benchmark]" ) {
+    const int keys = GENERATE( 10, 1000, 10000 );
+    const std::string suffix = " (" + std::to_string(keys) + " keys)";
+    TestBone bone(keys);
+
+    // each run plays 64 frames at half a tick per frame, carrying on through the clip
+    // between runs and looping at the end, as an animator does
+    constexpr int frames = 64;
+    constexpr float step = 0.5f;
+    const float duration = static_cast<float>(keys - 1);
+    auto play = [&](float& time, auto&& sample) {
+        Math::mat4 sum(0.0f);
+        for (int i = 0; i < frames; ++i)
+        {
+            time = Math::mod(time + step, duration);
+            sum += sample(time);
+        }
+        return sum;
+    };
+
+    float linearTime = 0.0f;
+    BENCHMARK( "Linear scan and matrix products" + suffix ) {
+        return play(linearTime, [&](float time) { return bone.Reference(time); });
+    };
+
+    float searchTime = 0.0f;
+    BENCHMARK( "Binary search" + suffix ) {
+        return play(searchTime, [&](float time) { return bone.GetLocalTransform(time); });
+    };
+
+    float cursorTime = 0.0f;
+    BoneCursor cursor;
+    BENCHMARK( "Cached cursor" + suffix ) {
+        return play(cursorTime, [&](float time) { return bone.GetLocalTransform(time, cursor); });
+    };
+}
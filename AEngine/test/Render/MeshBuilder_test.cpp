@@ -0,0 +1,97 @@
+#include <Catch2/catch_test_macros.hpp>
+#include <Catch2/catch_approx.hpp>
+#include <AEngine/Render/MeshBuilder.h>
+#include <glm/gtc/packing.hpp>
+#include <cstring>
+
+using namespace AEngine;
+
+namespace
+{
+    template <typename T>
+    T Get(const MeshStream& stream, Uint32 vertex, Intptr_t offset)
+    {
+        T value;
+        const Intptr_t stride = MeshBuilder::GetStride(stream.format);
+        std::memcpy(&value, stream.vertices.data() + vertex * stride + offset, sizeof(T));
+        return value;
+    }
+}
+
+TEST_CASE( "Static meshes pack into 20 bytes per vertex", "[Render][MeshBuilder]" ) {
+    MeshBuilder builder(3, 3, false);
+    builder.SetPosition(1, Math::vec3(1.0f, 2.0f, 3.0f));
+    builder.SetTexCoord(1, Math::vec2(0.25f, 0.75f));
+    builder.SetNormal(1, Math::vec3(0.0f, 0.0f, 2.0f));
+    builder.AddIndex(0);
+    builder.AddIndex(1);
+    builder.AddIndex(2);
+
+    const MeshStream stream = builder.Build();
+    REQUIRE( stream.format == 0 );
+    REQUIRE( MeshBuilder::GetStride(stream.format) == 20 );
+    REQUIRE( stream.vertices.size() == 3 * 20 );
+    REQUIRE( stream.bounds.max == Math::vec3(1.0f, 2.0f, 3.0f) );
+
+    REQUIRE( Get<Math::vec3>(stream, 1, 0) == Math::vec3(1.0f, 2.0f, 3.0f) );
+    REQUIRE( glm::unpackHalf2x16(Get<Uint32>(stream, 1, 12)) == Math::vec2(0.25f, 0.75f) );
+    const Math::vec4 normal = glm::unpackSnorm3x10_1x2(Get<Uint32>(stream, 1, 16));
+    REQUIRE( normal.z == Catch::Approx(1.0f) );
+
+    REQUIRE( stream.indexType == IndexType::Uint16 );
+    REQUIRE( stream.indices.size() == 3 * sizeof(Uint16) );
+}
+
+TEST_CASE( "Tiled texture coordinates keep full precision", "[Render][MeshBuilder]" ) {
+    MeshBuilder builder(1, 0, false);
+    builder.SetTexCoord(0, Math::vec2(10.5f, 0.0f));
+
+    const MeshStream stream = builder.Build();
+    REQUIRE( (stream.format & MeshBuilder::FloatTexCoords) != 0 );
+    REQUIRE( MeshBuilder::GetStride(stream.format) == 24 );
+    REQUIRE( Get<Math::vec2>(stream, 0, 12) == Math::vec2(10.5f, 0.0f) );
+}
+
+TEST_CASE( "Skinned meshes keep the strongest normalized influences", "[Render][MeshBuilder]" ) {
+    MeshBuilder builder(1, 0, true);
+    builder.AddBoneInfluence(0, 1, 0.1f);
+    builder.AddBoneInfluence(0, 2, 0.3f);
+    builder.AddBoneInfluence(0, 3, 0.3f);
+    builder.AddBoneInfluence(0, 4, 0.2f);
+    builder.AddBoneInfluence(0, 5, 0.4f);   // replaces bone 1
+
+    const MeshStream stream = builder.Build();
+    REQUIRE( stream.format == MeshBuilder::Skinned );
+    REQUIRE( MeshBuilder::GetStride(stream.format) == 28 );
+
+    Uint8 ids[4];
+    Uint8 weights[4];
+    std::memcpy(ids, stream.vertices.data() + 20, sizeof(ids));
+    std::memcpy(weights, stream.vertices.data() + 24, sizeof(weights));
+
+    int sum = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        REQUIRE( ids[i] != 1 );
+        sum += weights[i];
+    }
+
+    REQUIRE( sum == 255 );
+}
+
+TEST_CASE( "Large skeletons and meshes use wider ids and indices", "[Render][MeshBuilder]" ) {
+    const Uint32 vertexCount = 70000;
+    MeshBuilder builder(vertexCount, 1, true);
+    builder.AddBoneInfluence(0, 300, 1.0f);
+    builder.AddIndex(vertexCount - 1);
+
+    const MeshStream stream = builder.Build();
+    REQUIRE( (stream.format & MeshBuilder::WideBoneIds) != 0 );
+    REQUIRE( MeshBuilder::GetStride(stream.format) == 32 );
+    REQUIRE( Get<Uint16>(stream, 0, 20) == 300 );
+
+    REQUIRE( stream.indexType == IndexType::Uint32 );
+    Uint32 index;
+    std::memcpy(&index, stream.indices.data(), sizeof(index));
+    REQUIRE( index == vertexCount - 1 );
+}
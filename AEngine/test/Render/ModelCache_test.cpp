@@ -0,0 +1,90 @@
+#include <Catch2/catch_test_macros.hpp>
+#include <AEngine/Render/MeshBuilder.h>
+#include <Platform/Assimp/AssimpModelCache.h>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace AEngine;
+
+namespace
+{
+    // a textured quad, triangulated when imported
+    std::string WriteQuad(float height)
+    {
+        const std::filesystem::path directory = std::filesystem::temp_directory_path() / "aengine_model_cache";
+        std::filesystem::create_directories(directory);
+        const std::string path = (directory / "quad.obj").generic_string();
+
+        std::ofstream obj(path, std::ios::trunc);
+        obj << "v 0 0 0\nv 1 0 0\nv 1 " << height << " 0\nv 0 " << height << " 0\n";
+        obj << "vt 0 0\nvt 1 0\nvt 1 1\nvt 0 1\n";
+        obj << "vn 0 0 1\n";
+        obj << "f 1/1/1 2/2/1 3/3/1 4/4/1\n";
+        return path;
+    }
+}
+
+TEST_CASE( "Cooked models load from the cooked file", "[Render][ModelCache]" ) {
+    const std::string path = WriteQuad(1.0f);
+    std::filesystem::remove(AssimpModelCache::GetCachePath(path));
+
+    UniquePtr<CookedModel> cold = AssimpModelCache::Load(path);
+    REQUIRE( cold );
+    REQUIRE( std::filesystem::exists(AssimpModelCache::GetCachePath(path)) );
+    REQUIRE( cold->meshes.size() == 1 );
+
+    const CookedMesh& coldMesh = cold->meshes[0];
+    REQUIRE( coldMesh.indexCount == 6 );
+    REQUIRE( coldMesh.indexType == IndexType::Uint16 );
+    REQUIRE( (coldMesh.format & MeshBuilder::Skinned) == 0 );
+    REQUIRE( coldMesh.bounds.max.y == 1.0f );
+
+    // the second load maps the file written by the first
+    UniquePtr<CookedModel> warm = AssimpModelCache::Load(path);
+    REQUIRE( warm );
+    REQUIRE( warm->file != nullptr );
+    REQUIRE( warm->meshes.size() == 1 );
+
+    const CookedMesh& warmMesh = warm->meshes[0];
+    REQUIRE( warmMesh.vertexCount == coldMesh.vertexCount );
+    REQUIRE( warmMesh.indexCount == coldMesh.indexCount );
+    REQUIRE( warmMesh.format == coldMesh.format );
+    REQUIRE( std::memcmp(warmMesh.vertices, coldMesh.vertices, coldMesh.vertexCount * MeshBuilder::GetStride(coldMesh.format)) == 0 );
+    REQUIRE( std::memcmp(warmMesh.indices, coldMesh.indices, coldMesh.indexCount * sizeof(Uint16)) == 0 );
+    REQUIRE( warm->materials.size() == cold->materials.size() );
+}
+
+TEST_CASE( "Cooked models follow changes to their source", "[Render][ModelCache]" ) {
+    const std::string path = WriteQuad(1.0f);
+    REQUIRE( AssimpModelCache::Cook(path) );
+
+    // only touched, the contents still match so the cooked file is kept
+    std::filesystem::last_write_time(path, std::filesystem::last_write_time(path) + std::chrono::hours(1));
+    UniquePtr<CookedModel> touched = AssimpModelCache::Load(path);
+    REQUIRE( touched );
+    REQUIRE( touched->meshes[0].bounds.max.y == 1.0f );
+
+    // same size, different contents
+    WriteQuad(5.0f);
+    std::filesystem::last_write_time(path, std::filesystem::last_write_time(path) + std::chrono::hours(2));
+    UniquePtr<CookedModel> edited = AssimpModelCache::Load(path);
+    REQUIRE( edited );
+    REQUIRE( edited->meshes[0].bounds.max.y == 5.0f );
+}
+
+TEST_CASE( "Corrupt cooked files are cooked again", "[Render][ModelCache]" ) {
+    const std::string path = WriteQuad(1.0f);
+    REQUIRE( AssimpModelCache::Cook(path) );
+
+    // keep the header so the file still looks current, but cut off the meshes
+    const std::string cachePath = AssimpModelCache::GetCachePath(path);
+    std::filesystem::resize_file(cachePath, 40);
+
+    UniquePtr<CookedModel> model = AssimpModelCache::Load(path);
+    REQUIRE( model );
+    REQUIRE( model->meshes.size() == 1 );
+    REQUIRE( std::filesystem::file_size(cachePath) > 40 );
+}
@@ -0,0 +1,55 @@
+#include <Catch2/catch_test_macros.hpp>
+#include <AEngine/Render/Buffer.h>
+#include <AEngine/Render/RenderCommand.h>
+#include <AEngine/Render/VertexArray.h>
+#include <Platform/Null/NullRenderCommand.h>
+#include <vector>
+
+using namespace AEngine;
+
+TEST_CASE( "Null backend records submitted work", "[Render][Null]" ) {
+    RenderCommand::Initialise(RenderLibrary::Null);
+    REQUIRE( RenderCommand::GetLibrary() == RenderLibrary::Null );
+    NullRenderCommand::ResetStats();
+
+    std::vector<float> vertices(12, 0.0f);
+    std::vector<Uint32> indices{ 0, 1, 2, 2, 3, 0 };
+
+    SharedPtr<VertexBuffer> vertexBuffer = VertexBuffer::Create();
+    vertexBuffer->SetData(vertices.data(), vertices.size() * sizeof(float), BufferUsage::StaticDraw);
+    SharedPtr<IndexBuffer> indexBuffer = IndexBuffer::Create();
+    indexBuffer->SetData(indices.data(), indices.size(), BufferUsage::StaticDraw);
+
+    SharedPtr<VertexArray> vertexArray = VertexArray::Create();
+    vertexArray->AddVertexBuffer(vertexBuffer);
+    vertexArray->SetIndexBuffer(indexBuffer);
+    REQUIRE( vertexArray->GetIndexBuffer()->GetCount() == 6 );
+    REQUIRE( vertexBuffer->Size() == 12 * sizeof(float) );
+
+    vertexArray->Bind();
+    RenderCommand::DrawIndexed(Primitive::Triangles, 6, nullptr);
+    RenderCommand::DrawIndexedInstanced(Primitive::Triangles, 6, nullptr, 10);
+
+    const NullRenderStats& stats = NullRenderCommand::GetStats();
+    REQUIRE( stats.drawCalls == 2 );
+    REQUIRE( stats.instances == 11 );
+    REQUIRE( stats.elements == 66 );
+    REQUIRE( stats.vertexArrayBinds == 1 );
+    REQUIRE( stats.uploads == 2 );
+    REQUIRE( stats.bytesUploaded == 12 * sizeof(float) + 6 * sizeof(Uint32) );
+}
+
+TEST_CASE( "Null backend keeps render state for inspection", "[Render][Null]" ) {
+    RenderCommand::Initialise(RenderLibrary::Null);
+
+    RenderCommand::EnableBlend(true);
+    RenderCommand::SetBlendFunction(BlendFunction::SourceAlpha, BlendFunction::OneMinusSourceAlpha);
+    RenderCommand::SetViewport(0, 0, 1600, 900);
+    RenderCommand::PolygonMode(PolygonFace::FrontAndBack, PolygonDraw::Line);
+
+    REQUIRE( RenderCommand::IsBlendEnabled() );
+    REQUIRE( RenderCommand::GetBlendSourceFunction() == BlendFunction::SourceAlpha );
+    REQUIRE( RenderCommand::GetBlendDestinationFunction() == BlendFunction::OneMinusSourceAlpha );
+    REQUIRE( RenderCommand::GetViewport() == Math::ivec4(0, 0, 1600, 900) );
+    REQUIRE( RenderCommand::GetPolygonMode(PolygonFace::Front) == PolygonDraw::Line );
+}
@@ -0,0 +1,151 @@
+#include <Catch2/catch_test_macros.hpp>
+#include <AEngine/Render/Model.h>
+#include <AEngine/Render/RenderCommand.h>
+#include <AEngine/Render/RenderQueue.h>
+#include <Platform/Null/NullRenderCommand.h>
+#include <vector>
+
+using namespace AEngine;
+
+namespace
+{
+    class TestMaterial : public Material
+    {
+    public:
+        explicit TestMaterial(float alpha = 1.0f)
+            : Material("Test", "Test")
+        {
+            SetColor(Math::vec4(1.0f, 1.0f, 1.0f, alpha));
+        }
+    };
+
+    class TestModel : public Model
+    {
+    public:
+        TestModel(const SharedPtr<VertexArray>& mesh, const SharedPtr<Material>& material)
+            : Model("Test", "Test")
+        {
+            m_meshes.push_back({ mesh, MaterialMetadata{ "Test", 0, material } });
+        }
+    };
+
+    SharedPtr<VertexArray> CreateMesh()
+    {
+        std::vector<Uint32> indices{ 0, 1, 2 };
+        SharedPtr<IndexBuffer> indexBuffer = IndexBuffer::Create();
+        indexBuffer->SetData(indices.data(), indices.size(), BufferUsage::StaticDraw);
+
+        SharedPtr<VertexArray> vertexArray = VertexArray::Create();
+        vertexArray->SetIndexBuffer(indexBuffer);
+        return vertexArray;
+    }
+
+    Math::mat4 Translation(float x)
+    {
+        return Math::translate(Math::mat4(1.0f), Math::vec3(x, 0.0f, 0.0f));
+    }
+}
+
+TEST_CASE( "Render queue draws each shader, material and mesh once, instanced", "[Render][RenderQueue]" ) {
+    RenderCommand::Initialise(RenderLibrary::Null);
+    SharedPtr<Shader> shaderA = Shader::Create("");
+    SharedPtr<Shader> shaderB = Shader::Create("");
+    SharedPtr<Material> stone = MakeShared<TestMaterial>();
+    SharedPtr<Material> metal = MakeShared<TestMaterial>();
+    SharedPtr<VertexArray> rockMesh = CreateMesh();
+    SharedPtr<VertexArray> wallMesh = CreateMesh();
+    SharedPtr<VertexArray> pipeMesh = CreateMesh();
+    SharedPtr<VertexArray> statueMesh = CreateMesh();
+    TestModel rock(rockMesh, stone);
+    TestModel wall(wallMesh, stone);
+    TestModel pipe(pipeMesh, metal);
+    TestModel statue(statueMesh, stone);
+
+    // submitted interleaved, as a scene walks its entities
+    RenderQueue queue(RenderQueue::Pass::Opaque);
+    queue.Submit(rock, *shaderA, Translation(0.0f));
+    queue.Submit(wall, *shaderA, Translation(1.0f));
+    queue.Submit(statue, *shaderB, Translation(2.0f));
+    queue.Submit(pipe, *shaderA, Translation(3.0f));
+    queue.Submit(rock, *shaderA, Translation(4.0f));
+    queue.Submit(wall, *shaderA, Translation(5.0f));
+    queue.Submit(rock, *shaderA, Translation(6.0f));
+
+    NullRenderCommand::ResetStats();
+    queue.Flush(FrameContext{});
+
+    // rock x3, wall x2, pipe and statue are each one batch
+    const RenderQueue::Stats& stats = queue.GetStats();
+    REQUIRE( stats.submissions == 7 );
+    REQUIRE( stats.drawCalls == 4 );
+    REQUIRE( stats.shaderBinds == 2 );
+    REQUIRE( stats.materialBinds == 3 );   // stone and metal under shaderA, stone again under shaderB
+    REQUIRE( stats.vertexArrayBinds == 4 );
+    REQUIRE( stats.GetStateChanges() == 9 );
+
+    // the queue's counts match what reached the backend
+    const NullRenderStats& backend = NullRenderCommand::GetStats();
+    REQUIRE( backend.drawCalls == stats.drawCalls );
+    REQUIRE( backend.instances == 7 );
+    REQUIRE( backend.elements == 7 * 3 );
+    REQUIRE( backend.shaderBinds == stats.shaderBinds );
+    REQUIRE( backend.vertexArrayBinds == stats.vertexArrayBinds );
+
+    // each mesh's instance buffer holds the transforms of its own batch
+    REQUIRE( rockMesh->GetInstanceBuffer()->Size() == 3 * sizeof(Math::mat4) );
+    REQUIRE( wallMesh->GetInstanceBuffer()->Size() == 2 * sizeof(Math::mat4) );
+    REQUIRE( pipeMesh->GetInstanceBuffer()->Size() == sizeof(Math::mat4) );
+    REQUIRE( statueMesh->GetInstanceBuffer()->Size() == sizeof(Math::mat4) );
+}
+
+TEST_CASE( "Render queue reuses instance buffers and keeps stats until cleared", "[Render][RenderQueue]" ) {
+    RenderCommand::Initialise(RenderLibrary::Null);
+    SharedPtr<Shader> shader = Shader::Create("");
+    SharedPtr<Material> stone = MakeShared<TestMaterial>();
+    SharedPtr<VertexArray> rockMesh = CreateMesh();
+    TestModel rock(rockMesh, stone);
+
+    RenderQueue queue(RenderQueue::Pass::Opaque);
+    for (int i = 0; i < 4; ++i)
+    {
+        queue.Submit(rock, *shader, Translation(static_cast<float>(i)));
+    }
+    queue.Flush(FrameContext{});
+    const SharedPtr<VertexBuffer> instances = rockMesh->GetInstanceBuffer();
+    REQUIRE( queue.GetStats().drawCalls == 1 );
+
+    // fewer instances the next frame fit in the same buffer
+    queue.Clear();
+    REQUIRE( queue.GetStats().drawCalls == 0 );
+    queue.Submit(rock, *shader, Translation(0.0f));
+    queue.Submit(rock, *shader, Translation(1.0f));
+    NullRenderCommand::ResetStats();
+    queue.Flush(FrameContext{});
+
+    REQUIRE( rockMesh->GetInstanceBuffer() == instances );
+    REQUIRE( instances->Size() == 4 * sizeof(Math::mat4) );
+    REQUIRE( NullRenderCommand::GetStats().instances == 2 );
+    REQUIRE( NullRenderCommand::GetStats().bytesUploaded == 2 * sizeof(Math::mat4) );
+}
+
+TEST_CASE( "Render queue only accepts meshes of its pass", "[Render][RenderQueue]" ) {
+    RenderCommand::Initialise(RenderLibrary::Null);
+    SharedPtr<Shader> shader = Shader::Create("");
+    TestModel solid(CreateMesh(), MakeShared<TestMaterial>());
+    TestModel glass(CreateMesh(), MakeShared<TestMaterial>(0.5f));
+
+    RenderQueue opaque(RenderQueue::Pass::Opaque);
+    RenderQueue transparent(RenderQueue::Pass::Transparent);
+    for (RenderQueue* queue : { &opaque, &transparent })
+    {
+        queue->Submit(solid, *shader, Math::mat4(1.0f));
+        queue->Submit(glass, *shader, Math::mat4(1.0f));
+        queue->Submit(glass, *shader, Math::mat4(1.0f));
+    }
+
+    REQUIRE( opaque.GetStats().submissions == 1 );
+    REQUIRE( transparent.GetStats().submissions == 2 );
+
+    transparent.Flush(FrameContext{});
+    REQUIRE( transparent.GetStats().drawCalls == 1 );
+}
@@ -0,0 +1,103 @@
+#include <Catch2/catch_test_macros.hpp>
+#include <AEngine/Core/PerspectiveCamera.h>
+#include <AEngine/Render/Buffer.h>
+#include <AEngine/Render/RenderCommand.h>
+#include <AEngine/Render/RenderPipeline.h>
+#include <Platform/Null/NullBuffer.h>
+#include <Platform/Null/NullRenderCommand.h>
+#include <cstring>
+#include <string>
+
+using namespace AEngine;
+
+namespace
+{
+    // offsets of the std140 CameraBlock declared by the engine shaders
+    constexpr Intptr_t g_projectionViewOffset = 0;
+    constexpr Intptr_t g_projectionOffset = 64;
+    constexpr Intptr_t g_viewOffset = 128;
+    constexpr Intptr_t g_cameraPositionOffset = 192;
+    constexpr Intptr_t g_lightPositionOffset = 208;
+    constexpr Intptr_t g_lightColorOffset = 224;
+    constexpr Intptr_t g_cameraBlockBytes = 240;
+
+    bool Near(const Math::mat4& lhs, const Math::mat4& rhs)
+    {
+        for (int column = 0; column < 4; ++column)
+        {
+            if (Math::any(Math::greaterThan(Math::abs(lhs[column] - rhs[column]), Math::vec4(1e-5f))))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    template <typename T>
+    T Read(const NullUniformBinding& binding, Intptr_t offset)
+    {
+        T value;
+        std::memcpy(&value, binding.buffer->GetData() + binding.offset + offset, sizeof(T));
+        return value;
+    }
+}
+
+TEST_CASE( "Uniform buffers record the range bound to their block", "[Render][UniformBuffer]" ) {
+    RenderCommand::Initialise(RenderLibrary::Null);
+    SharedPtr<UniformBuffer> buffer = UniformBuffer::Create(UniformBlock::Skeleton);
+    REQUIRE( buffer->GetBlock() == UniformBlock::Skeleton );
+    REQUIRE( std::string(UniformBuffer::GetBlockName(UniformBlock::Skeleton)) == "SkeletonBlock" );
+
+    buffer->SetData(nullptr, 1024, BufferUsage::DynamicDraw);
+    REQUIRE( buffer->Size() == 1024 );
+
+    buffer->BindRange(512, 256);
+    const NullUniformBinding& binding = NullRenderCommand::GetUniformBinding(UniformBlock::Skeleton);
+    REQUIRE( binding.buffer == buffer.get() );
+    REQUIRE( binding.offset == 512 );
+    REQUIRE( binding.bytes == 256 );
+    REQUIRE( NullRenderCommand::GetUniformBinding(UniformBlock::Camera).buffer != buffer.get() );
+
+    buffer->Unbind();
+    REQUIRE( binding.buffer == nullptr );
+}
+
+TEST_CASE( "Camera block is uploaded once in the layout the shaders read", "[Render][UniformBuffer]" ) {
+    RenderCommand::Initialise(RenderLibrary::Null);
+    PerspectiveCamera camera(60.0f, 16.0f / 9.0f, 0.1f, 100.0f);
+    const Math::mat4 view = Math::lookAt(Math::vec3(0.0f, 2.0f, 5.0f), Math::vec3(0.0f), Math::vec3(0.0f, 1.0f, 0.0f));
+    camera.SetViewMatrix(view);
+
+    FrameContext context;
+    context.camera = &camera;
+    context.cameraPosition = { 0.0f, 2.0f, 5.0f };
+    context.lightPosition = { -3.0f, 8.0f, 1.0f };
+    context.lightColor = { 1.0f, 0.5f, 0.25f };
+
+    SharedPtr<UniformBuffer> buffer = UniformBuffer::Create(UniformBlock::Camera);
+    NullRenderCommand::ResetStats();
+    RenderPipeline::UploadCameraBlock(*buffer, context);
+    buffer->Bind();
+
+    // one upload per frame, however many shaders read it
+    REQUIRE( NullRenderCommand::GetStats().uploads == 1 );
+    REQUIRE( NullRenderCommand::GetStats().bytesUploaded == g_cameraBlockBytes );
+
+    const NullUniformBinding& binding = NullRenderCommand::GetUniformBinding(UniformBlock::Camera);
+    REQUIRE( binding.buffer == buffer.get() );
+    REQUIRE( binding.offset == 0 );
+    REQUIRE( binding.bytes == g_cameraBlockBytes );
+    REQUIRE( Near(Read<Math::mat4>(binding, g_projectionViewOffset), camera.GetProjectionMatrix() * view) );
+    REQUIRE( Read<Math::mat4>(binding, g_projectionOffset) == camera.GetProjectionMatrix() );
+    REQUIRE( Read<Math::mat4>(binding, g_viewOffset) == view );
+    REQUIRE( Read<Math::vec4>(binding, g_cameraPositionOffset) == Math::vec4(0.0f, 2.0f, 5.0f, 1.0f) );
+    REQUIRE( Read<Math::vec4>(binding, g_lightPositionOffset) == Math::vec4(-3.0f, 8.0f, 1.0f, 1.0f) );
+    REQUIRE( Read<Math::vec4>(binding, g_lightColorOffset) == Math::vec4(1.0f, 0.5f, 0.25f, 1.0f) );
+
+    // the next frame reuses the buffer
+    context.lightColor = Math::vec3(0.0f);
+    RenderPipeline::UploadCameraBlock(*buffer, context);
+    REQUIRE( buffer->Size() == g_cameraBlockBytes );
+    REQUIRE( Read<Math::vec4>(binding, g_lightColorOffset) == Math::vec4(0.0f, 0.0f, 0.0f, 1.0f) );
+}
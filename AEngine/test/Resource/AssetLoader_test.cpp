@@ -0,0 +1,130 @@
+#include <Catch2/catch_test_macros.hpp>
+#include <AEngine/Resource/AssetLoader.h>
+#include <AEngine/Resource/AssetManager.h>
+#include <atomic>
+#include <string>
+#include <thread>
+
+using namespace AEngine;
+
+namespace
+{
+    std::atomic<int> g_decodes{ 0 };
+    std::thread::id g_createThread;
+
+    // decoded on a worker, created on the main thread like a texture
+    struct FakeSource
+    {
+        std::string path;
+    };
+
+    struct FakeAsset
+    {
+        using Source = FakeSource;
+
+        std::string ident;
+        std::string path;
+
+        static SharedPtr<FakeSource> Decode(const std::string& path)
+        {
+            ++g_decodes;
+            return MakeShared<FakeSource>(FakeSource{ path });
+        }
+
+        static SharedPtr<FakeAsset> Create(const std::string& ident, const std::string& path, const FakeSource& source)
+        {
+            g_createThread = std::this_thread::get_id();
+            return MakeShared<FakeAsset>(FakeAsset{ ident, source.path });
+        }
+    };
+
+    // no source, created on the main thread like a shader
+    struct MainThreadAsset
+    {
+        std::string ident;
+
+        static SharedPtr<MainThreadAsset> Create(const std::string& ident, const std::string& path)
+        {
+            g_createThread = std::this_thread::get_id();
+            return MakeShared<MainThreadAsset>(MainThreadAsset{ ident });
+        }
+    };
+
+    // the loader is a singleton, so each test starts and stops its workers
+    struct Workers
+    {
+        explicit Workers(unsigned int count) { AssetLoader::Instance().Initialise(count); }
+        ~Workers()
+        {
+            AssetLoader::Instance().Shutdown();
+            AssetManager<FakeAsset>::Instance().Clear();
+            AssetManager<MainThreadAsset>::Instance().Clear();
+        }
+    };
+}
+
+TEST_CASE( "Async loads decode on workers and finish on the main thread", "[AssetLoader]" ) {
+    Workers workers(4);
+    g_decodes = 0;
+
+    AssetHandle<FakeAsset> handles[8];
+    for (int i = 0; i < 8; ++i)
+    {
+        handles[i] = AssetManager<FakeAsset>::Instance().LoadAsync("assets/fake" + std::to_string(i));
+    }
+
+    // nothing is created until the main thread runs the uploads
+    REQUIRE( AssetManager<FakeAsset>::Instance().Get("fake0") == nullptr );
+
+    AssetLoader::Instance().Flush();
+    REQUIRE( g_decodes == 8 );
+    REQUIRE( g_createThread == std::this_thread::get_id() );
+    REQUIRE( AssetLoader::Instance().IsIdle() );
+    for (int i = 0; i < 8; ++i)
+    {
+        REQUIRE( handles[i].IsReady() );
+        REQUIRE( handles[i].Get()->path == "assets/fake" + std::to_string(i) );
+        REQUIRE( AssetManager<FakeAsset>::Instance().Get("fake" + std::to_string(i)) == handles[i].Get() );
+    }
+}
+
+TEST_CASE( "Async loads of the same asset share one load", "[AssetLoader]" ) {
+    Workers workers(2);
+    g_decodes = 0;
+
+    AssetHandle<FakeAsset> first = AssetManager<FakeAsset>::Instance().LoadAsync("a/shared");
+    AssetHandle<FakeAsset> second = AssetManager<FakeAsset>::Instance().LoadAsync("b/shared");
+    REQUIRE( first.Wait() == second.Wait() );
+    REQUIRE( g_decodes == 1 );
+
+    // loaded assets come back ready
+    AssetHandle<FakeAsset> third = AssetManager<FakeAsset>::Instance().LoadAsync("a/shared");
+    REQUIRE( third.IsReady() );
+    REQUIRE( third.Get() == first.Get() );
+}
+
+TEST_CASE( "Assets without a source are created in the upload queue", "[AssetLoader]" ) {
+    Workers workers(2);
+    g_createThread = std::thread::id();
+
+    AssetHandle<MainThreadAsset> handle = AssetManager<MainThreadAsset>::Instance().LoadAsync("shaders/main");
+    REQUIRE_FALSE( handle.IsReady() );
+    REQUIRE( AssetLoader::Instance().ProcessUploads(0.0f) == 1 );
+    REQUIRE( handle.IsReady() );
+    REQUIRE( handle.Get()->ident == "main" );
+    REQUIRE( g_createThread == std::this_thread::get_id() );
+}
+
+TEST_CASE( "Upload budget limits the work done each frame", "[AssetLoader]" ) {
+    Workers workers(0);
+
+    // without workers decoding runs inline, but uploads still wait for the frame
+    for (int i = 0; i < 3; ++i)
+    {
+        AssetManager<FakeAsset>::Instance().LoadAsync("budget/" + std::to_string(i));
+    }
+
+    REQUIRE( AssetLoader::Instance().ProcessUploads(0.0f) == 1 );
+    REQUIRE( AssetLoader::Instance().ProcessUploads(1.0f) == 2 );
+    REQUIRE( AssetLoader::Instance().IsIdle() );
+}
@@ -0,0 +1,150 @@
+#include <Catch2/catch_test_macros.hpp>
+#include <Catch2/benchmark/catch_benchmark.hpp>
+#include <Catch2/generators/catch_generators.hpp>
+#include <AEngine/Scene/EntityIndex.h>
+#include <string>
+#include <vector>
+
+using namespace AEngine;
+
+namespace
+{
+    // mirrors TagComponent without pulling in every component dependency
+    struct Tag
+    {
+        std::string tag;
+        Uint64 ident;
+    };
+
+    entt::entity LinearFind(entt::registry& registry, Uint64 ident)
+    {
+        auto view = registry.view<Tag>();
+        for (auto [entity, tag] : view.each())
+        {
+            if (tag.ident == ident)
+            {
+                return entity;
+            }
+        }
+
+        return entt::null;
+    }
+
+    entt::entity LinearFind(entt::registry& registry, const std::string& name)
+    {
+        auto view = registry.view<Tag>();
+        for (auto [entity, tag] : view.each())
+        {
+            if (tag.tag == name)
+            {
+                return entity;
+            }
+        }
+
+        return entt::null;
+    }
+}
+
+TEST_CASE( "EntityIndex finds inserted entities", "[EntityIndex]" ) {
+    entt::registry registry;
+    EntityIndex index;
+
+    entt::entity a = registry.create();
+    entt::entity b = registry.create();
+    index.Insert(a, 1, "Player");
+    index.Insert(b, 2, "Enemy");
+
+    REQUIRE( index.Size() == 2 );
+    REQUIRE( index.Find(Uint64(1)) == a );
+    REQUIRE( index.Find("Enemy") == b );
+    REQUIRE( index.Find(Uint64(3)) == entt::null );
+    REQUIRE( index.Find("Missing") == entt::null );
+}
+
+TEST_CASE( "EntityIndex::Erase() only removes the given entity", "[EntityIndex]" ) {
+    entt::registry registry;
+    EntityIndex index;
+
+    entt::entity a = registry.create();
+    entt::entity b = registry.create();
+    index.Insert(a, 1, "Entity");
+    index.Insert(b, 2, "Entity");
+
+    index.Erase(a, 1, "Entity");
+    REQUIRE( index.Find(Uint64(1)) == entt::null );
+    REQUIRE( index.Find(Uint64(2)) == b );
+    REQUIRE( index.Find("Entity") == b );
+
+    index.Erase(b, 2, "Entity");
+    REQUIRE( index.Find("Entity") == entt::null );
+    REQUIRE( index.Size() == 0 );
+}
+
+TEST_CASE( "EntityIndex::Rename() moves the tag", "[EntityIndex]" ) {
+    entt::registry registry;
+    EntityIndex index;
+
+    entt::entity a = registry.create();
+    index.Insert(a, 1, "Old");
+    index.Rename(a, "Old", "New");
+
+    REQUIRE( index.Find("Old") == entt::null );
+    REQUIRE( index.Find("New") == a );
+    REQUIRE( index.Find(Uint64(1)) == a );
+}
+
+TEST_CASE( "Entity lookup scaling", "[EntityIndex][!benchmark]" ) {
+    const int count = GENERATE( 1000, 10000, 100000 );
+
+    entt::registry registry;
+    EntityIndex index;
+    std::vector<std::string> names;
+    names.reserve(count);
+    for (int i = 0; i < count; ++i)
+    {
+        names.push_back("Entity_" + std::to_string(i));
+        entt::entity entity = registry.create();
+        registry.emplace<Tag>(entity, names.back(), static_cast<Uint64>(i));
+        index.Insert(entity, static_cast<Uint64>(i), names.back());
+    }
+
+    // sample keys spread across the whole range
+    constexpr int samples = 64;
+    const std::string suffix = " (" + std::to_string(count) + " entities)";
+
+    BENCHMARK( "Linear ident lookup" + suffix ) {
+        Size_t found = 0;
+        for (int i = 0; i < samples; ++i)
+        {
+            found += LinearFind(registry, static_cast<Uint64>(i * count / samples)) != entt::null;
+        }
+        return found;
+    };
+
+    BENCHMARK( "Indexed ident lookup" + suffix ) {
+        Size_t found = 0;
+        for (int i = 0; i < samples; ++i)
+        {
+            found += index.Find(static_cast<Uint64>(i * count / samples)) != entt::null;
+        }
+        return found;
+    };
+
+    BENCHMARK( "Linear tag lookup" + suffix ) {
+        Size_t found = 0;
+        for (int i = 0; i < samples; ++i)
+        {
+            found += LinearFind(registry, names[i * count / samples]) != entt::null;
+        }
+        return found;
+    };
+
+    BENCHMARK( "Indexed tag lookup" + suffix ) {
+        Size_t found = 0;
+        for (int i = 0; i < samples; ++i)
+        {
+            found += index.Find(names[i * count / samples]) != entt::null;
+        }
+        return found;
+    };
+}
@@ -0,0 +1,125 @@
+#include <Catch2/catch_test_macros.hpp>
+#include <Catch2/benchmark/catch_benchmark.hpp>
+#include <AEngine/Scene/Components.h>
+#include <vector>
+
+using namespace AEngine;
+
+namespace
+{
+    bool Near(const Math::mat4& lhs, const Math::mat4& rhs)
+    {
+        for (int column = 0; column < 4; ++column)
+        {
+            if (Math::any(Math::greaterThan(Math::abs(lhs[column] - rhs[column]), Math::vec4(1e-5f))))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+TEST_CASE( "World transforms are only rebuilt when their inputs change", "[WorldTransform]" ) {
+    TransformComponent local;
+    local.translation = { 1.0f, 2.0f, 3.0f };
+    WorldTransformComponent world;
+
+    REQUIRE( world.Update(local, nullptr) );
+    REQUIRE( world.version == 1 );
+    REQUIRE( Near(world.matrix, local.ToMat4()) );
+
+    REQUIRE_FALSE( world.Update(local, nullptr) );
+    REQUIRE( world.version == 1 );
+
+    local.scale = Math::vec3(2.0f);
+    REQUIRE( world.Update(local, nullptr) );
+    REQUIRE( world.version == 2 );
+
+    world.dirty = true;
+    REQUIRE( world.Update(local, nullptr) );
+}
+
+TEST_CASE( "Parent changes propagate down the chain", "[WorldTransform]" ) {
+    TransformComponent rootLocal, childLocal, grandchildLocal;
+    rootLocal.translation = { 10.0f, 0.0f, 0.0f };
+    childLocal.orientation = Math::angleAxis(Math::radians(90.0f), Math::vec3(0.0f, 1.0f, 0.0f));
+    grandchildLocal.translation = { 0.0f, 0.0f, 1.0f };
+
+    WorldTransformComponent root, child, grandchild;
+    root.Update(rootLocal, nullptr);
+    child.Update(childLocal, &root);
+    grandchild.Update(grandchildLocal, &child);
+    REQUIRE( Near(grandchild.matrix, rootLocal.ToMat4() * childLocal.ToMat4() * grandchildLocal.ToMat4()) );
+
+    // nothing changed, nothing is rebuilt
+    REQUIRE_FALSE( root.Update(rootLocal, nullptr) );
+    REQUIRE_FALSE( child.Update(childLocal, &root) );
+    REQUIRE_FALSE( grandchild.Update(grandchildLocal, &child) );
+
+    // moving the root rebuilds every descendant in parent first order
+    rootLocal.translation.y = 5.0f;
+    REQUIRE( root.Update(rootLocal, nullptr) );
+    REQUIRE( child.Update(childLocal, &root) );
+    REQUIRE( grandchild.Update(grandchildLocal, &child) );
+    REQUIRE( Near(grandchild.matrix, rootLocal.ToMat4() * childLocal.ToMat4() * grandchildLocal.ToMat4()) );
+    REQUIRE( Math::all(Math::lessThan(Math::abs(grandchild.GetTranslation() - Math::vec3(11.0f, 5.0f, 0.0f)), Math::vec3(1e-5f))) );
+}
+
+TEST_CASE( "A world pose read back into a parented body is not transformed twice", "[WorldTransform]" ) {
+    TransformComponent parentLocal, childLocal;
+    parentLocal.translation = { 10.0f, 0.0f, 0.0f };
+    parentLocal.orientation = Math::angleAxis(Math::radians(90.0f), Math::vec3(0.0f, 1.0f, 0.0f));
+    parentLocal.scale = Math::vec3(2.0f);
+    childLocal.scale = Math::vec3(0.5f);
+
+    WorldTransformComponent parent, child;
+    parent.Update(parentLocal, nullptr);
+    child.Update(childLocal, &parent);
+
+    // the physics world reports where the body is in world space
+    const Math::vec3 bodyPosition{ 3.0f, -4.0f, 5.0f };
+    const Math::quat bodyOrientation = Math::angleAxis(Math::radians(30.0f), Math::vec3(1.0f, 0.0f, 0.0f));
+    parent.ToLocal(bodyPosition, bodyOrientation, childLocal);
+    REQUIRE( childLocal.scale == Math::vec3(0.5f) );
+
+    REQUIRE( child.Update(childLocal, &parent) );
+    REQUIRE( Math::all(Math::lessThan(Math::abs(child.GetTranslation() - bodyPosition), Math::vec3(1e-4f))) );
+    REQUIRE( Math::abs(Math::dot(child.GetOrientation(), bodyOrientation)) > 0.9999f );
+}
+
+TEST_CASE( "World transform pass", "[WorldTransform][!benchmark]" ) {
+    constexpr int count = 10000;
+    std::vector<TransformComponent> locals(count);
+    std::vector<WorldTransformComponent> worlds(count);
+    for (int i = 0; i < count; ++i)
+    {
+        locals[i].translation = Math::vec3(static_cast<float>(i));
+        worlds[i].Update(locals[i], nullptr);
+    }
+
+    // a mostly static scene, only a handful of entities move each frame
+    BENCHMARK( "Rebuild every matrix (10000 entities)" ) {
+        float sum = 0.0f;
+        for (const TransformComponent& local : locals)
+        {
+            sum += local.ToMat4()[3].x;
+        }
+        return sum;
+    };
+
+    BENCHMARK( "Cached pass, 1% moving (10000 entities)" ) {
+        for (int i = 0; i < count; i += 100)
+        {
+            locals[i].translation.x += 1.0f;
+        }
+
+        Uint32 rebuilt = 0;
+        for (int i = 0; i < count; ++i)
+        {
+            rebuilt += worlds[i].Update(locals[i], nullptr);
+        }
+        return rebuilt;
+    };
+}
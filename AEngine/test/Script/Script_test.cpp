@@ -0,0 +1,338 @@
+#include <Catch2/catch_test_macros.hpp>
+#include <Catch2/benchmark/catch_benchmark.hpp>
+#include <AEngine/Scene/Entity.h>
+#include <AEngine/Script/EntityScript.h>
+#include <AEngine/Script/Script.h>
+#include <AEngine/Script/ScriptEngine.h>
+#include <AEngine/Script/ScriptEnvironment.h>
+#include <AEngine/Script/ScriptScheduler.h>
+#include <AEngine/Script/ScriptState.h>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace AEngine;
+
+namespace
+{
+    std::string WriteScript(const std::string& name, const std::string& source)
+    {
+        const std::filesystem::path directory = std::filesystem::temp_directory_path() / "aengine_script_cache";
+        std::filesystem::create_directories(directory);
+        const std::string path = (directory / name).generic_string();
+
+        std::ofstream file(path, std::ios::trunc);
+        file << source;
+        return path;
+    }
+
+    // a behaviour script of a few hundred lines, like an enemy
+    std::string BehaviourSource()
+    {
+        std::string source = "health = 100\n";
+        for (int i = 0; i < 50; ++i)
+        {
+            const std::string index = std::to_string(i);
+            source += "function State" + index + "(dt)\n";
+            source += "    local speed = " + index + " * dt\n";
+            source += "    if health > " + index + " then\n";
+            source += "        health = health - speed\n";
+            source += "    end\n";
+            source += "    return speed\n";
+            source += "end\n";
+        }
+
+        source += "function OnUpdate(dt) State0(dt) end\n";
+        return source;
+    }
+
+    // long lived tables, and a frame that makes garbage like messages and vectors do
+    const char* g_aeGarbageSource =
+        "live = {}\n"
+        "for i = 1, 2000 do\n"
+        "    local entry = {}\n"
+        "    for j = 1, 50 do entry[j] = { j, tostring(j) } end\n"
+        "    live[i] = entry\n"
+        "end\n"
+        "function Frame(count)\n"
+        "    for i = 1, count do\n"
+        "        local message = { type = 'Damage', value = i, position = { x = i, y = i, z = i } }\n"
+        "    end\n"
+        "end\n";
+
+    // every state replaces the default error handler, so the tests share the engine's state
+    ScriptState& BeginGarbage(ScriptState::GCMode mode, float budget)
+    {
+        ScriptState& state = ScriptEngine::GetState();
+        ScriptState::GCSettings settings;
+        settings.mode = mode;
+        settings.stepBudget = budget;
+        state.SetGCSettings(settings);
+        state.LoadScript(g_aeGarbageSource);
+        return state;
+    }
+
+    void EndGarbage(ScriptState& state)
+    {
+        state.LoadScript("live = nil\nFrame = nil\ncollectgarbage()\n");
+        state.SetGCSettings(ScriptState::GCSettings{});
+    }
+
+    double FrameTimeP99(ScriptState::GCMode mode, float budget, Size_t& heapBytes)
+    {
+        ScriptState& state = BeginGarbage(mode, budget);
+
+        using Clock = std::chrono::steady_clock;
+        std::vector<double> frames;
+        for (int i = 0; i < 600; ++i)
+        {
+            const Clock::time_point start = Clock::now();
+            state.CallFunction("Frame", 2000);
+            state.StepGC();
+            frames.push_back(std::chrono::duration<double>(Clock::now() - start).count());
+        }
+
+        heapBytes = state.GetGCStats().heapBytes;
+        EndGarbage(state);
+        const auto p99 = frames.begin() + frames.size() * 99 / 100;
+        std::nth_element(frames.begin(), p99, frames.end());
+        return *p99;
+    }
+}
+
+TEST_CASE( "Instances of a script keep their own environment", "[Script]" ) {
+    Script::SetCacheEnabled(false);
+    const std::string path = WriteScript("counter.lua",
+        "count = 0\n"
+        "function Increment()\n"
+        "    count = count + 1\n"
+        "    Record(count)\n"
+        "end\n"
+    );
+    Script script("counter.lua", path);
+    REQUIRE_FALSE( script.GetBytecode().empty() );
+
+    std::vector<int> recorded;
+    ScriptState& state = ScriptEngine::GetState();
+    state.GetNative()["Record"] = [&recorded](int count) { recorded.push_back(count); };
+
+    // both load the one compiled chunk, but the functions it defines see their own globals
+    ScriptEnvironment first(state);
+    ScriptEnvironment second(state);
+    first.LoadScript(script);
+    second.LoadScript(script);
+
+    first.CallFunction("Increment");
+    first.CallFunction("Increment");
+    second.CallFunction("Increment");
+    REQUIRE( recorded == std::vector<int>{ 1, 2, 1 } );
+    state.GetNative()["Record"] = sol::lua_nil;
+    Script::SetCacheEnabled(true);
+}
+
+TEST_CASE( "Compiled scripts are cached beside their source", "[Script]" ) {
+    Script::SetCacheEnabled(true);
+    const std::string path = WriteScript("cached.lua", "function OnStart() return 1 end\n");
+    std::filesystem::remove(Script::GetCachePath(path));
+
+    Script cold("cached.lua", path);
+    const std::string bytecode = cold.GetBytecode();
+    REQUIRE_FALSE( bytecode.empty() );
+    REQUIRE( std::filesystem::exists(Script::GetCachePath(path)) );
+
+    Script warm("cached.lua", path);
+    REQUIRE( warm.GetBytecode() == bytecode );
+
+    // an edited script never loads the old bytecode
+    WriteScript("cached.lua", "function OnStart() return 2 end\n");
+    Script edited("cached.lua", path);
+    REQUIRE_FALSE( edited.GetBytecode().empty() );
+    REQUIRE( edited.GetBytecode() != bytecode );
+}
+
+TEST_CASE( "Missing callbacks resolve to invalid functions", "[Script]" ) {
+    Script::SetCacheEnabled(false);
+    const std::string path = WriteScript("callbacks.lua", "function OnUpdate(dt) return dt end\n");
+    Script script("callbacks.lua", path);
+
+    ScriptEnvironment env(ScriptEngine::GetState());
+    env.LoadScript(script);
+    REQUIRE( env.GetFunction("OnUpdate").valid() );
+    REQUIRE_FALSE( env.GetFunction("OnLateUpdate").valid() );
+    Script::SetCacheEnabled(true);
+}
+
+TEST_CASE( "Script timings report the last finished frame", "[Script]" ) {
+    const std::string path = WriteScript("timed.lua", "");
+    Script script("timed.lua", path);
+
+    Script::BeginFrame();
+    script.RecordCall(0.001);
+    script.RecordCall(0.002);
+    REQUIRE( script.GetFrameTiming().calls == 0 );
+
+    Script::BeginFrame();
+    Script::Timing timing = script.GetFrameTiming();
+    REQUIRE( timing.calls == 2 );
+    REQUIRE( timing.seconds > 0.0029 );
+
+    script.RecordCall(0.004);
+    REQUIRE( script.GetFrameTiming().calls == 2 );
+
+    // a frame without calls is reported as empty
+    Script::BeginFrame();
+    Script::BeginFrame();
+    REQUIRE( script.GetFrameTiming().calls == 0 );
+}
+
+TEST_CASE( "System scripts update every instance in one call", "[Script]" ) {
+    Script::SetCacheEnabled(false);
+    const std::string path = WriteScript("system.lua",
+        "speed = 1\n"
+        "function OnUpdateSystem(instances, dt)\n"
+        "    for i = 1, #instances do\n"
+        "        instances[i].speed = instances[i].speed + dt\n"
+        "    end\n"
+        "end\n"
+    );
+    const std::string plainPath = WriteScript("plain.lua", "ticks = 0\nfunction OnUpdate(dt) ticks = ticks + 1 end\n");
+    Script script("system.lua", path);
+    Script plain("plain.lua", plainPath);
+
+    ScriptState& state = ScriptEngine::GetState();
+    Entity entity;
+    std::vector<UniquePtr<EntityScript>> scripts;
+    for (int i = 0; i < 3; ++i)
+    {
+        scripts.push_back(MakeUnique<EntityScript>(entity, state, &script));
+    }
+    scripts.push_back(MakeUnique<EntityScript>(entity, state, &plain));
+
+    ScriptScheduler scheduler(state);
+    for (UniquePtr<EntityScript>& instance : scripts)
+    {
+        scheduler.Submit(*instance);
+    }
+
+    scheduler.Run(EntityScript::Update, 0.5f);
+    scheduler.Run(EntityScript::Update, 0.5f);
+    REQUIRE( scheduler.GetStats().systemCalls == 2 );
+    REQUIRE( scheduler.GetStats().batched == 6 );
+    REQUIRE( scheduler.GetStats().entityCalls == 2 );
+
+    for (int i = 0; i < 3; ++i)
+    {
+        REQUIRE( scripts[i]->GetEnvironment().GetNative().get<float>("speed") == 2.0f );
+    }
+    REQUIRE( scripts[3]->GetEnvironment().GetNative().get<int>("ticks") == 2 );
+
+    // an instance that leaves is no longer updated by the system
+    scheduler.Clear();
+    scheduler.Submit(*scripts[0]);
+    scheduler.Run(EntityScript::Update, 1.0f);
+    REQUIRE( scripts[0]->GetEnvironment().GetNative().get<float>("speed") == 3.0f );
+    REQUIRE( scripts[1]->GetEnvironment().GetNative().get<float>("speed") == 2.0f );
+    Script::SetCacheEnabled(true);
+}
+
+TEST_CASE( "Incremental collection is spread over frames", "[Script]" ) {
+    ScriptState& state = BeginGarbage(ScriptState::GCMode::Incremental, 0.001f);
+    const Uint32 cycles = state.GetGCStats().cycles;
+    for (int i = 0; i < 200 && state.GetGCStats().cycles == cycles; ++i)
+    {
+        state.CallFunction("Frame", 2000);
+        state.StepGC();
+    }
+
+    REQUIRE( state.GetGCStats().cycles > cycles );
+    REQUIRE( state.GetGCStats().heapBytes > 0 );
+
+    // without garbage, there is nothing to collect until the heap grows again
+    state.StepGC();
+    state.StepGC();
+    REQUIRE( state.GetGCStats().steps == 0 );
+    EndGarbage(state);
+}
+
+TEST_CASE( "Script spawn", "[Script][!benchmark]" ) {
+    Script::SetCacheEnabled(false);
+    const std::string path = WriteScript("behaviour.lua", BehaviourSource());
+    Script script("behaviour.lua", path);
+    ScriptState& state = ScriptEngine::GetState();
+    script.GetBytecode();
+
+    BENCHMARK( "Compile per entity" ) {
+        ScriptEnvironment env(state);
+        env.LoadScript(script.GetData());
+    };
+
+    BENCHMARK( "Load shared chunk per entity" ) {
+        ScriptEnvironment env(state);
+        env.LoadScript(script);
+    };
+
+    Script::SetCacheEnabled(true);
+}
+
+TEST_CASE( "Script update dispatch", "[Script][!benchmark]" ) {
+    Script::SetCacheEnabled(false);
+    const std::string perEntityPath = WriteScript("mover.lua",
+        "x = 0\n"
+        "function OnUpdate(dt) x = x + dt end\n"
+    );
+    const std::string systemPath = WriteScript("mover_system.lua",
+        "x = 0\n"
+        "function OnUpdateSystem(instances, dt)\n"
+        "    for i = 1, #instances do\n"
+        "        local instance = instances[i]\n"
+        "        instance.x = instance.x + dt\n"
+        "    end\n"
+        "end\n"
+    );
+    Script perEntity("mover.lua", perEntityPath);
+    Script system("mover_system.lua", systemPath);
+
+    ScriptState& state = ScriptEngine::GetState();
+    Entity entity;
+    constexpr int count = 5000;
+    std::vector<UniquePtr<EntityScript>> perEntityScripts;
+    std::vector<UniquePtr<EntityScript>> systemScripts;
+    for (int i = 0; i < count; ++i)
+    {
+        perEntityScripts.push_back(MakeUnique<EntityScript>(entity, state, &perEntity));
+        systemScripts.push_back(MakeUnique<EntityScript>(entity, state, &system));
+    }
+
+    ScriptScheduler perEntityScheduler(state);
+    ScriptScheduler systemScheduler(state);
+    for (int i = 0; i < count; ++i)
+    {
+        perEntityScheduler.Submit(*perEntityScripts[i]);
+        systemScheduler.Submit(*systemScripts[i]);
+    }
+
+    BENCHMARK( "Per entity OnUpdate (5000 entities)" ) {
+        perEntityScheduler.Run(EntityScript::Update, 0.016f);
+    };
+
+    BENCHMARK( "System OnUpdateSystem (5000 entities)" ) {
+        systemScheduler.Run(EntityScript::Update, 0.016f);
+    };
+
+    Script::SetCacheEnabled(true);
+}
+
+TEST_CASE( "Lua garbage stress", "[Script][!benchmark]" ) {
+    Size_t heapBytes = 0;
+    const double automatic = FrameTimeP99(ScriptState::GCMode::Incremental, 0.0f, heapBytes);
+    WARN( "Lua collecting as it allocates: p99 " << automatic * 1000.0 << " ms, heap " << heapBytes / 1024 << " KB" );
+
+    const double incremental = FrameTimeP99(ScriptState::GCMode::Incremental, 0.001f, heapBytes);
+    WARN( "Incremental, 1 ms budget: p99 " << incremental * 1000.0 << " ms, heap " << heapBytes / 1024 << " KB" );
+
+    const double generational = FrameTimeP99(ScriptState::GCMode::Generational, 0.001f, heapBytes);
+    WARN( "Generational, minor collection per frame: p99 " << generational * 1000.0 << " ms, heap " << heapBytes / 1024 << " KB" );
+}